@@ -0,0 +1,62 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "psen_scan_v2/laserscan_ros_conversions.h"
+
+#include "psen_scan_v2_standalone/data_conversion_layer/laserscan_conversions.h"
+#include "psen_scan_v2_standalone/laserscan.h"
+#include "psen_scan_v2_standalone/util/logging.h"
+
+#include "psen_scan_v2_standalone/benchmarks/allocation_counter.h"
+#include "psen_scan_v2_standalone/benchmarks/benchmark_helper.h"
+
+namespace psen_scan_v2_benchmarks
+{
+using namespace psen_scan_v2_standalone_benchmarks;
+
+static void toLaserScanMsg(benchmark::State& state)
+{
+  const psen_scan_v2_standalone::LaserScan scan{
+    psen_scan_v2_standalone::data_conversion_layer::LaserScanConverter::toLaserScan(
+        stamp(createScanRound(frameOptions(state))))
+  };
+
+  const uint64_t num_allocations_at_start{ numAllocations() };
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(psen_scan_v2::toLaserScanMsg(scan, "scanner", 0.));
+  }
+  setFrameCounters(state, NUM_FRAMES_PER_ROUND, num_allocations_at_start);
+}
+BENCHMARK(toLaserScanMsg)->Apply(frameOptionArguments);
+
+}  // namespace psen_scan_v2_benchmarks
+
+int main(int argc, char** argv)
+{
+  console_bridge::setLogLevel(console_bridge::CONSOLE_BRIDGE_LOG_WARN);
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+  {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
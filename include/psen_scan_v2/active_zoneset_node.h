@@ -33,7 +33,11 @@ static const std::string DEFAULT_ZONECONFIGURATION_TOPIC = "zoneconfiguration";
 static const std::string DEFAULT_ZONESET_MARKER_ARRAY_TOPIC = "active_zoneset_markers";
 
 /**
- * @brief ROS Node that continuously publishes a marker for the active_zoneset.
+ * @brief ROS Node that publishes a marker for the active_zoneset.
+ *
+ * The markers of all zonesets are created once when the zoneset configuration is received. Markers are only
+ * published if the active zoneset changes or a new zoneset configuration is received. The marker topic is latched, so
+ * subscribers connecting later, e.g. a restarted RViz, still receive the markers of the active zoneset.
  *
  * subscribes to: ns/active_zoneset
  * subscribes to: ns/zoneconfiguration
@@ -62,7 +66,8 @@ private:
   [[deprecated("use ZoneSet activeZoneset() const instead")]] ZoneSet getActiveZoneset() const;
   ZoneSet activeZoneset() const;
 
-  void addMarkers(std::vector<visualization_msgs::Marker>& new_markers);
+  void cacheMarkers();
+  void addMarkers(const std::vector<visualization_msgs::Marker>& new_markers);
   void publishCurrentMarkers();
   void addDeleteMessageForUnusedLastMarkers();
 
@@ -74,6 +79,10 @@ private:
 
   boost::optional<ZoneSetConfiguration> zoneset_config_;
   boost::optional<std_msgs::UInt8> active_zoneset_id_;
+  //! Id of the zoneset whose markers were published last; reset on receipt of a new zoneset configuration.
+  boost::optional<uint8_t> published_zoneset_id_;
+  //! Markers of all zonesets indexed by the zoneset id.
+  std::vector<std::vector<visualization_msgs::Marker>> zoneset_markers_cache_;
   std::vector<visualization_msgs::Marker> last_markers_;
   std::vector<visualization_msgs::Marker> current_markers_;
 };
@@ -24,6 +24,7 @@
 
 #include "psen_scan_v2/ZoneSet.h"
 #include "psen_scan_v2/ZoneSetConfiguration.h"
+#include "psen_scan_v2/polygon_simplification.h"
 
 /**
  * @brief Root namespace for the ROS part
@@ -39,7 +40,20 @@ static const std::string DEFAULT_ZONESET_TOPIC = "zoneconfiguration";
 class ConfigServerNode
 {
 public:
-  ConfigServerNode(ros::NodeHandle& nh, const char* config_file_path, const std::string& frame_id);
+  /**
+   * @brief Constructor.
+   *
+   * @param nh Node handle for the ROS node on which the zonesets are advertised.
+   * @param config_file_path Path to the xml configuration file.
+   * @param frame_id Frame id of the published zonesets.
+   * @param polygon_simplification_tolerance Tolerance in meter with which the zone polygons are simplified.
+   * @param cache_file_path Path to a binary cache of the parsed configuration. An empty path disables the cache.
+   */
+  ConfigServerNode(ros::NodeHandle& nh,
+                   const char* config_file_path,
+                   const std::string& frame_id,
+                   const double& polygon_simplification_tolerance = NO_POLYGON_SIMPLIFICATION,
+                   const std::string& cache_file_path = "");
 
 private:
   ros::NodeHandle nh_;
@@ -0,0 +1,149 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_POLYGON_SIMPLIFICATION_H
+#define PSEN_SCAN_V2_POLYGON_SIMPLIFICATION_H
+
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <geometry_msgs/Point32.h>
+#include <geometry_msgs/Polygon.h>
+
+#include "psen_scan_v2/ZoneSet.h"
+#include "psen_scan_v2/ZoneSetConfiguration.h"
+
+namespace psen_scan_v2
+{
+//! @brief Tolerance which disables the polygon simplification.
+static constexpr double NO_POLYGON_SIMPLIFICATION{ 0. };
+
+namespace polygon_simplification
+{
+//! @returns the distance of point p to the line segment from a to b.
+inline double distanceToSegment(const geometry_msgs::Point32& p,
+                                const geometry_msgs::Point32& a,
+                                const geometry_msgs::Point32& b)
+{
+  const double dx = b.x - a.x;
+  const double dy = b.y - a.y;
+  const double length_squared = dx * dx + dy * dy;
+  double t = 0.;
+  if (length_squared > 0.)
+  {
+    t = ((p.x - a.x) * dx + (p.y - a.y) * dy) / length_squared;
+    t = std::fmin(1., std::fmax(0., t));
+  }
+  return std::hypot(p.x - (a.x + t * dx), p.y - (a.y + t * dy));
+}
+}  // namespace polygon_simplification
+
+/**
+ * @brief Reduces the number of points of a polyline using the Douglas-Peucker algorithm.
+ *
+ * Consecutive points which coincide (e.g. runs of zero radii) or only deviate by at most the tolerance from the
+ * simplified polyline (e.g. straight field borders or flat arcs of equal radii) are merged. The first and the last
+ * point are always kept.
+ *
+ * @param points The polyline as created by fromPolar().
+ * @param tolerance Maximal distance in meter between a removed point and the simplified polyline. A tolerance <= 0
+ * returns the points unchanged.
+ */
+inline std::vector<geometry_msgs::Point32> simplify(const std::vector<geometry_msgs::Point32>& points,
+                                                    const double& tolerance)
+{
+  if (tolerance <= NO_POLYGON_SIMPLIFICATION || points.size() < 3)
+  {
+    return points;
+  }
+
+  std::vector<bool> keep(points.size(), false);
+  keep.front() = true;
+  keep.back() = true;
+
+  std::vector<std::pair<std::size_t, std::size_t>> segments{ { 0, points.size() - 1 } };
+  while (!segments.empty())
+  {
+    const auto segment = segments.back();
+    segments.pop_back();
+
+    double max_distance = 0.;
+    std::size_t farthest = segment.first;
+    for (std::size_t i = segment.first + 1; i < segment.second; ++i)
+    {
+      const double distance =
+          polygon_simplification::distanceToSegment(points[i], points[segment.first], points[segment.second]);
+      if (distance > max_distance)
+      {
+        max_distance = distance;
+        farthest = i;
+      }
+    }
+
+    if (max_distance > tolerance)
+    {
+      keep[farthest] = true;
+      segments.emplace_back(segment.first, farthest);
+      segments.emplace_back(farthest, segment.second);
+    }
+  }
+
+  std::vector<geometry_msgs::Point32> simplified;
+  for (std::size_t i = 0; i < points.size(); ++i)
+  {
+    if (keep[i])
+    {
+      simplified.push_back(points[i]);
+    }
+  }
+  return simplified;
+}
+
+inline geometry_msgs::Polygon simplify(const geometry_msgs::Polygon& polygon, const double& tolerance)
+{
+  geometry_msgs::Polygon simplified;
+  simplified.points = simplify(polygon.points, tolerance);
+  return simplified;
+}
+
+inline ZoneSet simplify(const ZoneSet& zoneset, const double& tolerance)
+{
+  ZoneSet simplified{ zoneset };
+  simplified.safety1 = simplify(zoneset.safety1, tolerance);
+  simplified.safety2 = simplify(zoneset.safety2, tolerance);
+  simplified.safety3 = simplify(zoneset.safety3, tolerance);
+  simplified.warn1 = simplify(zoneset.warn1, tolerance);
+  simplified.warn2 = simplify(zoneset.warn2, tolerance);
+  simplified.muting1 = simplify(zoneset.muting1, tolerance);
+  simplified.muting2 = simplify(zoneset.muting2, tolerance);
+  return simplified;
+}
+
+inline ZoneSetConfiguration simplify(const ZoneSetConfiguration& zoneset_config, const double& tolerance)
+{
+  ZoneSetConfiguration simplified;
+  simplified.zonesets.reserve(zoneset_config.zonesets.size());
+  for (const auto& zoneset : zoneset_config.zonesets)
+  {
+    simplified.zonesets.push_back(simplify(zoneset, tolerance));
+  }
+  return simplified;
+}
+
+}  // namespace psen_scan_v2
+
+#endif  // PSEN_SCAN_V2_POLYGON_SIMPLIFICATION_H
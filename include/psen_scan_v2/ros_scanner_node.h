@@ -76,6 +76,12 @@ public:
   void run();
   //! @brief Terminates the fetching and publishing of scanner data.
   void terminate();
+  /**
+   * @brief Restarts the running scanner with changed scan settings via the existing connection.
+   * @throw std::invalid_argument if not only the scan settings are changed.
+   * @throw std::runtime_error if the reconfiguration was not successful or did not finish within 3 seconds.
+   */
+  void reconfigure(const ScannerConfiguration& scanner_config);
 
 private:
   void laserScanCallback(const LaserScan& scan);
@@ -106,6 +112,8 @@ private:
   FRIEND_TEST(RosScannerNodeTests, shouldPublishChangedIOStatesEqualToConversionOfSuppliedStandaloneIOStates);
   FRIEND_TEST(RosScannerNodeTests, shouldPublishLatchedOnIOStatesTopic);
   FRIEND_TEST(RosScannerNodeTests, shouldLogChangedIOStates);
+  FRIEND_TEST(RosScannerNodeTests, shouldPassConfigurationToScannerOnReconfigure);
+  FRIEND_TEST(RosScannerNodeTests, shouldThrowExceptionSetInScannerReconfigureFuture);
 };
 
 typedef ROSScannerNodeT<> ROSScannerNode;
@@ -166,8 +174,8 @@ void ROSScannerNodeT<S>::publishChangedIOStates(const std::vector<psen_scan_v2_s
 
       PSENSCAN_INFO("RosScannerNode",
                     "IOs changed, new input: {}, new output: {}",
-                    formatPinStates(io.changedInputStates(last_io_state_)),
-                    formatPinStates(io.changedOutputStates(last_io_state_)));
+                    formatPinStates(io.changedInputPins(last_io_state_)),
+                    formatPinStates(io.changedOutputPins(last_io_state_)));
       last_io_state_ = io;
     }
   }
@@ -179,6 +187,22 @@ void ROSScannerNodeT<S>::terminate()
   terminate_ = true;
 }
 
+template <typename S>
+void ROSScannerNodeT<S>::reconfigure(const ScannerConfiguration& scanner_config)
+{
+  auto reconfigure_future = scanner_.reconfigure(scanner_config);
+  if (!reconfigure_future.valid())
+  {
+    throw std::runtime_error("A reconfiguration of the scanner is already in progress.");
+  }
+  const auto reconfigure_status = reconfigure_future.wait_for(3s);
+  if (reconfigure_status != std::future_status::ready)
+  {
+    throw std::runtime_error("Timeout while waiting for the scanner to reconfigure.");
+  }
+  reconfigure_future.get();  // Throws std::runtime_error if reconfiguration not successful
+}
+
 template <typename S>
 void ROSScannerNodeT<S>::run()
 {
@@ -35,29 +35,44 @@ ActiveZonesetNode::ActiveZonesetNode(ros::NodeHandle& nh) : nh_(nh)
   zoneset_subscriber_ = nh_.subscribe(DEFAULT_ZONECONFIGURATION_TOPIC, 2, &ActiveZonesetNode::zonesetCallback, this);
   active_zoneset_subscriber_ =
       nh_.subscribe(DEFAULT_ACTIVE_ZONESET_TOPIC, 10, &ActiveZonesetNode::activeZonesetCallback, this);
-  zoneset_markers_ = nh_.advertise<visualization_msgs::MarkerArray>(DEFAULT_ZONESET_MARKER_ARRAY_TOPIC, 10);
+  zoneset_markers_ = nh_.advertise<visualization_msgs::MarkerArray>(DEFAULT_ZONESET_MARKER_ARRAY_TOPIC, 10, true);
 }
 
 void ActiveZonesetNode::zonesetCallback(const ZoneSetConfiguration& zoneset_config)
 {
   zoneset_config_ = zoneset_config;
+  cacheMarkers();
+  published_zoneset_id_ = boost::none;
   updateMarkers();
 }
 
 void ActiveZonesetNode::activeZonesetCallback(const std_msgs::UInt8& active_zoneset_id)
 {
   active_zoneset_id_ = active_zoneset_id;
+  if (published_zoneset_id_ && *published_zoneset_id_ == active_zoneset_id.data)
+  {  // markers of this zoneset are already shown
+    return;
+  }
   updateMarkers();
 };
 
+void ActiveZonesetNode::cacheMarkers()
+{
+  zoneset_markers_cache_.clear();
+  zoneset_markers_cache_.reserve(zoneset_config_->zonesets.size());
+  for (const auto& zoneset : zoneset_config_->zonesets)
+  {
+    zoneset_markers_cache_.push_back(toMarkers(zoneset));
+  }
+}
+
 void ActiveZonesetNode::updateMarkers()
 {
   if (isAllInformationAvailable())
   {
     try
     {
-      auto new_markers = toMarkers(activeZoneset());
-      addMarkers(new_markers);
+      addMarkers(zoneset_markers_cache_.at(active_zoneset_id_->data));
     }
     catch (std::out_of_range const& e)
     {
@@ -67,6 +82,7 @@ void ActiveZonesetNode::updateMarkers()
     }
     addDeleteMessageForUnusedLastMarkers();
     publishCurrentMarkers();
+    published_zoneset_id_ = active_zoneset_id_->data;
   }
 }
 
@@ -87,12 +103,9 @@ ZoneSet ActiveZonesetNode::getActiveZoneset() const
 }
 // LCOV_EXCL_STOP
 
-void ActiveZonesetNode::addMarkers(std::vector<visualization_msgs::Marker>& new_markers)
+void ActiveZonesetNode::addMarkers(const std::vector<visualization_msgs::Marker>& new_markers)
 {
-  for (const auto& marker : new_markers)
-  {
-    current_markers_.push_back(marker);
-  }
+  current_markers_.insert(current_markers_.end(), new_markers.begin(), new_markers.end());
 }
 
 void ActiveZonesetNode::addDeleteMessageForUnusedLastMarkers()
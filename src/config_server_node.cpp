@@ -17,6 +17,7 @@
 
 #include "psen_scan_v2/config_server_node.h"
 #include "psen_scan_v2/ZoneSetConfiguration.h"
+#include "psen_scan_v2/polygon_simplification.h"
 #include "psen_scan_v2/zoneset_configuration_ros_conversion.h"
 #include "psen_scan_v2_standalone/configuration/xml_configuration_parsing.h"
 #include "psen_scan_v2_standalone/configuration/zoneset_configuration.h"
@@ -24,12 +25,18 @@
 using namespace psen_scan_v2;
 using namespace psen_scan_v2_standalone;
 
-ConfigServerNode::ConfigServerNode(ros::NodeHandle& nh, const char* config_file_path, const std::string& frame_id)
+ConfigServerNode::ConfigServerNode(ros::NodeHandle& nh,
+                                   const char* config_file_path,
+                                   const std::string& frame_id,
+                                   const double& polygon_simplification_tolerance,
+                                   const std::string& cache_file_path)
   : nh_(nh)
 {
   try
   {
-    auto zoneconfig = configuration::xml_config_parsing::parseFile(config_file_path);
+    auto zoneconfig = cache_file_path.empty() ?
+                          configuration::xml_config_parsing::parseFile(config_file_path) :
+                          configuration::xml_config_parsing::parseFile(config_file_path, cache_file_path);
     zoneset_pub_ = nh_.advertise<::psen_scan_v2::ZoneSetConfiguration>(DEFAULT_ZONESET_TOPIC, 1, true /*latched*/);
 
     ROS_WARN_STREAM_NAMED(
@@ -41,7 +48,7 @@ ConfigServerNode::ConfigServerNode(ros::NodeHandle& nh, const char* config_file_
         "You are using \"" +
             std::string(config_file_path) + "\" please make sure that is the one you intented to use.");
 
-    zoneset_pub_.publish(toRosMsg(zoneconfig, frame_id));
+    zoneset_pub_.publish(simplify(toRosMsg(zoneconfig, frame_id), polygon_simplification_tolerance));
   }
   // LCOV_EXCL_START
   catch (const configuration::xml_config_parsing::XMLConfigurationParserException& e)
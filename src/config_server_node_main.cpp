@@ -20,6 +20,8 @@
 
 const std::string CONFIG_FILE{ "config_file" };
 const std::string FRAME_ID{ "frame_id" };
+const std::string POLYGON_SIMPLIFICATION_TOLERANCE{ "polygon_simplification_tolerance" };
+const std::string CONFIG_CACHE_FILE{ "config_cache_file" };
 
 using namespace psen_scan_v2;
 
@@ -31,9 +33,14 @@ int main(int argc, char** argv)
 
   try
   {
+    const double polygon_simplification_tolerance =
+        getOptionalParamFromServer<double>(pnh, POLYGON_SIMPLIFICATION_TOLERANCE, NO_POLYGON_SIMPLIFICATION);
+    const std::string config_cache_file = getOptionalParamFromServer<std::string>(pnh, CONFIG_CACHE_FILE, "");
     psen_scan_v2::ConfigServerNode config_server_node(nh,
                                                       getRequiredParamFromServer<std::string>(pnh, CONFIG_FILE).c_str(),
-                                                      getRequiredParamFromServer<std::string>(pnh, FRAME_ID));
+                                                      getRequiredParamFromServer<std::string>(pnh, FRAME_ID),
+                                                      polygon_simplification_tolerance,
+                                                      config_cache_file);
 
     ros::spin();
   }
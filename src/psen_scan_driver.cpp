@@ -13,19 +13,25 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
 #include <csignal>
 #include <future>
+#include <limits>
 #include <string>
 
 #include <ros/ros.h>
+#include <dynamic_reconfigure/server.h>
 
 #include "psen_scan_v2_standalone/configuration/default_parameters.h"
 #include "psen_scan_v2_standalone/protocol_layer/function_pointers.h"
 #include "psen_scan_v2_standalone/scanner_configuration.h"
 #include "psen_scan_v2_standalone/scanner_config_builder.h"
+#include "psen_scan_v2_standalone/scan_filter.h"
 #include "psen_scan_v2_standalone/scan_range.h"
 
+#include "psen_scan_v2/PSENscanConfig.h"
 #include "psen_scan_v2/default_ros_parameters.h"
 #include "psen_scan_v2/ros_parameter_handler.h"
 #include "psen_scan_v2/ros_scanner_node.h"
@@ -49,12 +55,49 @@ const std::string PARAM_X_AXIS_ROTATION{ "x_axis_rotation" };
 const std::string PARAM_FRAGMENTED_SCANS{ "fragmented_scans" };
 const std::string PARAM_INTENSITIES{ "intensities" };
 const std::string PARAM_RESOLUTION{ "resolution" };
+const std::string PARAM_FILTER_RANGE_MIN{ "filter_range_min" };
+const std::string PARAM_FILTER_RANGE_MAX{ "filter_range_max" };
+const std::string PARAM_FILTER_MIN_INTENSITY{ "filter_min_intensity" };
+const std::string PARAM_FILTER_SHADOW_ANGLE{ "filter_shadow_angle" };
+const std::string PARAM_FILTER_SHADOW_WINDOW{ "filter_shadow_window" };
+const std::string PARAM_FILTER_MEDIAN_WINDOW{ "filter_median_window" };
 
 static const std::string DEFAULT_TF_PREFIX = "laser_1";
 
 //! @brief Topic on which the LaserScan data are published.
 static const std::string DEFAULT_PUBLISH_TOPIC = "scan";
 
+//! @brief Adds the scan filters enabled via the parameters in the order range, intensity, shadow, median.
+void addScanFilters(const ros::NodeHandle& pnh, ScannerConfigurationBuilder& builder)
+{
+  const double range_min{ getOptionalParamFromServer<double>(pnh, PARAM_FILTER_RANGE_MIN, 0.) };
+  const double range_max{ getOptionalParamFromServer<double>(pnh, PARAM_FILTER_RANGE_MAX, 0.) };
+  if (range_min > 0. || range_max > 0.)
+  {
+    builder.addScanFilter(RangeFilter(range_min, range_max > 0. ? range_max : std::numeric_limits<double>::infinity()));
+  }
+
+  const double min_intensity{ getOptionalParamFromServer<double>(pnh, PARAM_FILTER_MIN_INTENSITY, 0.) };
+  if (min_intensity > 0.)
+  {
+    builder.addScanFilter(IntensityFilter(min_intensity));
+  }
+
+  const double shadow_angle{ getOptionalParamFromServer<double>(pnh, PARAM_FILTER_SHADOW_ANGLE, 0.) };
+  if (shadow_angle > 0.)
+  {
+    const int window{ getOptionalParamFromServer<int>(pnh, PARAM_FILTER_SHADOW_WINDOW, 1) };
+    builder.addScanFilter(
+        ShadowFilter(shadow_angle, M_PI - shadow_angle, static_cast<std::size_t>(std::max(window, 0))));
+  }
+
+  const int median_window{ getOptionalParamFromServer<int>(pnh, PARAM_FILTER_MEDIAN_WINDOW, 0) };
+  if (median_window > 0)
+  {
+    builder.addScanFilter(MedianFilter(static_cast<std::size_t>(median_window)));
+  }
+}
+
 void delayed_shutdown_sig_handler(int sig)
 {
   NODE_TERMINATE_CALLBACK();
@@ -81,7 +124,7 @@ int main(int argc, char** argv)
                                                        getOptionalParamFromServer<double>(
                                                            pnh, PARAM_ANGLE_END, configuration::DEFAULT_ANGLE_END)) };
 
-    ScannerConfiguration scanner_configuration{
+    ScannerConfigurationBuilder config_builder{
       ScannerConfigurationBuilder(getRequiredParamFromServer<std::string>(pnh, PARAM_SCANNER_IP))
           .hostIP(getOptionalParamFromServer<std::string>(pnh, PARAM_HOST_IP, configuration::DEFAULT_HOST_IP_STRING))
           .hostDataPort(
@@ -97,8 +140,9 @@ int main(int argc, char** argv)
           .enableIntensities(getOptionalParamFromServer<bool>(pnh, PARAM_INTENSITIES, configuration::INTENSITIES))
           .scanResolution(util::TenthOfDegree::fromRad(
               getOptionalParamFromServer<double>(pnh, PARAM_RESOLUTION, configuration::DEFAULT_SCAN_ANGLE_RESOLUTION)))
-          .build()
     };
+    addScanFilters(pnh, config_builder);
+    ScannerConfiguration scanner_configuration{ config_builder.build() };
 
     if (scanner_configuration.fragmentedScansEnabled())
     {
@@ -113,6 +157,35 @@ int main(int argc, char** argv)
 
     NODE_TERMINATE_CALLBACK = std::bind(&ROSScannerNode::terminate, &ros_scanner_node);
 
+    // The server calls the callback once on construction with the parameters the scanner is started with anyway.
+    bool initial_reconfigure_call{ true };
+    dynamic_reconfigure::Server<PSENscanConfig> reconfigure_server(pnh);
+    reconfigure_server.setCallback([&](const PSENscanConfig& config, uint32_t /*level*/) {
+      if (initial_reconfigure_call)
+      {
+        initial_reconfigure_call = false;
+        return;
+      }
+      try
+      {
+        ros_scanner_node.reconfigure(
+            ScannerConfigurationBuilder(scanner_configuration)
+                .scanRange(ScanRange{ util::TenthOfDegree::fromRad(DEFAULT_X_AXIS_ROTATION + config.angle_start),
+                                      util::TenthOfDegree::fromRad(DEFAULT_X_AXIS_ROTATION + config.angle_end) })
+                .scanResolution(util::TenthOfDegree::fromRad(config.resolution))
+                .enableIntensities(config.intensities)
+                .build());
+      }
+      catch (const std::exception& e)
+      {
+        ROS_ERROR_STREAM("Reconfiguration of the scanner failed: " << e.what());
+      }
+    });
+
+    // The reconfiguration requests are handled while run() blocks this thread.
+    ros::AsyncSpinner spinner{ 1 };
+    spinner.start();
+
     ros_scanner_node.run();
   }
   catch (std::exception& e)
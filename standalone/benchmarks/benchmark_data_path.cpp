@@ -0,0 +1,341 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "psen_scan_v2_standalone/communication_layer/frame_recorder.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/frame_recording.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/io_pin_data.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/laserscan_conversions.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_deserialization.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/scan_log.h"
+#include "psen_scan_v2_standalone/io_state.h"
+#include "psen_scan_v2_standalone/laserscan.h"
+#include "psen_scan_v2_standalone/protocol_layer/scan_buffer.h"
+#include "psen_scan_v2_standalone/scan_deskewer.h"
+#include "psen_scan_v2_standalone/scan_filter.h"
+#include "psen_scan_v2_standalone/scan_range.h"
+#include "psen_scan_v2_standalone/scanner_config_builder.h"
+#include "psen_scan_v2_standalone/scanner_replay.h"
+#include "psen_scan_v2_standalone/util/logging.h"
+
+#include "psen_scan_v2_standalone/benchmarks/allocation_counter.h"
+#include "psen_scan_v2_standalone/benchmarks/benchmark_helper.h"
+
+namespace psen_scan_v2_standalone_benchmarks
+{
+static void deserialize(benchmark::State& state)
+{
+  const auto raw_frames{ serialize(createScanRound(frameOptions(state))) };
+
+  const uint64_t num_allocations_at_start{ numAllocations() };
+  for (auto _ : state)
+  {
+    for (const auto& raw_frame : raw_frames)
+    {
+      benchmark::DoNotOptimize(data_conversion_layer::monitoring_frame::deserialize(raw_frame, raw_frame.size()));
+    }
+  }
+  setFrameCounters(state, raw_frames.size(), num_allocations_at_start);
+}
+BENCHMARK(deserialize)->Apply(frameOptionArguments);
+
+static void scanBufferAdd(benchmark::State& state)
+{
+  const auto stamped_frames{ stamp(createScanRound(frameOptions(state))) };
+  const uint32_t num_frames_per_round{ NUM_FRAMES_PER_ROUND };
+
+  const uint64_t num_allocations_at_start{ numAllocations() };
+  for (auto _ : state)
+  {
+    // A new buffer per round, because the frames of the round all have the same scan counter.
+    protocol_layer::ScanBuffer scan_buffer{ num_frames_per_round };
+    for (const auto& stamped_frame : stamped_frames)
+    {
+      scan_buffer.add(stamped_frame);
+    }
+    if (scan_buffer.isRoundComplete())
+    {
+      benchmark::DoNotOptimize(scan_buffer.currentRound());
+    }
+  }
+  setFrameCounters(state, stamped_frames.size(), num_allocations_at_start);
+}
+BENCHMARK(scanBufferAdd)->Apply(frameOptionArguments);
+
+static void toLaserScan(benchmark::State& state)
+{
+  const auto stamped_frames{ stamp(createScanRound(frameOptions(state))) };
+
+  const uint64_t num_allocations_at_start{ numAllocations() };
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(data_conversion_layer::LaserScanConverter::toLaserScan(stamped_frames));
+  }
+  setFrameCounters(state, stamped_frames.size(), num_allocations_at_start);
+}
+BENCHMARK(toLaserScan)->Apply(frameOptionArguments);
+
+//! De-skews a scan round of a scanner moving with 2m/s while rotating with 1rad/s.
+static void scanDeskew(benchmark::State& state)
+{
+  const auto stamped_frames{ stamp(createScanRound(frameOptions(state))) };
+  const auto scan{ data_conversion_layer::LaserScanConverter::toLaserScan(stamped_frames) };
+  const auto pose_at_time = [&scan](const int64_t& timestamp) {
+    const double t{ static_cast<double>(timestamp - scan.timestamp()) * 1e-9 };
+    return Pose2D{ 2. * t, 0., t };
+  };
+  ScanDeskewer deskewer;
+  DeskewedScan result;
+  deskewer.deskew(scan, pose_at_time, result);
+
+  const uint64_t num_allocations_at_start{ numAllocations() };
+  for (auto _ : state)
+  {
+    deskewer.deskew(scan, pose_at_time, result);
+    benchmark::DoNotOptimize(result.x.data());
+    benchmark::DoNotOptimize(result.y.data());
+  }
+  setFrameCounters(state, NUM_FRAMES_PER_ROUND, num_allocations_at_start);
+}
+BENCHMARK(scanDeskew)->Apply(frameOptionArguments);
+
+//! Applies range, shadow and median filter to a scan round.
+static void scanFilter(benchmark::State& state)
+{
+  const auto stamped_frames{ stamp(createScanRound(frameOptions(state))) };
+  const auto scan{ data_conversion_layer::LaserScanConverter::toLaserScan(stamped_frames) };
+  ScanFilterChain chain({ std::make_shared<RangeFilter>(0.1, 10.),
+                          std::make_shared<ShadowFilter>(0.17, 2.97),
+                          std::make_shared<MedianFilter>(5) });
+  LaserScan filtered_scan{ scan };
+  chain.apply(filtered_scan);
+
+  const uint64_t num_allocations_at_start{ numAllocations() };
+  for (auto _ : state)
+  {
+    filtered_scan.measurements() = scan.measurements();
+    chain.apply(filtered_scan);
+    benchmark::DoNotOptimize(filtered_scan.measurements().data());
+  }
+  setFrameCounters(state, NUM_FRAMES_PER_ROUND, num_allocations_at_start);
+}
+BENCHMARK(scanFilter)->Apply(frameOptionArguments);
+
+//! Complete processing of a scan round from the raw UDP data to the LaserScan.
+static void dataPath(benchmark::State& state)
+{
+  const auto raw_frames{ serialize(createScanRound(frameOptions(state))) };
+  const uint32_t num_frames_per_round{ NUM_FRAMES_PER_ROUND };
+
+  const uint64_t num_allocations_at_start{ numAllocations() };
+  for (auto _ : state)
+  {
+    protocol_layer::ScanBuffer scan_buffer{ num_frames_per_round };
+    int64_t timestamp{ 1000000000 };
+    for (const auto& raw_frame : raw_frames)
+    {
+      scan_buffer.add({ data_conversion_layer::monitoring_frame::deserialize(raw_frame, raw_frame.size()), timestamp });
+      timestamp += TIME_PER_FRAME_IN_NS;
+    }
+    benchmark::DoNotOptimize(data_conversion_layer::LaserScanConverter::toLaserScan(scan_buffer.currentRound()));
+  }
+  setFrameCounters(state, raw_frames.size(), num_allocations_at_start);
+}
+BENCHMARK(dataPath)->Apply(frameOptionArguments);
+
+//! Complete processing of recorded scan rounds by the state machine, replayed as fast as possible.
+static void protocolReplay(benchmark::State& state)
+{
+  static constexpr uint32_t NUM_ROUNDS{ 100 };
+  const FrameOptions options{ frameOptions(state) };
+
+  std::string file_path;
+  {
+    communication_layer::FrameRecorder recorder("benchmark_data_path", std::numeric_limits<uint32_t>::max(), 1);
+    file_path = data_conversion_layer::frame_recording::fileName(recorder.recordingPrefix(), 0);
+    int64_t timestamp{ 1000000000 };
+    for (uint32_t round = 0; round < NUM_ROUNDS; ++round)
+    {
+      for (const auto& raw_frame : serialize(createScanRound(options, round)))
+      {
+        recorder.record(raw_frame, raw_frame.size(), timestamp);
+        timestamp += TIME_PER_FRAME_IN_NS;
+      }
+    }
+  }
+
+  // The intensities of the configuration only change the start request, which is not sent to a scanner.
+  const ScannerConfiguration config{ ScannerConfigurationBuilder("127.0.0.1")
+                                         .scanRange(ScanRange{ util::TenthOfDegree(1), util::TenthOfDegree(2749) })
+                                         .scanResolution(options.resolution) };
+  ScannerReplay scanner_replay(config, [](const LaserScan& scan) { benchmark::DoNotOptimize(scan); });
+
+  uint64_t num_frames{ 0 };
+  const uint64_t num_allocations_at_start{ numAllocations() };
+  for (auto _ : state)
+  {
+    num_frames = scanner_replay.replay({ file_path }, REPLAY_AS_FAST_AS_POSSIBLE).num_frames;
+  }
+  setFrameCounters(state, num_frames, num_allocations_at_start);
+  std::remove(file_path.c_str());
+}
+BENCHMARK(protocolReplay)->Apply(frameOptionArguments)->Unit(benchmark::kMillisecond);
+
+static const std::string SCAN_LOG_FILE_PATH{ "benchmark_data_path.psenlog" };
+static constexpr uint32_t NUM_LOGGED_SCANS{ 1000 };
+
+//! Writes NUM_LOGGED_SCANS copies of a scan round with increasing scan counters and timestamps.
+static std::size_t writeScanLog(const FrameOptions& options)
+{
+  const auto scan{ data_conversion_layer::LaserScanConverter::toLaserScan(stamp(createScanRound(options))) };
+  data_conversion_layer::scan_log::Writer writer(SCAN_LOG_FILE_PATH);
+  for (uint32_t i = 0; i < NUM_LOGGED_SCANS; ++i)
+  {
+    LaserScan logged_scan(scan.scanResolution(),
+                          scan.minScanAngle(),
+                          scan.maxScanAngle(),
+                          i,
+                          scan.activeZoneset(),
+                          scan.timestamp() + static_cast<int64_t>(i * NUM_FRAMES_PER_ROUND) * TIME_PER_FRAME_IN_NS);
+    logged_scan.measurements(scan.measurements());
+    logged_scan.intensities(scan.intensities());
+    logged_scan.ioStates(scan.ioStates());
+    writer.write(logged_scan);
+  }
+  writer.close();
+  return writer.numBytesWritten();
+}
+
+//! The random distances and intensities of the benchmark data are the worst case for the compression.
+static void scanLogWrite(benchmark::State& state)
+{
+  const FrameOptions options{ frameOptions(state) };
+  std::size_t num_bytes{ 0 };
+
+  const uint64_t num_allocations_at_start{ numAllocations() };
+  for (auto _ : state)
+  {
+    num_bytes = writeScanLog(options);
+  }
+  setFrameCounters(state, NUM_LOGGED_SCANS * NUM_FRAMES_PER_ROUND, num_allocations_at_start);
+  state.counters["bytes/scan"] = static_cast<double>(num_bytes) / NUM_LOGGED_SCANS;
+  std::remove(SCAN_LOG_FILE_PATH.c_str());
+}
+BENCHMARK(scanLogWrite)->Apply(frameOptionArguments)->Unit(benchmark::kMillisecond);
+
+static void scanLogRead(benchmark::State& state)
+{
+  writeScanLog(frameOptions(state));
+  data_conversion_layer::scan_log::Reader reader(SCAN_LOG_FILE_PATH);
+
+  const uint64_t num_allocations_at_start{ numAllocations() };
+  for (auto _ : state)
+  {
+    reader.rewind();
+    while (const auto scan = reader.read())
+    {
+      benchmark::DoNotOptimize(scan);
+    }
+  }
+  setFrameCounters(state, NUM_LOGGED_SCANS * NUM_FRAMES_PER_ROUND, num_allocations_at_start);
+  std::remove(SCAN_LOG_FILE_PATH.c_str());
+}
+BENCHMARK(scanLogRead)->Apply(frameOptionArguments)->Unit(benchmark::kMillisecond);
+
+//! Seeks to the middle of the log and reads a single scan.
+static void scanLogSeek(benchmark::State& state)
+{
+  writeScanLog(frameOptions(state));
+  data_conversion_layer::scan_log::Reader reader(SCAN_LOG_FILE_PATH);
+  const int64_t timestamp{ (reader.firstTimestamp() + reader.lastTimestamp()) / 2 };
+
+  const uint64_t num_allocations_at_start{ numAllocations() };
+  for (auto _ : state)
+  {
+    reader.seek(timestamp);
+    benchmark::DoNotOptimize(reader.read());
+  }
+  setFrameCounters(state, NUM_FRAMES_PER_ROUND, num_allocations_at_start);
+  std::remove(SCAN_LOG_FILE_PATH.c_str());
+}
+BENCHMARK(scanLogSeek)->Apply(frameOptionArguments);
+
+static std::vector<IOState> createIOStates()
+{
+  auto pin_data{ psen_scan_v2_standalone_test::createPinData() };
+  const IOState first_state{ pin_data, 0 };
+  psen_scan_v2_standalone_test::setInputBit(pin_data, 3);
+  psen_scan_v2_standalone_test::setOutputBit(pin_data, 1);
+  return { first_state, IOState(pin_data, TIME_PER_FRAME_IN_NS) };
+}
+
+static void ioStateChangedPins(benchmark::State& state)
+{
+  const auto io_states{ createIOStates() };
+
+  const uint64_t num_allocations_at_start{ numAllocations() };
+  for (auto _ : state)
+  {
+    for (const auto& pin : io_states[1].changedInputPins(io_states[0]))
+    {
+      benchmark::DoNotOptimize(pin);
+    }
+    for (const auto& pin : io_states[1].changedOutputPins(io_states[0]))
+    {
+      benchmark::DoNotOptimize(pin);
+    }
+  }
+  setFrameCounters(state, 1, num_allocations_at_start);
+}
+BENCHMARK(ioStateChangedPins);
+
+static void ioStateChangedStates(benchmark::State& state)
+{
+  const auto io_states{ createIOStates() };
+
+  const uint64_t num_allocations_at_start{ numAllocations() };
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(io_states[1].changedInputStates(io_states[0]));
+    benchmark::DoNotOptimize(io_states[1].changedOutputStates(io_states[0]));
+  }
+  setFrameCounters(state, 1, num_allocations_at_start);
+}
+BENCHMARK(ioStateChangedStates);
+
+}  // namespace psen_scan_v2_standalone_benchmarks
+
+int main(int argc, char** argv)
+{
+  // Debug messages of the data path would otherwise dominate the measurements.
+  console_bridge::setLogLevel(console_bridge::CONSOLE_BRIDGE_LOG_WARN);
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+  {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,32 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_BENCHMARKS_ALLOCATION_COUNTER_H
+#define PSEN_SCAN_V2_STANDALONE_BENCHMARKS_ALLOCATION_COUNTER_H
+
+#include <cstdint>
+
+namespace psen_scan_v2_standalone_benchmarks
+{
+/**
+ * @brief Number of calls to the global operator new since the start of the program.
+ *
+ * Only available in executables linking allocation_counter.cpp, which replaces the global operator new.
+ */
+uint64_t numAllocations();
+
+}  // namespace psen_scan_v2_standalone_benchmarks
+
+#endif  // PSEN_SCAN_V2_STANDALONE_BENCHMARKS_ALLOCATION_COUNTER_H
@@ -0,0 +1,64 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_BENCHMARKS_BENCHMARK_HELPER_H
+#define PSEN_SCAN_V2_STANDALONE_BENCHMARKS_BENCHMARK_HELPER_H
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "psen_scan_v2_standalone/benchmarks/allocation_counter.h"
+#include "psen_scan_v2_standalone/benchmarks/scan_round.h"
+
+namespace psen_scan_v2_standalone_benchmarks
+{
+/**
+ * @brief Reads the options of the generated monitoring frames from the benchmark arguments, which are passed in this
+ * order: resolution in tenth of degree, intensities (0/1), diagnostics (0/1).
+ */
+inline FrameOptions frameOptions(const benchmark::State& state)
+{
+  return FrameOptions(
+      util::TenthOfDegree(static_cast<int16_t>(state.range(0))), state.range(1) != 0, state.range(2) != 0);
+}
+
+//! @brief Registers the argument combinations used for all benchmarks of the monitoring frame processing.
+inline void frameOptionArguments(benchmark::internal::Benchmark* benchmark)
+{
+  benchmark->ArgNames({ "resolution", "intensities", "diagnostics" })
+      ->ArgsProduct({ { 1, 2, 10 }, { 0, 1 }, { 0, 1 } });
+}
+
+/**
+ * @brief Reports the frame rate, the time per frame and the allocations per frame of the finished benchmark loop.
+ *
+ * @param num_allocations_at_start Result of numAllocations() before the benchmark loop.
+ */
+inline void setFrameCounters(benchmark::State& state,
+                             const std::size_t& frames_per_iteration,
+                             const uint64_t& num_allocations_at_start)
+{
+  const auto num_frames = static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(frames_per_iteration);
+  state.counters["frames/s"] = benchmark::Counter(static_cast<double>(num_frames), benchmark::Counter::kIsRate);
+  state.counters["s/frame"] = benchmark::Counter(static_cast<double>(num_frames),
+                                                 benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+  state.counters["allocs/frame"] =
+      num_frames == 0 ? 0. : static_cast<double>(numAllocations() - num_allocations_at_start) / num_frames;
+}
+
+}  // namespace psen_scan_v2_standalone_benchmarks
+
+#endif  // PSEN_SCAN_V2_STANDALONE_BENCHMARKS_BENCHMARK_HELPER_H
@@ -0,0 +1,135 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_BENCHMARKS_SCAN_ROUND_H
+#define PSEN_SCAN_V2_STANDALONE_BENCHMARKS_SCAN_ROUND_H
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "psen_scan_v2_standalone/configuration/scanner_ids.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/diagnostics.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg_builder.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/raw_scanner_data.h"
+#include "psen_scan_v2_standalone/util/tenth_of_degree.h"
+
+#include "psen_scan_v2_standalone/data_conversion_layer/io_pin_data_helper.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_serialization.h"
+
+namespace psen_scan_v2_standalone_benchmarks
+{
+using namespace psen_scan_v2_standalone;
+
+//! Number of monitoring frames the scanner sends per scan round.
+static constexpr std::size_t NUM_FRAMES_PER_ROUND{ 6 };
+//! Complete measurement range of the scanner (275 degree).
+static constexpr int SCAN_RANGE_IN_TENTH_OF_DEGREE{ 2750 };
+static constexpr int64_t TIME_PER_FRAME_IN_NS{ 30000000 / NUM_FRAMES_PER_ROUND };
+
+//! @brief Options of the generated monitoring frames.
+struct FrameOptions
+{
+  FrameOptions(const util::TenthOfDegree& resolution, const bool intensities, const bool diagnostics)
+    : resolution(resolution), intensities(intensities), diagnostics(diagnostics)
+  {
+  }
+
+  util::TenthOfDegree resolution;
+  bool intensities;
+  bool diagnostics;
+};
+
+/**
+ * @brief Creates the frames of a complete scan round as sent by the scanner.
+ *
+ * The measurements are randomly generated with a fixed seed, so every run processes the same data.
+ */
+inline std::vector<data_conversion_layer::monitoring_frame::Message> createScanRound(const FrameOptions& options,
+                                                                                     const uint32_t scan_counter = 42)
+{
+  std::mt19937 generator{ 42 };
+  std::uniform_real_distribution<double> measurement_distribution{ 0., 10. };
+  std::uniform_real_distribution<double> intensity_distribution{ 0., 16383. };
+
+  const int num_samples = SCAN_RANGE_IN_TENTH_OF_DEGREE / options.resolution.value();
+  std::vector<data_conversion_layer::monitoring_frame::Message> frames;
+  int first_sample{ 0 };
+  for (std::size_t i = 0; i < NUM_FRAMES_PER_ROUND; ++i)
+  {
+    const int end_sample = num_samples * static_cast<int>(i + 1) / static_cast<int>(NUM_FRAMES_PER_ROUND);
+    const auto num_frame_samples = static_cast<std::size_t>(end_sample - first_sample);
+
+    std::vector<double> measurements(num_frame_samples);
+    for (auto& measurement : measurements)
+    {
+      measurement = std::round(measurement_distribution(generator) * 1000.) / 1000.;
+    }
+
+    data_conversion_layer::monitoring_frame::MessageBuilder builder;
+    builder.fromTheta(options.resolution * first_sample)
+        .resolution(options.resolution)
+        .scanCounter(scan_counter)
+        .activeZoneset(0)
+        .iOPinData(psen_scan_v2_standalone_test::createPinData())
+        .measurements(measurements);
+    if (options.intensities)
+    {
+      std::vector<double> intensities(num_frame_samples);
+      for (auto& intensity : intensities)
+      {
+        intensity = std::round(intensity_distribution(generator));
+      }
+      builder.intensities(intensities);
+    }
+    if (options.diagnostics)
+    {
+      builder.diagnosticMessages({ { configuration::ScannerId::master,
+                                     data_conversion_layer::monitoring_frame::diagnostic::ErrorLocation(1, 7) } });
+    }
+    frames.push_back(builder.build());
+    first_sample = end_sample;
+  }
+  return frames;
+}
+
+inline std::vector<data_conversion_layer::RawData>
+serialize(const std::vector<data_conversion_layer::monitoring_frame::Message>& frames)
+{
+  std::vector<data_conversion_layer::RawData> raw_frames;
+  for (const auto& frame : frames)
+  {
+    raw_frames.push_back(data_conversion_layer::monitoring_frame::serialize(frame));
+  }
+  return raw_frames;
+}
+
+inline std::vector<data_conversion_layer::monitoring_frame::MessageStamped>
+stamp(const std::vector<data_conversion_layer::monitoring_frame::Message>& frames, int64_t timestamp = 1000000000)
+{
+  std::vector<data_conversion_layer::monitoring_frame::MessageStamped> stamped_frames;
+  for (const auto& frame : frames)
+  {
+    stamped_frames.emplace_back(frame, timestamp);
+    timestamp += TIME_PER_FRAME_IN_NS;
+  }
+  return stamped_frames;
+}
+
+}  // namespace psen_scan_v2_standalone_benchmarks
+
+#endif  // PSEN_SCAN_V2_STANDALONE_BENCHMARKS_SCAN_ROUND_H
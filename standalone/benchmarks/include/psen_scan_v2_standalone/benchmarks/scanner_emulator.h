@@ -0,0 +1,136 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_BENCHMARKS_SCANNER_EMULATOR_H
+#define PSEN_SCAN_V2_STANDALONE_BENCHMARKS_SCANNER_EMULATOR_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <thread>
+
+#include <boost/asio.hpp>
+#include <boost/optional.hpp>
+
+#include "psen_scan_v2_standalone/data_conversion_layer/raw_scanner_data.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/scanner_reply_msg.h"
+
+#include "psen_scan_v2_standalone/benchmarks/scan_round.h"
+#include "psen_scan_v2_standalone/communication_layer/mock_udp_server.h"
+
+namespace psen_scan_v2_standalone_benchmarks
+{
+static constexpr std::chrono::nanoseconds DEFAULT_SCAN_PERIOD{ std::chrono::milliseconds(30) };
+
+//! @brief Traffic generated by a ScannerEmulator.
+struct EmulationOptions
+{
+  FrameOptions frame_options{ util::TenthOfDegree(1), false, false };
+  //! Time between the first frames of two consecutive scan rounds. The frames of a round are sent evenly spaced.
+  std::chrono::nanoseconds scan_period{ DEFAULT_SCAN_PERIOD };
+  //! Probability of a monitoring frame not to be sent at all.
+  double loss_probability{ 0. };
+  //! Probability of a monitoring frame to be held back and sent after the next frame.
+  double reorder_probability{ 0. };
+  //! Probability of a monitoring frame to be sent twice.
+  double duplication_probability{ 0. };
+  //! Seed of the random decisions, so a run with the same options produces the same traffic.
+  uint32_t seed{ 42 };
+  //! Called with the scan counter directly before the last frame of a scan round is sent, e.g. to take the send time.
+  std::function<void(const uint32_t&)> last_frame_callback;
+};
+
+//! @brief Counters of the traffic a ScannerEmulator produced since its construction.
+struct EmulationStatistics
+{
+  uint64_t num_rounds{ 0 };
+  //! Number of datagrams sent including duplicates.
+  uint64_t num_frames_sent{ 0 };
+  uint64_t num_frames_lost{ 0 };
+  uint64_t num_frames_reordered{ 0 };
+  uint64_t num_frames_duplicated{ 0 };
+  //! Number of frames which were sent later than one frame period after their schedule.
+  uint64_t num_frames_late{ 0 };
+};
+
+/**
+ * @brief Emulates a scanner on the loopback interface, which continuously streams complete scan rounds.
+ *
+ * The emulator answers start and stop requests like the scanner does. After a start request it sends the monitoring
+ * frames of one scan round after the other to the host IP and data port contained in the request, until a stop
+ * request is received. The sending can be impaired by randomly dropping, reordering and duplicating frames.
+ *
+ * In contrast to the ScannerMock, which is controlled step by step by a test, the emulator runs on its own and is
+ * meant for soak tests and for measuring drop rates of processes handling one or more scanners.
+ */
+class ScannerEmulator
+{
+public:
+  ScannerEmulator(const unsigned short control_port, const unsigned short data_port, const EmulationOptions& options);
+  ~ScannerEmulator();
+
+  ScannerEmulator(const ScannerEmulator&) = delete;
+  ScannerEmulator& operator=(const ScannerEmulator&) = delete;
+
+public:
+  bool isStreaming() const;
+  EmulationStatistics statistics() const;
+
+private:
+  using udp = boost::asio::ip::udp;
+
+  void handleControlMsg(const udp::endpoint& sender, const data_conversion_layer::RawData& data);
+  void handleStartRequest(const udp::endpoint& sender, const data_conversion_layer::RawData& data);
+  void handleStopRequest(const udp::endpoint& sender);
+  void sendReply(const udp::endpoint& receiver, const data_conversion_layer::scanner_reply::Message::Type& type);
+
+  void stream();
+  void sendRound(const std::chrono::steady_clock::time_point& round_start, const udp::endpoint& receiver);
+  void sendFrame(const udp::endpoint& receiver, const data_conversion_layer::RawData& frame);
+  bool draw(const double& probability);
+
+private:
+  const EmulationOptions options_;
+  std::mt19937 generator_;
+  std::uniform_real_distribution<double> distribution_{ 0., 1. };
+
+  uint32_t scan_counter_{ 0 };
+  boost::optional<data_conversion_layer::RawData> held_back_frame_;
+
+  std::atomic<uint64_t> num_rounds_{ 0 };
+  std::atomic<uint64_t> num_frames_sent_{ 0 };
+  std::atomic<uint64_t> num_frames_lost_{ 0 };
+  std::atomic<uint64_t> num_frames_reordered_{ 0 };
+  std::atomic<uint64_t> num_frames_duplicated_{ 0 };
+  std::atomic<uint64_t> num_frames_late_{ 0 };
+
+  //! Protects the fields below, which are shared between the control server thread and the streaming thread.
+  mutable std::mutex mutex_;
+  std::condition_variable cv_;
+  boost::optional<udp::endpoint> frame_receiver_;
+  bool terminated_{ false };
+
+  psen_scan_v2_standalone_test::MockUDPServer control_server_;
+  psen_scan_v2_standalone_test::MockUDPServer data_server_;
+  std::thread streaming_thread_;
+};
+
+}  // namespace psen_scan_v2_standalone_benchmarks
+
+#endif  // PSEN_SCAN_V2_STANDALONE_BENCHMARKS_SCANNER_EMULATOR_H
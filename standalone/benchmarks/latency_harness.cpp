@@ -0,0 +1,310 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "psen_scan_v2_standalone/configuration/default_parameters.h"
+#include "psen_scan_v2_standalone/laserscan.h"
+#include "psen_scan_v2_standalone/scan_range.h"
+#include "psen_scan_v2_standalone/scanner_config_builder.h"
+#include "psen_scan_v2_standalone/scanner_v2.h"
+#include "psen_scan_v2_standalone/util/hot_path_tracer.h"
+#include "psen_scan_v2_standalone/util/latency_histogram.h"
+#include "psen_scan_v2_standalone/util/logging.h"
+
+#include "psen_scan_v2_standalone/benchmarks/scanner_emulator.h"
+
+using namespace psen_scan_v2_standalone_benchmarks;
+using Clock = std::chrono::steady_clock;
+
+static const std::string USAGE{ R"(Measures the latency of a ScannerV2 receiving scan rounds from an emulated scanner.
+
+Usage: latency_harness [options]
+
+Options:
+  --period-ms=MS       Scan period in milliseconds (default: 30).
+  --resolution=TENTHS  Angle between two measurements in tenth of degree (default: 1).
+  --intensities        Send intensities.
+  --diagnostics        Send diagnostic messages.
+  --load-threads=N     Number of threads generating background CPU load (default: 0).
+  --warmup=SEC         Scans received in the first SEC seconds are not measured (default: 1).
+  --duration=SEC       Measurement duration in seconds (default: 10).
+  --help               Print this message.
+
+The emulated scanner takes the send time directly before the last frame of every scan round is sent. The latency
+from this point until the laser scan callback is called is reported together with the latency histograms of the
+ScannerV2 from the reception of the last frame until the return of the callback. The latter include the warmup.
+)" };
+
+struct HarnessOptions
+{
+  EmulationOptions emulation;
+  unsigned num_load_threads{ 0 };
+  std::chrono::seconds warmup{ 1 };
+  std::chrono::seconds duration{ 10 };
+};
+
+//! Number of scan rounds whose send times are kept. Scans arriving later than this many rounds are not measured.
+static constexpr std::size_t NUM_SEND_TIMES{ 64 };
+
+/**
+ * @brief Send times of the last scan rounds indexed by their scan counter.
+ *
+ * Written by the streaming thread of the emulated scanner and read by the thread calling the laser scan callback.
+ */
+class SendTimes
+{
+public:
+  void store(const uint32_t& scan_counter, const Clock::time_point& send_time)
+  {
+    Entry& entry{ entries_[scan_counter % NUM_SEND_TIMES] };
+    entry.send_time.store(send_time.time_since_epoch().count(), std::memory_order_relaxed);
+    entry.scan_counter.store(scan_counter, std::memory_order_release);
+  }
+
+  //! @returns false if the send time of the scan round is not (any longer) available.
+  bool load(const uint32_t& scan_counter, Clock::time_point& send_time) const
+  {
+    const Entry& entry{ entries_[scan_counter % NUM_SEND_TIMES] };
+    if (entry.scan_counter.load(std::memory_order_acquire) != scan_counter)
+    {
+      return false;
+    }
+    send_time = Clock::time_point(Clock::duration(entry.send_time.load(std::memory_order_relaxed)));
+    return true;
+  }
+
+private:
+  struct Entry
+  {
+    std::atomic<uint32_t> scan_counter{ UINT32_MAX };
+    std::atomic<Clock::rep> send_time{ 0 };
+  };
+  std::array<Entry, NUM_SEND_TIMES> entries_{};
+};
+
+//! @brief Keeps the specified number of threads busy during its lifetime.
+class BackgroundLoad
+{
+public:
+  explicit BackgroundLoad(const unsigned& num_threads)
+  {
+    for (unsigned i = 0; i < num_threads; ++i)
+    {
+      threads_.emplace_back([this]() {
+        volatile uint64_t work{ 0 };
+        while (!terminated_.load(std::memory_order_relaxed))
+        {
+          work = work + 1;
+        }
+      });
+    }
+  }
+
+  ~BackgroundLoad()
+  {
+    terminated_ = true;
+    for (auto& thread : threads_)
+    {
+      thread.join();
+    }
+  }
+
+private:
+  std::atomic_bool terminated_{ false };
+  std::vector<std::thread> threads_;
+};
+
+static HarnessOptions parseArguments(int argc, char** argv)
+{
+  HarnessOptions options;
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg{ argv[i] };
+    const auto separator{ arg.find('=') };
+    const std::string name{ arg.substr(0, separator) };
+    const std::string value{ separator == std::string::npos ? "" : arg.substr(separator + 1) };
+
+    if (name == "--period-ms")
+    {
+      const std::chrono::duration<double, std::milli> scan_period{ std::stod(value) };
+      options.emulation.scan_period = std::chrono::duration_cast<std::chrono::nanoseconds>(scan_period);
+    }
+    else if (name == "--resolution")
+    {
+      options.emulation.frame_options.resolution = util::TenthOfDegree(static_cast<int16_t>(std::stoi(value)));
+    }
+    else if (name == "--intensities")
+    {
+      options.emulation.frame_options.intensities = true;
+    }
+    else if (name == "--diagnostics")
+    {
+      options.emulation.frame_options.diagnostics = true;
+    }
+    else if (name == "--load-threads")
+    {
+      options.num_load_threads = static_cast<unsigned>(std::stoul(value));
+    }
+    else if (name == "--warmup")
+    {
+      options.warmup = std::chrono::seconds(std::stol(value));
+    }
+    else if (name == "--duration")
+    {
+      options.duration = std::chrono::seconds(std::stol(value));
+    }
+    else
+    {
+      throw std::invalid_argument("Unknown option " + arg);
+    }
+  }
+
+  if (options.emulation.scan_period.count() <= 0)
+  {
+    throw std::invalid_argument("The scan period has to be positive");
+  }
+  if (options.emulation.frame_options.resolution.value() <= 0)
+  {
+    throw std::invalid_argument("The resolution has to be positive");
+  }
+  if (options.duration.count() <= 0)
+  {
+    throw std::invalid_argument("The duration has to be positive");
+  }
+  return options;
+}
+
+static std::string formatLatency(const std::string& name, const util::LatencyHistogram::Summary& s)
+{
+  const auto in_us = [](const util::LatencyHistogram::Duration& duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+  };
+  return fmt::format("{:<26}{:>10}{:>10.1f}{:>10.1f}{:>10.1f}{:>10.1f}{:>10.1f}\n",
+                     name,
+                     s.count,
+                     in_us(s.p50),
+                     in_us(s.p99),
+                     in_us(s.p999),
+                     in_us(s.max),
+                     in_us(s.mean));
+}
+
+static void measure(HarnessOptions options)
+{
+  SendTimes send_times;
+  options.emulation.last_frame_callback = [&send_times](const uint32_t& scan_counter) {
+    send_times.store(scan_counter, Clock::now());
+  };
+  ScannerEmulator emulator(configuration::CONTROL_PORT_OF_SCANNER_DEVICE,
+                           configuration::DATA_PORT_OF_SCANNER_DEVICE,
+                           options.emulation);
+
+  std::atomic_bool measuring{ false };
+  std::atomic<uint64_t> num_unmatched_scans{ 0 };
+  util::LatencyHistogram send_to_callback;
+  const auto laser_scan_callback = [&](const LaserScan& scan) {
+    const auto callback_time{ Clock::now() };
+    if (!measuring)
+    {
+      return;
+    }
+    Clock::time_point send_time;
+    if (send_times.load(scan.scanCounter(), send_time))
+    {
+      send_to_callback.record(callback_time - send_time);
+    }
+    else
+    {
+      ++num_unmatched_scans;
+    }
+  };
+
+  const ScannerConfiguration config{ ScannerConfigurationBuilder(psen_scan_v2_standalone_test::MOCK_IP_ADDRESS)
+                                         .hostIP(psen_scan_v2_standalone_test::MOCK_IP_ADDRESS)
+                                         .scanRange(ScanRange{ util::TenthOfDegree(1), util::TenthOfDegree(2749) })
+                                         .scanResolution(options.emulation.frame_options.resolution)
+                                         .enableIntensities(options.emulation.frame_options.intensities)
+                                         .enableDiagnostics(options.emulation.frame_options.diagnostics)
+                                         .enableHotPathTracing(true) };
+  ScannerV2 scanner(config, laser_scan_callback);
+
+  {
+    const BackgroundLoad background_load{ options.num_load_threads };
+    scanner.start().get();
+    std::this_thread::sleep_for(options.warmup);
+    measuring = true;
+    std::this_thread::sleep_for(options.duration);
+    measuring = false;
+    scanner.stop().get();
+  }
+
+  const auto& tracer{ scanner.hotPathTracer() };
+  std::cout << fmt::format("{:<26}{:>10}{:>10}{:>10}{:>10}{:>10}{:>10}\n",
+                           "latency [us]",
+                           "count",
+                           "p50",
+                           "p99",
+                           "p99.9",
+                           "max",
+                           "mean")
+            << formatLatency("send -> callback", send_to_callback.summary())
+            << formatLatency("receive -> callback return", tracer.summary(util::HotPathTracer::Stage::total))
+            << fmt::format("\nScans without send time: {}\n\n", num_unmatched_scans.load()) << tracer.formatSummary();
+}
+
+int main(int argc, char** argv)
+{
+  HarnessOptions options;
+  try
+  {
+    for (int i = 1; i < argc; ++i)
+    {
+      if (std::string(argv[i]) == "--help")
+      {
+        std::cout << USAGE;
+        return 0;
+      }
+    }
+    options = parseArguments(argc, argv);
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Invalid arguments: " << e.what() << "\n\n" << USAGE;
+    return 1;
+  }
+
+  setLogLevel(CONSOLE_BRIDGE_LOG_WARN);
+  try
+  {
+    measure(options);
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Latency measurement failed: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,261 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "psen_scan_v2_standalone/configuration/default_parameters.h"
+
+#include "psen_scan_v2_standalone/benchmarks/scanner_emulator.h"
+
+using namespace psen_scan_v2_standalone_benchmarks;
+
+static const std::string USAGE{ R"(Emulates scanners on the loopback interface streaming complete scan rounds.
+
+Usage: load_generator [options]
+
+Options:
+  --scanners=N         Number of emulated scanners (default: 1).
+  --control-port=PORT  Control port of the first scanner. Scanner i uses PORT + i (default: 3000).
+  --data-port=PORT     Data port of the first scanner. Scanner i uses PORT + i (default: 2000).
+  --period-ms=MS       Scan period in milliseconds (default: 30).
+  --resolution=TENTHS  Angle between two measurements in tenth of degree (default: 1).
+  --intensities        Send intensities.
+  --diagnostics        Send diagnostic messages.
+  --loss=P             Probability of a monitoring frame to be dropped (default: 0).
+  --reorder=P          Probability of a monitoring frame to be sent after the next one (default: 0).
+  --duplicate=P        Probability of a monitoring frame to be sent twice (default: 0).
+  --seed=SEED          Seed of the random impairments. Scanner i uses SEED + i (default: 42).
+  --duration=SEC       Stop after SEC seconds. Runs until interrupted if 0 (default: 0).
+  --help               Print this message.
+
+The statistics of all scanners are printed every 10 seconds and on exit.
+The scanners start streaming when they receive a start request and stop on a stop request.
+)" };
+
+struct LoadGeneratorOptions
+{
+  unsigned num_scanners{ 1 };
+  unsigned short control_port{ psen_scan_v2_standalone::configuration::CONTROL_PORT_OF_SCANNER_DEVICE };
+  unsigned short data_port{ psen_scan_v2_standalone::configuration::DATA_PORT_OF_SCANNER_DEVICE };
+  std::chrono::seconds duration{ 0 };
+  EmulationOptions emulation;
+};
+
+static constexpr std::chrono::seconds REPORT_PERIOD{ 10 };
+
+static std::atomic_bool interrupted{ false };
+
+static double parseProbability(const std::string& value)
+{
+  const double probability{ std::stod(value) };
+  if (probability < 0. || probability > 1.)
+  {
+    throw std::invalid_argument("Probability " + value + " is not within [0, 1]");
+  }
+  return probability;
+}
+
+static unsigned short parsePort(const std::string& value)
+{
+  const int port{ std::stoi(value) };
+  if (port < 1 || port > 65535)
+  {
+    throw std::invalid_argument("Port " + value + " is not within [1, 65535]");
+  }
+  return static_cast<unsigned short>(port);
+}
+
+static LoadGeneratorOptions parseArguments(int argc, char** argv)
+{
+  LoadGeneratorOptions options;
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg{ argv[i] };
+    const auto separator{ arg.find('=') };
+    const std::string name{ arg.substr(0, separator) };
+    const std::string value{ separator == std::string::npos ? "" : arg.substr(separator + 1) };
+
+    if (name == "--scanners")
+    {
+      options.num_scanners = static_cast<unsigned>(std::stoul(value));
+    }
+    else if (name == "--control-port")
+    {
+      options.control_port = parsePort(value);
+    }
+    else if (name == "--data-port")
+    {
+      options.data_port = parsePort(value);
+    }
+    else if (name == "--period-ms")
+    {
+      const std::chrono::duration<double, std::milli> scan_period{ std::stod(value) };
+      options.emulation.scan_period = std::chrono::duration_cast<std::chrono::nanoseconds>(scan_period);
+    }
+    else if (name == "--resolution")
+    {
+      options.emulation.frame_options.resolution = util::TenthOfDegree(static_cast<int16_t>(std::stoi(value)));
+    }
+    else if (name == "--intensities")
+    {
+      options.emulation.frame_options.intensities = true;
+    }
+    else if (name == "--diagnostics")
+    {
+      options.emulation.frame_options.diagnostics = true;
+    }
+    else if (name == "--loss")
+    {
+      options.emulation.loss_probability = parseProbability(value);
+    }
+    else if (name == "--reorder")
+    {
+      options.emulation.reorder_probability = parseProbability(value);
+    }
+    else if (name == "--duplicate")
+    {
+      options.emulation.duplication_probability = parseProbability(value);
+    }
+    else if (name == "--seed")
+    {
+      options.emulation.seed = static_cast<uint32_t>(std::stoul(value));
+    }
+    else if (name == "--duration")
+    {
+      options.duration = std::chrono::seconds(std::stol(value));
+    }
+    else
+    {
+      throw std::invalid_argument("Unknown option " + arg);
+    }
+  }
+
+  if (options.num_scanners == 0)
+  {
+    throw std::invalid_argument("At least one scanner has to be emulated");
+  }
+  if (options.control_port + options.num_scanners - 1 > 65535 || options.data_port + options.num_scanners - 1 > 65535)
+  {
+    throw std::invalid_argument("The ports of the last scanner exceed 65535");
+  }
+  if (options.emulation.scan_period.count() <= 0)
+  {
+    throw std::invalid_argument("The scan period has to be positive");
+  }
+  if (options.emulation.frame_options.resolution.value() <= 0)
+  {
+    throw std::invalid_argument("The resolution has to be positive");
+  }
+  return options;
+}
+
+static void printStatistics(const std::vector<std::unique_ptr<ScannerEmulator>>& scanners,
+                            const LoadGeneratorOptions& options,
+                            const std::chrono::duration<double>& elapsed)
+{
+  std::cout << fmt::format("{:>7} {:>10} {:>10} {:>12} {:>10} {:>10} {:>10} {:>10} {:>10}\n",
+                           "scanner",
+                           "streaming",
+                           "rounds",
+                           "rounds/s",
+                           "sent",
+                           "lost",
+                           "reordered",
+                           "duplicated",
+                           "late");
+  for (std::size_t i = 0; i < scanners.size(); ++i)
+  {
+    const auto statistics{ scanners[i]->statistics() };
+    std::cout << fmt::format("{:>7} {:>10} {:>10} {:>12.2f} {:>10} {:>10} {:>10} {:>10} {:>10}\n",
+                             options.control_port + i,
+                             scanners[i]->isStreaming() ? "yes" : "no",
+                             statistics.num_rounds,
+                             statistics.num_rounds / elapsed.count(),
+                             statistics.num_frames_sent,
+                             statistics.num_frames_lost,
+                             statistics.num_frames_reordered,
+                             statistics.num_frames_duplicated,
+                             statistics.num_frames_late);
+  }
+  std::cout << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  LoadGeneratorOptions options;
+  try
+  {
+    for (int i = 1; i < argc; ++i)
+    {
+      if (std::string(argv[i]) == "--help")
+      {
+        std::cout << USAGE;
+        return 0;
+      }
+    }
+    options = parseArguments(argc, argv);
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Invalid arguments: " << e.what() << "\n\n" << USAGE;
+    return 1;
+  }
+
+  std::vector<std::unique_ptr<ScannerEmulator>> scanners;
+  for (unsigned i = 0; i < options.num_scanners; ++i)
+  {
+    EmulationOptions emulation{ options.emulation };
+    emulation.seed += i;
+    scanners.emplace_back(new ScannerEmulator(static_cast<unsigned short>(options.control_port + i),
+                                              static_cast<unsigned short>(options.data_port + i),
+                                              emulation));
+  }
+  std::cout << fmt::format("Emulating {} scanner(s) on control ports {}-{} and data ports {}-{}.\n",
+                           options.num_scanners,
+                           options.control_port,
+                           options.control_port + options.num_scanners - 1,
+                           options.data_port,
+                           options.data_port + options.num_scanners - 1)
+            << std::endl;
+
+  std::signal(SIGINT, [](int) { interrupted = true; });
+  std::signal(SIGTERM, [](int) { interrupted = true; });
+
+  const auto start{ std::chrono::steady_clock::now() };
+  auto next_report{ start + REPORT_PERIOD };
+  while (!interrupted && (options.duration.count() == 0 || std::chrono::steady_clock::now() - start < options.duration))
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    if (std::chrono::steady_clock::now() >= next_report)
+    {
+      printStatistics(scanners, options, std::chrono::steady_clock::now() - start);
+      next_report += REPORT_PERIOD;
+    }
+  }
+
+  printStatistics(scanners, options, std::chrono::steady_clock::now() - start);
+  return 0;
+}
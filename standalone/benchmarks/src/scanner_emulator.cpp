@@ -0,0 +1,225 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "psen_scan_v2_standalone/benchmarks/scanner_emulator.h"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "psen_scan_v2_standalone/data_conversion_layer/raw_processing.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/scanner_reply_serialization_deserialization.h"
+
+namespace psen_scan_v2_standalone_benchmarks
+{
+using namespace std::placeholders;
+using ReplyMsg = data_conversion_layer::scanner_reply::Message;
+
+//! Offsets of the fields read from the start and stop requests (see start_request::serialize()).
+static constexpr std::size_t OPCODE_OFFSET{ 16 };
+static constexpr std::size_t HOST_IP_OFFSET{ 20 };
+static constexpr std::size_t HOST_DATA_PORT_OFFSET{ 24 };
+
+template <typename T>
+static T readField(const data_conversion_layer::RawData& data, const std::size_t& offset)
+{
+  std::istringstream is(std::string(data.cbegin(), data.cend()));
+  is.seekg(static_cast<std::streamoff>(offset));
+  return data_conversion_layer::raw_processing::read<T>(is);
+}
+
+ScannerEmulator::ScannerEmulator(const unsigned short control_port,
+                                 const unsigned short data_port,
+                                 const EmulationOptions& options)
+  : options_(options)
+  , generator_(options.seed)
+  , control_server_(control_port, std::bind(&ScannerEmulator::handleControlMsg, this, _1, _2))
+  , data_server_(data_port, [](const udp::endpoint&, const data_conversion_layer::RawData&) {})
+  , streaming_thread_([this]() { stream(); })
+{
+  control_server_.asyncReceive(psen_scan_v2_standalone_test::MockUDPServer::ReceiveMode::continuous);
+}
+
+ScannerEmulator::~ScannerEmulator()
+{
+  {
+    std::lock_guard<std::mutex> lk(mutex_);
+    terminated_ = true;
+  }
+  cv_.notify_all();
+  streaming_thread_.join();
+}
+
+bool ScannerEmulator::isStreaming() const
+{
+  std::lock_guard<std::mutex> lk(mutex_);
+  return frame_receiver_.is_initialized();
+}
+
+EmulationStatistics ScannerEmulator::statistics() const
+{
+  EmulationStatistics statistics;
+  statistics.num_rounds = num_rounds_;
+  statistics.num_frames_sent = num_frames_sent_;
+  statistics.num_frames_lost = num_frames_lost_;
+  statistics.num_frames_reordered = num_frames_reordered_;
+  statistics.num_frames_duplicated = num_frames_duplicated_;
+  statistics.num_frames_late = num_frames_late_;
+  return statistics;
+}
+
+void ScannerEmulator::handleControlMsg(const udp::endpoint& sender, const data_conversion_layer::RawData& data)
+{
+  if (data.size() < OPCODE_OFFSET + sizeof(uint32_t))
+  {
+    std::cerr << "ScannerEmulator: Ignoring control message of size " << data.size() << std::endl;
+    return;
+  }
+
+  const auto opcode{ readField<uint32_t>(data, OPCODE_OFFSET) };
+  if (opcode == static_cast<uint32_t>(ReplyMsg::Type::start))
+  {
+    handleStartRequest(sender, data);
+  }
+  else if (opcode == static_cast<uint32_t>(ReplyMsg::Type::stop))
+  {
+    handleStopRequest(sender);
+  }
+  else
+  {
+    std::cerr << "ScannerEmulator: Ignoring control message with unknown opcode " << opcode << std::endl;
+  }
+}
+
+void ScannerEmulator::handleStartRequest(const udp::endpoint& sender, const data_conversion_layer::RawData& data)
+{
+  if (data.size() < HOST_DATA_PORT_OFFSET + sizeof(uint16_t))
+  {
+    std::cerr << "ScannerEmulator: Ignoring start request of size " << data.size() << std::endl;
+    return;
+  }
+
+  using boost::asio::ip::address_v4;
+  /**< Byte order: big endian, which is the order of address_v4::bytes_type */
+  const address_v4 host_ip{ readField<address_v4::bytes_type>(data, HOST_IP_OFFSET) };
+  const auto host_data_port{ readField<uint16_t>(data, HOST_DATA_PORT_OFFSET) };
+  {
+    std::lock_guard<std::mutex> lk(mutex_);
+    frame_receiver_ = udp::endpoint(host_ip, host_data_port);
+  }
+  sendReply(sender, ReplyMsg::Type::start);
+  cv_.notify_all();
+}
+
+void ScannerEmulator::handleStopRequest(const udp::endpoint& sender)
+{
+  {
+    std::lock_guard<std::mutex> lk(mutex_);
+    frame_receiver_ = boost::none;
+  }
+  sendReply(sender, ReplyMsg::Type::stop);
+}
+
+void ScannerEmulator::sendReply(const udp::endpoint& receiver, const ReplyMsg::Type& type)
+{
+  control_server_.asyncSend(receiver,
+                            data_conversion_layer::scanner_reply::serialize(
+                                ReplyMsg(type, ReplyMsg::OperationResult::accepted)));
+}
+
+void ScannerEmulator::stream()
+{
+  std::unique_lock<std::mutex> lk(mutex_);
+  while (!terminated_)
+  {
+    cv_.wait(lk, [this]() { return terminated_ || frame_receiver_; });
+    // A frame held back before the last stop request is not sent after a restart.
+    held_back_frame_ = boost::none;
+
+    auto round_start{ std::chrono::steady_clock::now() };
+    while (!terminated_ && frame_receiver_)
+    {
+      const udp::endpoint receiver{ frame_receiver_.value() };
+      lk.unlock();
+      sendRound(round_start, receiver);
+      lk.lock();
+      round_start += options_.scan_period;
+    }
+  }
+}
+
+void ScannerEmulator::sendRound(const std::chrono::steady_clock::time_point& round_start,
+                                const udp::endpoint& receiver)
+{
+  const uint32_t scan_counter{ scan_counter_++ };
+  const auto frames{ serialize(createScanRound(options_.frame_options, scan_counter)) };
+  const auto frame_period{ options_.scan_period / static_cast<std::chrono::nanoseconds::rep>(frames.size()) };
+
+  auto deadline{ round_start };
+  for (std::size_t i = 0; i < frames.size(); ++i)
+  {
+    std::this_thread::sleep_until(deadline);
+    if (std::chrono::steady_clock::now() - deadline > frame_period)
+    {
+      ++num_frames_late_;
+    }
+    if (i == frames.size() - 1 && options_.last_frame_callback)
+    {
+      options_.last_frame_callback(scan_counter);
+    }
+    sendFrame(receiver, frames[i]);
+    deadline += frame_period;
+  }
+  ++num_rounds_;
+}
+
+void ScannerEmulator::sendFrame(const udp::endpoint& receiver, const data_conversion_layer::RawData& frame)
+{
+  if (draw(options_.loss_probability))
+  {
+    ++num_frames_lost_;
+    return;
+  }
+
+  if (!held_back_frame_ && draw(options_.reorder_probability))
+  {
+    held_back_frame_ = frame;
+    ++num_frames_reordered_;
+    return;
+  }
+
+  data_server_.send(receiver, frame);
+  ++num_frames_sent_;
+  if (draw(options_.duplication_probability))
+  {
+    data_server_.send(receiver, frame);
+    ++num_frames_sent_;
+    ++num_frames_duplicated_;
+  }
+
+  if (held_back_frame_)
+  {
+    data_server_.send(receiver, held_back_frame_.value());
+    ++num_frames_sent_;
+    held_back_frame_ = boost::none;
+  }
+}
+
+bool ScannerEmulator::draw(const double& probability)
+{
+  return probability > 0. && distribution_(generator_) < probability;
+}
+
+}  // namespace psen_scan_v2_standalone_benchmarks
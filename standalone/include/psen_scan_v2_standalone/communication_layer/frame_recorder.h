@@ -0,0 +1,379 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_FRAME_RECORDER_H
+#define PSEN_SCAN_V2_STANDALONE_FRAME_RECORDER_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <fmt/format.h>
+
+#include "psen_scan_v2_standalone/data_conversion_layer/frame_recording.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/raw_scanner_data.h"
+#include "psen_scan_v2_standalone/util/logging.h"
+
+namespace psen_scan_v2_standalone
+{
+namespace communication_layer
+{
+static constexpr std::size_t DEFAULT_FRAME_RECORDER_BUFFER_SIZE{ 4 * 1024 * 1024 };
+static constexpr std::chrono::milliseconds DEFAULT_FRAME_RECORDER_WRITE_PERIOD{ 10 };
+
+/**
+ * @brief Tees received datagrams into rotating recording files, which are written by a background thread.
+ *
+ * record() only copies the datagram into a preallocated ring buffer and never blocks, allocates or touches the
+ * file system. The background thread periodically appends the buffered datagrams to the current file. If a file
+ * would exceed the maximal file size, the next file is started and the oldest file of this recorder is deleted once
+ * there are more than the maximal number of files. If the buffer is full, the datagram is dropped and counted.
+ * If a file cannot be written, the recording is stopped and all datagrams which were not written are dropped.
+ *
+ * The files are named "<file_prefix>_<start time>_<index>.psenrec" with the start time of the recording in UTC, so
+ * former recordings with the same prefix are never overwritten.
+ *
+ * @note record() must only be called by one thread at a time.
+ * @see data_conversion_layer::frame_recording
+ */
+class FrameRecorder
+{
+public:
+  /**
+   * @param file_prefix Path and name of the recording files without index and extension.
+   * @param max_file_size Size in bytes after which the next file is started.
+   * @param max_num_files Maximal number of files kept by this recorder.
+   * @param buffer_size Size in bytes of the buffer between record() and the background thread.
+   * @param write_period Maximal time a datagram waits in the buffer before it is written to the file.
+   *
+   * @throws std::invalid_argument if any of the sizes is zero.
+   * @throws std::runtime_error if the first file cannot be created.
+   */
+  FrameRecorder(const std::string& file_prefix,
+                const std::size_t& max_file_size,
+                const std::size_t& max_num_files,
+                const std::size_t& buffer_size = DEFAULT_FRAME_RECORDER_BUFFER_SIZE,
+                const std::chrono::milliseconds& write_period = DEFAULT_FRAME_RECORDER_WRITE_PERIOD);
+  //! @brief Writes all buffered datagrams and closes the current file.
+  ~FrameRecorder();
+
+  FrameRecorder(const FrameRecorder&) = delete;
+  FrameRecorder& operator=(const FrameRecorder&) = delete;
+
+public:
+  void record(const data_conversion_layer::RawData& data, const std::size_t& num_bytes, const int64_t& timestamp);
+
+  //! @returns the prefix of the files of this recording, which is the file prefix extended by the start time.
+  const std::string& recordingPrefix() const;
+
+  //! @returns the number of datagrams written and flushed to the files.
+  uint64_t numRecordedFrames() const;
+  //! @returns the number of datagrams which were dropped because the buffer was full or a file could not be written.
+  uint64_t numDroppedFrames() const;
+
+private:
+  void run();
+  void writeBufferedFrames();
+  void writeRecord(const uint64_t& pos, const std::size_t& num_bytes);
+  bool openFile(const std::size_t& index);
+  bool flushFile();
+  void stopRecording();
+  void reportDroppedFrames();
+
+  void copyToBuffer(const uint64_t& pos, const char* data, const std::size_t& num_bytes);
+  void copyFromBuffer(const uint64_t& pos, char* data, const std::size_t& num_bytes) const;
+  bool writeFromBuffer(const uint64_t& pos, const std::size_t& num_bytes);
+
+  static std::string createRecordingPrefix(const std::string& file_prefix);
+
+private:
+  const std::string recording_prefix_;
+  const std::size_t max_file_size_;
+  const std::size_t max_num_files_;
+  const std::chrono::milliseconds write_period_;
+
+  const std::size_t buffer_size_;
+  std::unique_ptr<char[]> buffer_;
+  //! Total number of bytes ever written into the buffer. Only modified by the recording thread.
+  std::atomic<uint64_t> write_pos_{ 0 };
+  //! Total number of bytes ever read from the buffer. Only modified by the background thread.
+  std::atomic<uint64_t> read_pos_{ 0 };
+
+  std::atomic<uint64_t> num_recorded_frames_{ 0 };
+  std::atomic<uint64_t> num_dropped_frames_{ 0 };
+
+  //! The following members are only accessed by the background thread after construction.
+  std::FILE* file_{ nullptr };
+  std::size_t file_size_{ 0 };
+  std::size_t file_index_{ 0 };
+  //! Datagrams written to the current file, which are counted as recorded once they are flushed.
+  uint64_t num_unflushed_frames_{ 0 };
+  uint64_t reported_dropped_frames_{ 0 };
+
+  bool terminated_{ false };
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::thread thread_;
+};
+
+inline FrameRecorder::FrameRecorder(const std::string& file_prefix,
+                                    const std::size_t& max_file_size,
+                                    const std::size_t& max_num_files,
+                                    const std::size_t& buffer_size,
+                                    const std::chrono::milliseconds& write_period)
+  : recording_prefix_(createRecordingPrefix(file_prefix))
+  , max_file_size_(max_file_size)
+  , max_num_files_(max_num_files)
+  , write_period_(write_period)
+  , buffer_size_(buffer_size)
+  , buffer_(new char[buffer_size])
+{
+  if (max_file_size_ == 0 || max_num_files_ == 0 || buffer_size_ == 0)
+  {
+    throw std::invalid_argument("The sizes of a frame recording must be greater than zero.");
+  }
+  if (!openFile(file_index_))
+  {
+    throw std::runtime_error(fmt::format("Cannot create frame recording {}.",
+                                         data_conversion_layer::frame_recording::fileName(recording_prefix_, 0)));
+  }
+  PSENSCAN_INFO("FrameRecorder", "Recording monitoring frames to {}_*.psenrec", recording_prefix_);
+  thread_ = std::thread([this]() { run(); });
+}
+
+inline FrameRecorder::~FrameRecorder()
+{
+  {
+    std::lock_guard<std::mutex> lk(mutex_);
+    terminated_ = true;
+  }
+  cv_.notify_all();
+  thread_.join();
+  if (file_)
+  {
+    std::fclose(file_);
+  }
+}
+
+inline void FrameRecorder::record(const data_conversion_layer::RawData& data,
+                                  const std::size_t& num_bytes,
+                                  const int64_t& timestamp)
+{
+  const std::size_t record_size{ data_conversion_layer::frame_recording::RECORD_HEADER_SIZE + num_bytes };
+  const uint64_t write_pos{ write_pos_.load(std::memory_order_relaxed) };
+  if (num_bytes > data.size() || num_bytes > std::numeric_limits<uint32_t>::max() ||
+      write_pos + record_size - read_pos_.load(std::memory_order_acquire) > buffer_size_)
+  {
+    num_dropped_frames_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  const auto num_bytes_field{ static_cast<uint32_t>(num_bytes) };
+  copyToBuffer(write_pos, reinterpret_cast<const char*>(&timestamp), sizeof(timestamp));
+  copyToBuffer(write_pos + sizeof(timestamp), reinterpret_cast<const char*>(&num_bytes_field), sizeof(num_bytes_field));
+  copyToBuffer(write_pos + data_conversion_layer::frame_recording::RECORD_HEADER_SIZE, data.data(), num_bytes);
+  write_pos_.store(write_pos + record_size, std::memory_order_release);
+}
+
+inline const std::string& FrameRecorder::recordingPrefix() const
+{
+  return recording_prefix_;
+}
+
+inline uint64_t FrameRecorder::numRecordedFrames() const
+{
+  return num_recorded_frames_.load(std::memory_order_relaxed);
+}
+
+inline uint64_t FrameRecorder::numDroppedFrames() const
+{
+  return num_dropped_frames_.load(std::memory_order_relaxed);
+}
+
+inline void FrameRecorder::run()
+{
+  std::unique_lock<std::mutex> lk(mutex_);
+  while (!terminated_)
+  {
+    // record() does not notify to stay lock-free, therefore the buffer is written periodically.
+    cv_.wait_for(lk, write_period_);
+    lk.unlock();
+    writeBufferedFrames();
+    lk.lock();
+  }
+  lk.unlock();
+  writeBufferedFrames();
+}
+
+inline void FrameRecorder::writeBufferedFrames()
+{
+  using namespace data_conversion_layer::frame_recording;
+
+  const uint64_t write_pos{ write_pos_.load(std::memory_order_acquire) };
+  uint64_t read_pos{ read_pos_.load(std::memory_order_relaxed) };
+  while (read_pos != write_pos)
+  {
+    uint32_t num_bytes{ 0 };
+    copyFromBuffer(read_pos + sizeof(int64_t), reinterpret_cast<char*>(&num_bytes), sizeof(num_bytes));
+    writeRecord(read_pos, num_bytes);
+    read_pos += RECORD_HEADER_SIZE + num_bytes;
+    read_pos_.store(read_pos, std::memory_order_release);
+  }
+  if (file_)
+  {
+    flushFile();
+  }
+  reportDroppedFrames();
+}
+
+inline void FrameRecorder::writeRecord(const uint64_t& pos, const std::size_t& num_bytes)
+{
+  using namespace data_conversion_layer::frame_recording;
+
+  const std::size_t record_size{ RECORD_HEADER_SIZE + num_bytes };
+  if (file_ && file_size_ > FILE_HEADER_SIZE && file_size_ + record_size > max_file_size_ && flushFile())
+  {
+    std::fclose(file_);
+    file_ = nullptr;
+    ++file_index_;
+    if (file_index_ >= max_num_files_)
+    {
+      std::remove(fileName(recording_prefix_, file_index_ - max_num_files_).c_str());
+    }
+    if (!openFile(file_index_))
+    {
+      PSENSCAN_ERROR("FrameRecorder", "Cannot create {}. Stopped recording.", fileName(recording_prefix_, file_index_));
+    }
+  }
+
+  if (!file_)
+  {
+    num_dropped_frames_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  if (!writeFromBuffer(pos, record_size))
+  {
+    num_dropped_frames_.fetch_add(1, std::memory_order_relaxed);
+    stopRecording();
+    return;
+  }
+  file_size_ += record_size;
+  ++num_unflushed_frames_;
+}
+
+inline bool FrameRecorder::openFile(const std::size_t& index)
+{
+  using namespace data_conversion_layer::frame_recording;
+
+  file_ = std::fopen(fileName(recording_prefix_, index).c_str(), "wb");
+  if (!file_)
+  {
+    return false;
+  }
+  if (std::fwrite(MAGIC.data(), 1, MAGIC.size(), file_) != MAGIC.size() ||
+      std::fwrite(&VERSION, sizeof(VERSION), 1, file_) != 1)
+  {
+    std::fclose(file_);
+    file_ = nullptr;
+    return false;
+  }
+  file_size_ = FILE_HEADER_SIZE;
+  return true;
+}
+
+inline bool FrameRecorder::flushFile()
+{
+  if (std::fflush(file_) != 0)
+  {
+    stopRecording();
+    return false;
+  }
+  num_recorded_frames_.fetch_add(num_unflushed_frames_, std::memory_order_relaxed);
+  num_unflushed_frames_ = 0;
+  return true;
+}
+
+inline void FrameRecorder::stopRecording()
+{
+  PSENSCAN_ERROR("FrameRecorder",
+                 "Cannot write {}. Stopped recording.",
+                 data_conversion_layer::frame_recording::fileName(recording_prefix_, file_index_));
+  std::fclose(file_);
+  file_ = nullptr;
+  num_dropped_frames_.fetch_add(num_unflushed_frames_, std::memory_order_relaxed);
+  num_unflushed_frames_ = 0;
+}
+
+inline void FrameRecorder::reportDroppedFrames()
+{
+  const uint64_t dropped_frames{ numDroppedFrames() };
+  if (dropped_frames != reported_dropped_frames_)
+  {
+    PSENSCAN_WARN("FrameRecorder", "Dropped {} monitoring frames.", dropped_frames - reported_dropped_frames_);
+    reported_dropped_frames_ = dropped_frames;
+  }
+}
+
+inline void FrameRecorder::copyToBuffer(const uint64_t& pos, const char* data, const std::size_t& num_bytes)
+{
+  const std::size_t offset{ static_cast<std::size_t>(pos % buffer_size_) };
+  const std::size_t num_bytes_until_end{ std::min(num_bytes, buffer_size_ - offset) };
+  std::memcpy(buffer_.get() + offset, data, num_bytes_until_end);
+  std::memcpy(buffer_.get(), data + num_bytes_until_end, num_bytes - num_bytes_until_end);
+}
+
+inline void FrameRecorder::copyFromBuffer(const uint64_t& pos, char* data, const std::size_t& num_bytes) const
+{
+  const std::size_t offset{ static_cast<std::size_t>(pos % buffer_size_) };
+  const std::size_t num_bytes_until_end{ std::min(num_bytes, buffer_size_ - offset) };
+  std::memcpy(data, buffer_.get() + offset, num_bytes_until_end);
+  std::memcpy(data + num_bytes_until_end, buffer_.get(), num_bytes - num_bytes_until_end);
+}
+
+inline bool FrameRecorder::writeFromBuffer(const uint64_t& pos, const std::size_t& num_bytes)
+{
+  const std::size_t offset{ static_cast<std::size_t>(pos % buffer_size_) };
+  const std::size_t num_bytes_until_end{ std::min(num_bytes, buffer_size_ - offset) };
+  return std::fwrite(buffer_.get() + offset, 1, num_bytes_until_end, file_) == num_bytes_until_end &&
+         std::fwrite(buffer_.get(), 1, num_bytes - num_bytes_until_end, file_) == num_bytes - num_bytes_until_end;
+}
+
+inline std::string FrameRecorder::createRecordingPrefix(const std::string& file_prefix)
+{
+  const auto now{ std::chrono::system_clock::now() };
+  const std::time_t now_in_s{ std::chrono::system_clock::to_time_t(now) };
+  const auto ms{ std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count() % 1000 };
+  std::array<char, 32> start_time{};
+  std::strftime(start_time.data(), start_time.size(), "%Y%m%dT%H%M%S", std::gmtime(&now_in_s));
+  return fmt::format("{}_{}{:03d}", file_prefix, start_time.data(), ms);
+}
+
+}  // namespace communication_layer
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_FRAME_RECORDER_H
@@ -0,0 +1,145 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_SCAN_RING_H
+#define PSEN_SCAN_V2_STANDALONE_SCAN_RING_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "psen_scan_v2_standalone/data_conversion_layer/io_pin_data.h"
+
+namespace psen_scan_v2_standalone
+{
+namespace communication_layer
+{
+/**
+ * @brief Contains the layout of the shared memory segment used to pass laser scans to other processes.
+ *
+ * The segment starts with a Header followed by a ring of slots. Every slot consists of a SlotHeader, the distances
+ * and intensities (double) and the I/O states (IOStateRecord), each with the capacity stored in the Header.
+ * The scan with the publish index i is written into slot i % num_slots.
+ *
+ * Every slot is guarded by a seqlock: the sequence is odd while the publisher writes the slot. A reader copies the
+ * slot and only accepts the copy if the sequence was even and did not change in the meantime. Therefore the
+ * publisher never waits for readers and any number of readers can be attached.
+ *
+ * Publisher and readers have to be built for the same architecture.
+ *
+ * @see ScanRingPublisher
+ * @see ScanRingReader
+ */
+namespace scan_ring
+{
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_LONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2,
+              "Atomics in shared memory have to be lock free");
+
+static constexpr std::array<char, 8> MAGIC{ { 'P', 'S', 'E', 'N', 'S', 'H', 'M', '\0' } };
+static constexpr uint32_t VERSION{ 1 };
+static constexpr std::size_t ALIGNMENT{ 64 };
+
+static constexpr std::size_t DEFAULT_NUM_SLOTS{ 16 };
+//! Number of measurements of a complete scan with the maximal scan range and the finest resolution.
+static constexpr std::size_t DEFAULT_MAX_NUM_MEASUREMENTS{ 2750 };
+static constexpr std::size_t DEFAULT_MAX_NUM_IO_STATES{ 16 };
+static constexpr std::size_t NUM_PIN_BYTES{ data_conversion_layer::monitoring_frame::io::NUMBER_OF_INPUT_BYTES +
+                                            data_conversion_layer::monitoring_frame::io::NUMBER_OF_OUTPUT_BYTES };
+
+struct alignas(ALIGNMENT) Header
+{
+  std::array<char, 8> magic{};
+  uint32_t version{ 0 };
+  uint32_t num_slots{ 0 };
+  uint32_t max_num_measurements{ 0 };
+  uint32_t max_num_io_states{ 0 };
+  uint64_t slot_size{ 0 };
+  //! Number of published scans, i.e. the publish index of the next scan.
+  std::atomic<uint64_t> num_published{ 0 };
+  //! Set to 1 once the publisher is destroyed.
+  std::atomic<uint32_t> closed{ 0 };
+};
+
+struct ScanInfo
+{
+  uint64_t publish_index{ 0 };
+  int64_t timestamp{ 0 };
+  uint32_t scan_counter{ 0 };
+  int16_t resolution{ 0 };
+  int16_t min_scan_angle{ 0 };
+  int16_t max_scan_angle{ 0 };
+  uint8_t active_zoneset{ 0 };
+  uint32_t num_measurements{ 0 };
+  uint32_t num_intensities{ 0 };
+  uint32_t num_io_states{ 0 };
+};
+
+struct alignas(ALIGNMENT) SlotHeader
+{
+  //! Odd while the slot is written.
+  std::atomic<uint64_t> sequence{ 0 };
+  ScanInfo info;
+};
+
+struct IOStateRecord
+{
+  int64_t timestamp{ 0 };
+  std::array<uint8_t, NUM_PIN_BYTES> pin_data{};
+};
+
+inline std::size_t alignedSize(const std::size_t& size)
+{
+  return (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+}
+
+inline std::size_t slotSize(const std::size_t& max_num_measurements, const std::size_t& max_num_io_states)
+{
+  return alignedSize(sizeof(SlotHeader) + 2 * max_num_measurements * sizeof(double) +
+                     max_num_io_states * sizeof(IOStateRecord));
+}
+
+inline std::size_t segmentSize(const std::size_t& num_slots, const std::size_t& slot_size)
+{
+  return sizeof(Header) + num_slots * slot_size;
+}
+
+//! Pointers to the parts of a single slot.
+template <typename Byte>
+struct Slot
+{
+  Slot(Byte* segment, const Header& header, const uint64_t& publish_index)
+  {
+    Byte* slot{ segment + sizeof(Header) + (publish_index % header.num_slots) * header.slot_size };
+    this->header = reinterpret_cast<SlotHeaderType*>(slot);
+    measurements = slot + sizeof(SlotHeader);
+    intensities = measurements + header.max_num_measurements * sizeof(double);
+    io_states = intensities + header.max_num_measurements * sizeof(double);
+  }
+
+  using SlotHeaderType = typename std::conditional<std::is_const<Byte>::value, const SlotHeader, SlotHeader>::type;
+
+  SlotHeaderType* header;
+  Byte* measurements;
+  Byte* intensities;
+  Byte* io_states;
+};
+
+}  // namespace scan_ring
+}  // namespace communication_layer
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_SCAN_RING_H
@@ -0,0 +1,230 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_SCAN_RING_PUBLISHER_H
+#define PSEN_SCAN_V2_STANDALONE_SCAN_RING_PUBLISHER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/interprocess/shared_memory_object.hpp>
+
+#include <fmt/format.h>
+
+#include "psen_scan_v2_standalone/communication_layer/scan_ring.h"
+#include "psen_scan_v2_standalone/laserscan.h"
+#include "psen_scan_v2_standalone/util/logging.h"
+
+namespace psen_scan_v2_standalone
+{
+namespace communication_layer
+{
+/**
+ * @brief Publishes laser scans into a shared memory ring buffer, which can be read by any number of local processes.
+ *
+ * The shared memory object is created on construction, replacing a stale object of the same name, and removed on
+ * destruction. Readers which are attached at this time keep their mapping but are informed via
+ * ScanRingReader::publisherClosed().
+ *
+ * publish() only copies the scan into the next slot and never blocks or allocates.
+ *
+ * @note publish() must only be called by one thread at a time.
+ * @see scan_ring
+ * @see ScanRingReader
+ */
+class ScanRingPublisher
+{
+public:
+  /**
+   * @param name Name of the shared memory object, e.g. "psen_scan_front". On POSIX systems it appears in /dev/shm.
+   * @param num_slots Number of scans kept in the ring. Readers have to read a scan before it is overwritten.
+   * @param max_num_measurements Capacity of a slot for distances and intensities each.
+   * @param max_num_io_states Capacity of a slot for I/O states.
+   *
+   * @throws std::invalid_argument if the name is empty or any of the sizes is zero.
+   * @throws std::runtime_error if the shared memory object cannot be created.
+   */
+  ScanRingPublisher(const std::string& name,
+                    const std::size_t& num_slots = scan_ring::DEFAULT_NUM_SLOTS,
+                    const std::size_t& max_num_measurements = scan_ring::DEFAULT_MAX_NUM_MEASUREMENTS,
+                    const std::size_t& max_num_io_states = scan_ring::DEFAULT_MAX_NUM_IO_STATES);
+  ~ScanRingPublisher();
+  ScanRingPublisher(const ScanRingPublisher&) = delete;
+  ScanRingPublisher& operator=(const ScanRingPublisher&) = delete;
+
+public:
+  /**
+   * @returns false if the scan exceeds the capacity of a slot. The scan is not published in this case.
+   */
+  bool publish(const LaserScan& scan);
+
+  const std::string& name() const;
+  uint64_t numPublishedScans() const;
+  //! @returns the number of scans not published because they exceeded the capacity of a slot.
+  uint64_t numRejectedScans() const;
+
+private:
+  const std::string name_;
+  boost::interprocess::shared_memory_object shm_;
+  boost::interprocess::mapped_region region_;
+  char* segment_{ nullptr };
+  scan_ring::Header* header_{ nullptr };
+  std::atomic<uint64_t> num_rejected_scans_{ 0 };
+};
+
+inline ScanRingPublisher::ScanRingPublisher(const std::string& name,
+                                            const std::size_t& num_slots,
+                                            const std::size_t& max_num_measurements,
+                                            const std::size_t& max_num_io_states)
+  : name_(name)
+{
+  if (name.empty())
+  {
+    throw std::invalid_argument("The name of the shared memory object must not be empty.");
+  }
+  if (num_slots == 0 || max_num_measurements == 0 || max_num_io_states == 0)
+  {
+    throw std::invalid_argument("The number of slots and their capacities must not be zero.");
+  }
+  if (num_slots > std::numeric_limits<uint32_t>::max() ||
+      max_num_measurements > std::numeric_limits<uint32_t>::max() ||
+      max_num_io_states > std::numeric_limits<uint32_t>::max())
+  {
+    throw std::invalid_argument("The number of slots and their capacities must fit into 32 bit.");
+  }
+
+  const std::size_t slot_size{ scan_ring::slotSize(max_num_measurements, max_num_io_states) };
+  try
+  {
+    boost::interprocess::shared_memory_object::remove(name.c_str());
+    shm_ = boost::interprocess::shared_memory_object(
+        boost::interprocess::create_only, name.c_str(), boost::interprocess::read_write);
+    shm_.truncate(static_cast<boost::interprocess::offset_t>(scan_ring::segmentSize(num_slots, slot_size)));
+    region_ = boost::interprocess::mapped_region(shm_, boost::interprocess::read_write);
+  }
+  catch (const boost::interprocess::interprocess_exception& e)
+  {
+    throw std::runtime_error(fmt::format("Cannot create shared memory object {}: {}", name, e.what()));
+  }
+
+  segment_ = static_cast<char*>(region_.get_address());
+  for (std::size_t i = 0; i < num_slots; ++i)
+  {
+    new (segment_ + sizeof(scan_ring::Header) + i * slot_size) scan_ring::SlotHeader();
+  }
+  header_ = new (segment_) scan_ring::Header();
+  header_->num_slots = static_cast<uint32_t>(num_slots);
+  header_->max_num_measurements = static_cast<uint32_t>(max_num_measurements);
+  header_->max_num_io_states = static_cast<uint32_t>(max_num_io_states);
+  header_->slot_size = slot_size;
+  header_->version = scan_ring::VERSION;
+  // The magic is written last, so readers attaching during the construction reject the segment.
+  std::atomic_thread_fence(std::memory_order_release);
+  std::memcpy(header_->magic.data(), scan_ring::MAGIC.data(), scan_ring::MAGIC.size());
+}
+
+inline ScanRingPublisher::~ScanRingPublisher()
+{
+  header_->closed.store(1, std::memory_order_release);
+  boost::interprocess::shared_memory_object::remove(name_.c_str());
+}
+
+inline bool ScanRingPublisher::publish(const LaserScan& scan)
+{
+  if (scan.measurements().size() > header_->max_num_measurements ||
+      scan.intensities().size() > header_->max_num_measurements ||
+      scan.ioStates().size() > header_->max_num_io_states)
+  {
+    ++num_rejected_scans_;
+    PSENSCAN_WARN_THROTTLE(1.0,
+                           "ScanRingPublisher",
+                           "Scan with {} measurements and {} I/O states exceeds the capacity of {}.",
+                           scan.measurements().size(),
+                           scan.ioStates().size(),
+                           name_);
+    return false;
+  }
+
+  const uint64_t publish_index{ header_->num_published.load(std::memory_order_relaxed) };
+  scan_ring::Slot<char> slot(segment_, *header_, publish_index);
+  const uint64_t sequence{ slot.header->sequence.load(std::memory_order_relaxed) };
+  slot.header->sequence.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  scan_ring::ScanInfo& info{ slot.header->info };
+  info.publish_index = publish_index;
+  info.timestamp = scan.timestamp();
+  info.scan_counter = scan.scanCounter();
+  info.resolution = scan.scanResolution().value();
+  info.min_scan_angle = scan.minScanAngle().value();
+  info.max_scan_angle = scan.maxScanAngle().value();
+  info.active_zoneset = scan.activeZoneset();
+  info.num_measurements = static_cast<uint32_t>(scan.measurements().size());
+  info.num_intensities = static_cast<uint32_t>(scan.intensities().size());
+  info.num_io_states = static_cast<uint32_t>(scan.ioStates().size());
+  std::copy(scan.measurements().begin(), scan.measurements().end(), reinterpret_cast<double*>(slot.measurements));
+  std::copy(scan.intensities().begin(), scan.intensities().end(), reinterpret_cast<double*>(slot.intensities));
+
+  char* io_state_record{ slot.io_states };
+  for (const auto& io_state : scan.ioStates())
+  {
+    scan_ring::IOStateRecord record;
+    record.timestamp = io_state.timestamp();
+    auto pin_byte{ record.pin_data.begin() };
+    for (const auto& byte : io_state.pinData().input_state)
+    {
+      *pin_byte++ = static_cast<uint8_t>(byte.to_ulong());
+    }
+    for (const auto& byte : io_state.pinData().output_state)
+    {
+      *pin_byte++ = static_cast<uint8_t>(byte.to_ulong());
+    }
+    std::memcpy(io_state_record, &record, sizeof(record));
+    io_state_record += sizeof(record);
+  }
+
+  slot.header->sequence.store(sequence + 2, std::memory_order_release);
+  header_->num_published.store(publish_index + 1, std::memory_order_release);
+  return true;
+}
+
+inline const std::string& ScanRingPublisher::name() const
+{
+  return name_;
+}
+
+inline uint64_t ScanRingPublisher::numPublishedScans() const
+{
+  return header_->num_published.load(std::memory_order_relaxed);
+}
+
+inline uint64_t ScanRingPublisher::numRejectedScans() const
+{
+  return num_rejected_scans_.load(std::memory_order_relaxed);
+}
+
+}  // namespace communication_layer
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_SCAN_RING_PUBLISHER_H
@@ -0,0 +1,271 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_SCAN_RING_READER_H
+#define PSEN_SCAN_V2_STANDALONE_SCAN_RING_READER_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/interprocess/shared_memory_object.hpp>
+#include <boost/optional.hpp>
+
+#include <fmt/format.h>
+
+#include "psen_scan_v2_standalone/communication_layer/scan_ring.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/io_pin_data.h"
+#include "psen_scan_v2_standalone/io_state.h"
+#include "psen_scan_v2_standalone/laserscan.h"
+#include "psen_scan_v2_standalone/util/tenth_of_degree.h"
+
+namespace psen_scan_v2_standalone
+{
+namespace communication_layer
+{
+//! Time a reader waits for a slot to be written before it gives up, e.g. because the publisher died.
+static constexpr std::chrono::milliseconds MAX_SCAN_RING_WRITE_DURATION{ 100 };
+
+/**
+ * @brief Reads the laser scans published by a ScanRingPublisher of another (or the same) process.
+ *
+ * The reader maps the shared memory object read-only, so it cannot disturb the publisher or other readers. The scans
+ * are copied out of the shared memory without any serialization. Reading is not zero-copy: every read scan is a new
+ * LaserScan, which allocates its measurement, intensity and I/O state data.
+ *
+ * Writing a slot only takes microseconds. A reader which finds a slot written for longer than
+ * MAX_SCAN_RING_WRITE_DURATION, i.e. several scan periods of 30ms, assumes that the publisher died while writing it and
+ * skips the scan. A publisher which is suspended for that long therefore causes missed scans.
+ *
+ * @note A reader must only be used by one thread at a time.
+ * @see scan_ring
+ * @see ScanRingPublisher
+ */
+class ScanRingReader
+{
+public:
+  //! @throws std::runtime_error if there is no valid shared memory object with the specified name.
+  explicit ScanRingReader(const std::string& name);
+
+public:
+  /**
+   * @returns the newest published scan or boost::none if no scan was published yet or the newest scan cannot be
+   * read, because the publisher died while writing it.
+   */
+  boost::optional<LaserScan> readLatest();
+  /**
+   * @returns the next scan in publish order or boost::none if there is no new scan.
+   *
+   * Starts with the first scan published after the creation of the reader. Scans which were overwritten before
+   * they were read or which cannot be read, because the publisher died while writing them, are skipped and counted
+   * by numMissedScans().
+   */
+  boost::optional<LaserScan> readNext();
+  //! @returns the number of scans skipped by readNext() because they were overwritten or could not be read.
+  uint64_t numMissedScans() const;
+  //! @returns true if the publisher was destroyed. A new publisher is only visible to a new reader.
+  bool publisherClosed() const;
+
+private:
+  /**
+   * @returns boost::none if the scan was overwritten or its slot is written by a closed publisher or for longer than
+   * MAX_SCAN_RING_WRITE_DURATION.
+   */
+  boost::optional<LaserScan> read(const uint64_t& publish_index) const;
+
+private:
+  const std::string name_;
+  boost::interprocess::shared_memory_object shm_;
+  boost::interprocess::mapped_region region_;
+  const char* segment_{ nullptr };
+  const scan_ring::Header* header_{ nullptr };
+  uint64_t next_index_{ 0 };
+  uint64_t num_missed_scans_{ 0 };
+};
+
+inline ScanRingReader::ScanRingReader(const std::string& name) : name_(name)
+{
+  try
+  {
+    shm_ = boost::interprocess::shared_memory_object(
+        boost::interprocess::open_only, name.c_str(), boost::interprocess::read_only);
+    region_ = boost::interprocess::mapped_region(shm_, boost::interprocess::read_only);
+  }
+  catch (const boost::interprocess::interprocess_exception& e)
+  {
+    throw std::runtime_error(fmt::format("Cannot open shared memory object {}: {}", name, e.what()));
+  }
+
+  segment_ = static_cast<const char*>(region_.get_address());
+  header_ = reinterpret_cast<const scan_ring::Header*>(segment_);
+  if (region_.get_size() < sizeof(scan_ring::Header) || header_->magic != scan_ring::MAGIC)
+  {
+    throw std::runtime_error(fmt::format("{} contains no scan ring.", name));
+  }
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (header_->version != scan_ring::VERSION)
+  {
+    throw std::runtime_error(fmt::format("{} has the unsupported version {}.", name, header_->version));
+  }
+  if (header_->num_slots == 0 ||
+      header_->slot_size < scan_ring::slotSize(header_->max_num_measurements, header_->max_num_io_states) ||
+      region_.get_size() < scan_ring::segmentSize(header_->num_slots, header_->slot_size))
+  {
+    throw std::runtime_error(fmt::format("The scan ring {} is corrupted.", name));
+  }
+  next_index_ = header_->num_published.load(std::memory_order_acquire);
+}
+
+inline boost::optional<LaserScan> ScanRingReader::readLatest()
+{
+  for (;;)
+  {
+    const uint64_t num_published{ header_->num_published.load(std::memory_order_acquire) };
+    if (num_published == 0)
+    {
+      return boost::none;
+    }
+    auto scan{ read(num_published - 1) };
+    // Without a newer scan, the newest one stays unreadable.
+    if (scan || header_->num_published.load(std::memory_order_acquire) == num_published)
+    {
+      return scan;
+    }
+  }
+}
+
+inline boost::optional<LaserScan> ScanRingReader::readNext()
+{
+  for (;;)
+  {
+    const uint64_t num_published{ header_->num_published.load(std::memory_order_acquire) };
+    if (next_index_ >= num_published)
+    {
+      return boost::none;
+    }
+    if (next_index_ + header_->num_slots < num_published)
+    {
+      num_missed_scans_ += num_published - header_->num_slots - next_index_;
+      next_index_ = num_published - header_->num_slots;
+    }
+    auto scan{ read(next_index_++) };
+    if (scan)
+    {
+      return scan;
+    }
+    ++num_missed_scans_;
+  }
+}
+
+inline uint64_t ScanRingReader::numMissedScans() const
+{
+  return num_missed_scans_;
+}
+
+inline bool ScanRingReader::publisherClosed() const
+{
+  return header_->closed.load(std::memory_order_acquire) != 0;
+}
+
+inline boost::optional<LaserScan> ScanRingReader::read(const uint64_t& publish_index) const
+{
+  const scan_ring::Slot<const char> slot(segment_, *header_, publish_index);
+  uint64_t written_sequence{ 0 };
+  std::chrono::steady_clock::time_point write_detection_time;
+  for (;;)
+  {
+    const uint64_t sequence{ slot.header->sequence.load(std::memory_order_acquire) };
+    if (sequence % 2 != 0)
+    {
+      const auto now{ std::chrono::steady_clock::now() };
+      if (sequence != written_sequence)
+      {
+        written_sequence = sequence;
+        write_detection_time = now;
+      }
+      // A publisher which died or was closed while writing never finishes the slot.
+      if (publisherClosed() || now - write_detection_time > MAX_SCAN_RING_WRITE_DURATION)
+      {
+        return boost::none;
+      }
+      std::this_thread::yield();
+      continue;
+    }
+
+    // All values are copied before they are validated, because the publisher may overwrite them at any time.
+    const scan_ring::ScanInfo info{ slot.header->info };
+    const uint32_t num_measurements{ std::min(info.num_measurements, header_->max_num_measurements) };
+    const uint32_t num_intensities{ std::min(info.num_intensities, header_->max_num_measurements) };
+    const uint32_t num_io_states{ std::min(info.num_io_states, header_->max_num_io_states) };
+    LaserScan::MeasurementData measurements(num_measurements);
+    LaserScan::IntensityData intensities(num_intensities);
+    std::vector<scan_ring::IOStateRecord> io_state_records(num_io_states);
+    std::copy_n(reinterpret_cast<const double*>(slot.measurements), num_measurements, measurements.begin());
+    std::copy_n(reinterpret_cast<const double*>(slot.intensities), num_intensities, intensities.begin());
+    std::copy_n(reinterpret_cast<const scan_ring::IOStateRecord*>(slot.io_states),
+                num_io_states,
+                io_state_records.begin());
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.header->sequence.load(std::memory_order_relaxed) != sequence)
+    {
+      continue;
+    }
+    if (info.publish_index != publish_index)
+    {
+      return boost::none;
+    }
+
+    LaserScan scan(util::TenthOfDegree(info.resolution),
+                   util::TenthOfDegree(info.min_scan_angle),
+                   util::TenthOfDegree(info.max_scan_angle),
+                   info.scan_counter,
+                   info.active_zoneset,
+                   info.timestamp);
+    scan.measurements().swap(measurements);
+    scan.intensities(intensities);
+    LaserScan::IOData io_states;
+    io_states.reserve(io_state_records.size());
+    for (const auto& record : io_state_records)
+    {
+      data_conversion_layer::monitoring_frame::io::PinData pin_data;
+      auto pin_byte{ record.pin_data.begin() };
+      for (auto& byte : pin_data.input_state)
+      {
+        byte = *pin_byte++;
+      }
+      for (auto& byte : pin_data.output_state)
+      {
+        byte = *pin_byte++;
+      }
+      io_states.emplace_back(pin_data, record.timestamp);
+    }
+    scan.ioStates(io_states);
+    return scan;
+  }
+}
+
+}  // namespace communication_layer
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_SCAN_RING_READER_H
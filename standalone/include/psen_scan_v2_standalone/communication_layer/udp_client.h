@@ -36,6 +36,7 @@
 
 #include "psen_scan_v2_standalone/data_conversion_layer/raw_scanner_data.h"
 #include "psen_scan_v2_standalone/util/logging.h"
+#include "psen_scan_v2_standalone/util/hot_path_tracer.h"
 #include "psen_scan_v2_standalone/util/timestamp.h"
 
 namespace psen_scan_v2_standalone
@@ -104,12 +105,14 @@ public:
    * @param host_port Port from which data are sent and received.
    * @param endpoint_ip IP address of the endpoint from which data are received and sent too.
    * @param endpoint_port Port on which the other endpoint is sending and receiving data.
+   * @param tracer Tracer informed about the reception of every message. It has to outlive the client.
    */
   UdpClientImpl(const NewMessageCallback& msg_callback,
                 const ErrorCallback& error_callback,
                 const unsigned short& host_port,
                 const unsigned int& endpoint_ip,
-                const unsigned short& endpoint_port);
+                const unsigned short& endpoint_port,
+                util::HotPathTracer& tracer = util::HotPathTracer::disabled());
 
   /**
    * @brief Closes the UDP connection and stops all pending asynchronous operation.
@@ -167,6 +170,7 @@ private:
 
   NewMessageCallback message_callback_;
   ErrorCallback error_callback_;
+  util::HotPathTracer& tracer_;
 
   boost::asio::ip::udp::socket socket_;
   boost::asio::ip::udp::endpoint endpoint_;
@@ -176,9 +180,11 @@ inline communication_layer::UdpClientImpl::UdpClientImpl(const NewMessageCallbac
                                                          const ErrorCallback& error_callback,
                                                          const unsigned short& host_port,
                                                          const unsigned int& endpoint_ip,
-                                                         const unsigned short& endpoint_port)
+                                                         const unsigned short& endpoint_port,
+                                                         util::HotPathTracer& tracer)
   : message_callback_(message_callback)
   , error_callback_(error_callback)
+  , tracer_(tracer)
   , socket_(io_service_, boost::asio::ip::udp::endpoint(boost::asio::ip::udp::v4(), host_port))
   , endpoint_(boost::asio::ip::address_v4(endpoint_ip), endpoint_port)
 {
@@ -307,6 +313,7 @@ inline void UdpClientImpl::asyncReceive(const ReceiveMode& modi)
                           }
                           else
                           {
+                            tracer_.traceReceive();
                             message_callback_(received_data_, bytes_received, util::getCurrentTime());
                           }
                           if (modi == ReceiveMode::continuous)
@@ -16,6 +16,8 @@
 #ifndef PSEN_SCAN_V2_STANDALONE_DEFAULT_PARAMETERS_H
 #define PSEN_SCAN_V2_STANDALONE_DEFAULT_PARAMETERS_H
 
+#include <cstddef>
+
 #include "psen_scan_v2_standalone/data_conversion_layer/angle_conversions.h"
 #include "psen_scan_v2_standalone/util/tenth_of_degree.h"
 
@@ -35,6 +37,13 @@ static constexpr unsigned short CONTROL_PORT_OF_HOST_DEVICE{ 55116 };
 static constexpr bool FRAGMENTED_SCANS{ false };
 static constexpr bool INTENSITIES{ false };
 static constexpr bool DIAGNOSTICS{ false };
+static constexpr bool HOT_PATH_TRACING{ false };
+static constexpr bool SCANNER_CLOCK_TIMESTAMPS{ false };
+
+static constexpr std::size_t FRAME_RECORDING_MAX_FILE_SIZE{ 64 * 1024 * 1024 };
+static constexpr std::size_t FRAME_RECORDING_MAX_NUM_FILES{ 10 };
+
+static constexpr std::size_t SCAN_RING_NUM_SLOTS{ 16 };
 
 //! @brief Start angle of measurement.
 static constexpr double DEFAULT_ANGLE_START(-data_conversion_layer::degreeToRadian(137.4));
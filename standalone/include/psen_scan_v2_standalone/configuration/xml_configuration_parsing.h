@@ -13,9 +13,14 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+#include <array>
+#include <cstddef>
+#include <cstring>
 #include <string>
 #include <stdexcept>
+#include <vector>
 
+#include <fmt/format.h>
 #include <tinyxml2.h>
 
 #include "psen_scan_v2_standalone/configuration/zoneset_configuration.h"
@@ -41,6 +46,57 @@ public:
   }
 };
 
+/**
+ * @brief Converts a hex character into its value.
+ *
+ * @return int value in the range [0, 15] or -1 if the character is no hex digit
+ */
+inline int hexDigitToValue(const char c)
+{
+  if (c >= '0' && c <= '9')
+  {
+    return c - '0';
+  }
+  if (c >= 'A' && c <= 'F')
+  {
+    return c - 'A' + 10;
+  }
+  if (c >= 'a' && c <= 'f')
+  {
+    return c - 'a' + 10;
+  }
+  return -1;
+}
+
+/**
+ * @brief Converts the quadrupel \<ro\> value starting at ro_value into the respective length in mm
+ *
+ * Follows the same rule as ro_value_to_uint(const std::string&) but works directly on the raw characters without
+ * any allocation.
+ *
+ * @param ro_value pointer to (at least) 4 hex characters
+ * @return unsigned long length in mm
+ * @throws XMLConfigurationParserException if one of the characters is no hex digit
+ */
+inline unsigned long ro_value_to_uint(const char* ro_value)
+{
+  // "abcd" -> 0xcdab
+  static constexpr std::array<std::size_t, 4> DIGIT_ORDER{ { 2, 3, 0, 1 } };
+
+  unsigned long value{ 0 };
+  for (const auto& index : DIGIT_ORDER)
+  {
+    const int digit = hexDigitToValue(ro_value[index]);
+    if (digit < 0)
+    {
+      throw XMLConfigurationParserException(
+          fmt::format("Could not parse. \"{}\" is no valid <ro> value.", std::string(ro_value, 4)));
+    }
+    value = (value << 4) | static_cast<unsigned long>(digit);
+  }
+  return value;
+}
+
 /**
  * @brief Converts a quadrupel \<ro\> value into the respective length in mm
  *
@@ -54,47 +110,68 @@ public:
  * @param ro_value string containing a quadrupel of hex values
  * @return unsigned long length in mm
  */
-unsigned long ro_value_to_uint(const std::string& ro_value)
+inline unsigned long ro_value_to_uint(const std::string& ro_value)
 {
-  auto string_cpy = ro_value;
-  std::swap(string_cpy[0], string_cpy[2]);
-  std::swap(string_cpy[1], string_cpy[3]);
-  return std::stoul(string_cpy, nullptr, 16);
+  if (ro_value.length() < 4)
+  {
+    throw XMLConfigurationParserException(fmt::format("Could not parse. \"{}\" is no valid <ro> value.", ro_value));
+  }
+  return ro_value_to_uint(ro_value.c_str());
 }
 
 /**
- * @brief Convert string from a \<ro\> element to values.
+ * @brief Convert the characters of a \<ro\> element to values.
  *
  * The value in a \<ro\> element is a string with length 4*N where N is the number of distance values.
- * 4 succedding values form a set that can be transformed into the lenth in mm.
+ * 4 succedding values form a set that can be transformed into the lenth in mm. Extra characters at the end are
+ * ignored.
  *
- * @param ro_string
- * @return std::vector<unsigned int>
+ * @param ro_string pointer to the first character
+ * @param length number of characters
+ * @return std::vector<unsigned long>
  */
-std::vector<unsigned long> ro_string_to_vec(const std::string& ro_string)
+inline std::vector<unsigned long> ro_string_to_vec(const char* ro_string, const std::size_t& length)
 {
   std::vector<unsigned long> vec;
-
-  try
+  vec.reserve(length / 4);
+  for (std::size_t i = 0; i + 4 <= length; i += 4)
   {
-    for (size_t i = 0; i < ro_string.length(); i += 4)
-    {
-      const auto substr = ro_string.substr(i, 4);
-      if (substr.length() == 4)
-      {
-        vec.push_back(ro_value_to_uint(substr));
-      }
-    }
+    vec.push_back(ro_value_to_uint(ro_string + i));
   }
-  catch (const std::exception& e)
-  {
-    throw XMLConfigurationParserException(e.what());
-  }
-
   return vec;
 }
 
+/**
+ * @brief Convert string from a \<ro\> element to values.
+ *
+ * @see ro_string_to_vec(const char*, const std::size_t&)
+ */
+inline std::vector<unsigned long> ro_string_to_vec(const char* ro_string)
+{
+  return ro_string_to_vec(ro_string, std::strlen(ro_string));
+}
+
+/**
+ * @brief Convert string from a \<ro\> element to values.
+ *
+ * @see ro_string_to_vec(const char*, const std::size_t&)
+ */
+inline std::vector<unsigned long> ro_string_to_vec(const std::string& ro_string)
+{
+  return ro_string_to_vec(ro_string.data(), ro_string.length());
+}
+
 ZoneSetConfiguration parseFile(const char* filename);
+
+/**
+ * @brief Parses the file or loads the already parsed configuration from a binary cache.
+ *
+ * The cache is keyed by the hash of the file content. If the cache is missing or outdated the file is parsed and
+ * the cache is (re)written. Failing to write the cache is only reported as warning.
+ *
+ * @see zoneset_configuration_cache
+ */
+ZoneSetConfiguration parseFile(const char* filename, const std::string& cache_filename);
 ZoneSetConfiguration parseString(const char* xml);
 
 }  // namespace xml_config_parsing
@@ -84,6 +84,17 @@ public:
   util::TenthOfDegree resolution_;
 
   boost::optional<ZoneSetSpeedRange> speed_range_;
+
+  bool operator==(const ZoneSet& rhs) const
+  {
+    return safety1_ == rhs.safety1_ && safety2_ == rhs.safety2_ && safety3_ == rhs.safety3_ && warn1_ == rhs.warn1_ &&
+           warn2_ == rhs.warn2_ && muting1_ == rhs.muting1_ && muting2_ == rhs.muting2_ &&
+           resolution_ == rhs.resolution_ && speed_range_ == rhs.speed_range_;
+  }
+  bool operator!=(const ZoneSet& rhs) const
+  {
+    return !operator==(rhs);
+  }
 };
 
 }  // namespace configuration
@@ -27,6 +27,15 @@ class ZoneSetConfiguration
 {
 public:
   std::vector<ZoneSet> zonesets_;
+
+  bool operator==(const ZoneSetConfiguration& rhs) const
+  {
+    return zonesets_ == rhs.zonesets_;
+  }
+  bool operator!=(const ZoneSetConfiguration& rhs) const
+  {
+    return !operator==(rhs);
+  }
 };
 
 }  // namespace configuration
@@ -0,0 +1,84 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_ZONESET_CONFIGURATION_CACHE_H
+#define PSEN_SCAN_V2_STANDALONE_ZONESET_CONFIGURATION_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include <boost/optional.hpp>
+
+#include "psen_scan_v2_standalone/configuration/zoneset_configuration.h"
+
+namespace psen_scan_v2_standalone
+{
+namespace configuration
+{
+/**
+ * @brief Compact binary cache for parsed zoneset configurations.
+ *
+ * Parsing a large xml configuration is comparatively slow. The parsed ZoneSetConfiguration is therefore stored in a
+ * binary file together with a key (the hash of the xml content). On the next start the file is memory-mapped and
+ * deserialized if the key matches.
+ *
+ * Layout (native byte order):
+ * | magic (uint32) | version (uint32) | key (uint64) | number of zonesets (uint32) | zonesets... |
+ *
+ * Each zoneset is stored as:
+ * | resolution (int16) | has speed range (uint8) | min (int16) | max (int16) | 7 x [count (uint32) | radii (uint16)] |
+ */
+namespace zoneset_configuration_cache
+{
+class ZoneSetConfigurationCacheException : public std::runtime_error
+{
+public:
+  ZoneSetConfigurationCacheException(const std::string& msg) : std::runtime_error(msg)
+  {
+  }
+};
+
+static constexpr uint32_t MAGIC{ 0x435A5350 };  // "PSZC"
+static constexpr uint32_t VERSION{ 1 };
+
+//! @returns the 64 bit FNV-1a hash of the data used as key of the cache.
+uint64_t hash(const char* data, const std::size_t& size);
+
+//! @throws ZoneSetConfigurationCacheException if a radius does not fit into 16 bit.
+std::string serialize(const ZoneSetConfiguration& zoneset_config, const uint64_t& key);
+
+/**
+ * @returns the deserialized configuration or boost::none if the data is no valid cache or was created with a
+ * different key.
+ */
+boost::optional<ZoneSetConfiguration> deserialize(const char* data, const std::size_t& size, const uint64_t& key);
+
+//! @brief Memory-maps the cache file and deserializes it. Missing or invalid files result in boost::none.
+boost::optional<ZoneSetConfiguration> load(const std::string& filename, const uint64_t& key);
+
+/**
+ * @brief Writes the cache file. A temporary file is renamed afterwards so that readers never see a partial file.
+ *
+ * @throws ZoneSetConfigurationCacheException if the file could not be written.
+ */
+void store(const std::string& filename, const ZoneSetConfiguration& zoneset_config, const uint64_t& key);
+
+}  // namespace zoneset_configuration_cache
+}  // namespace configuration
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_ZONESET_CONFIGURATION_CACHE_H
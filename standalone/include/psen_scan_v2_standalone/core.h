@@ -21,11 +21,13 @@
  */
 
 #include "psen_scan_v2_standalone/configuration/default_parameters.h"
+#include "psen_scan_v2_standalone/io_edge.h"
 #include "psen_scan_v2_standalone/laserscan.h"
 #include "psen_scan_v2_standalone/util/logging.h"
 #include "psen_scan_v2_standalone/scanner_configuration.h"
 #include "psen_scan_v2_standalone/scanner_config_builder.h"
 #include "psen_scan_v2_standalone/scanner_v2.h"
+#include "psen_scan_v2_standalone/scanner_replay.h"
 #include "psen_scan_v2_standalone/scan_range.h"
 
 #endif  // PSEN_SCAN_V2_STANDALONE_CORE_H
@@ -17,6 +17,8 @@
 #define PSEN_SCAN_V2_STANDALONE_DIAGNOSTICS_H
 
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <map>
 #include <vector>
@@ -206,6 +208,50 @@ private:
   ErrorLocation error_location_;
 };
 
+/**
+ * @brief Compact copy of the error bits of all devices contained in the diagnostic chunk.
+ *
+ * The bits are stored in machine words, so checking for errors and comparing the masks of two monitoring frames only
+ * takes a few word compares. The diagnostic::Message objects are only created on request via messages(), which allows
+ * to expand the diagnostics only if they changed.
+ */
+class ErrorMask
+{
+public:
+  static constexpr std::size_t NUM_BYTES{ RAW_CHUNK_LENGTH_FOR_ONE_DEVICE_IN_BYTES *
+                                          configuration::VALID_SCANNER_IDS.size() };
+  using RawBytes = std::array<uint8_t, NUM_BYTES>;
+
+public:
+  ErrorMask() = default;
+  //! @brief Creates the mask from the diagnostic chunk without its unused offset. Unused error bits are ignored.
+  explicit ErrorMask(const RawBytes& raw_bytes);
+  //! @brief Creates the mask with the bits of the specified messages set.
+  explicit ErrorMask(const std::vector<diagnostic::Message>& messages);
+
+  void set(const diagnostic::Message& msg);
+  bool test(const diagnostic::Message& msg) const;
+  //! @returns true if no error bit is set.
+  bool none() const;
+  //! @returns one diagnostic::Message per set bit, ordered by device, byte and bit.
+  std::vector<diagnostic::Message> messages() const;
+  //! @returns a copy of the mask which only contains the error bits of the specified device.
+  ErrorMask device(const configuration::ScannerId& id) const;
+
+  bool operator==(const ErrorMask& rhs) const;
+  bool operator!=(const ErrorMask& rhs) const;
+
+private:
+  static std::size_t byteIndex(const diagnostic::Message& msg);
+  const uint8_t* bytes() const;
+  uint8_t* bytes();
+
+private:
+  static constexpr std::size_t NUM_WORDS{ (NUM_BYTES + sizeof(uint64_t) - 1) / sizeof(uint64_t) };
+  //! Bytes of the diagnostic chunk in their original order, the padding of the last word stays zero.
+  std::array<uint64_t, NUM_WORDS> words_{};
+};
+
 constexpr inline Message::Message(const configuration::ScannerId& id, const ErrorLocation& location)
   : id_(id), error_location_(location)
 {
@@ -0,0 +1,156 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_FRAME_RECORDING_H
+#define PSEN_SCAN_V2_STANDALONE_FRAME_RECORDING_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include <fmt/format.h>
+
+#include "psen_scan_v2_standalone/data_conversion_layer/raw_scanner_data.h"
+#include "psen_scan_v2_standalone/util/logging.h"
+
+namespace psen_scan_v2_standalone
+{
+namespace data_conversion_layer
+{
+/**
+ * @brief Contains the file format of recorded monitoring frames.
+ *
+ * A recording file starts with the MAGIC and the VERSION. It is followed by one record per received datagram:
+ * - receive timestamp in nanoseconds since epoch (int64_t)
+ * - number of bytes of the datagram (uint32_t)
+ * - the raw bytes of the datagram
+ *
+ * All numbers are written in the byte order of the host (little endian on all supported platforms).
+ *
+ * @see communication_layer::FrameRecorder
+ */
+namespace frame_recording
+{
+static constexpr std::array<char, 8> MAGIC{ { 'P', 'S', 'E', 'N', 'R', 'E', 'C', '\0' } };
+static constexpr uint32_t VERSION{ 1 };
+static constexpr std::size_t FILE_HEADER_SIZE{ sizeof(MAGIC) + sizeof(VERSION) };
+static constexpr std::size_t RECORD_HEADER_SIZE{ sizeof(int64_t) + sizeof(uint32_t) };
+static const std::string FILE_EXTENSION{ ".psenrec" };
+
+struct Record
+{
+  //! Receive time in nanoseconds since epoch.
+  int64_t timestamp{ 0 };
+  RawData data;
+};
+
+/**
+ * @brief Exception thrown if a file is no valid frame recording.
+ */
+class ReadError : public std::runtime_error
+{
+public:
+  ReadError(const std::string& msg);
+};
+
+//! @returns the path of the recording file with the specified index, e.g. "<file_prefix>_000003.psenrec".
+std::string fileName(const std::string& file_prefix, const std::size_t& index);
+
+/**
+ * @brief Reads the records of a single recording file in the order they were received.
+ */
+class Reader
+{
+public:
+  //! @throws ReadError if the file cannot be opened or does not start with a valid file header.
+  explicit Reader(const std::string& file_path);
+
+public:
+  /**
+   * @returns false if there are no more records.
+   *
+   * A truncated last record, e.g. because the process was killed while writing, also ends the recording.
+   */
+  bool read(Record& record);
+
+private:
+  const std::string file_path_;
+  std::ifstream is_;
+};
+
+inline ReadError::ReadError(const std::string& msg) : std::runtime_error(msg)
+{
+}
+
+inline std::string fileName(const std::string& file_prefix, const std::size_t& index)
+{
+  return fmt::format("{}_{:06d}{}", file_prefix, index, FILE_EXTENSION);
+}
+
+inline Reader::Reader(const std::string& file_path) : file_path_(file_path), is_(file_path, std::ios::binary)
+{
+  if (!is_)
+  {
+    throw ReadError(fmt::format("Cannot open frame recording {}.", file_path));
+  }
+
+  std::array<char, MAGIC.size()> magic{};
+  uint32_t version{ 0 };
+  is_.read(magic.data(), static_cast<std::streamsize>(magic.size()));
+  is_.read(reinterpret_cast<char*>(&version), sizeof(version));
+  if (!is_ || magic != MAGIC)
+  {
+    throw ReadError(fmt::format("{} is no frame recording.", file_path));
+  }
+  if (version != VERSION)
+  {
+    throw ReadError(fmt::format("{} has the unsupported version {}.", file_path, version));
+  }
+}
+
+inline bool Reader::read(Record& record)
+{
+  std::array<char, RECORD_HEADER_SIZE> header{};
+  is_.read(header.data(), static_cast<std::streamsize>(header.size()));
+  if (is_.gcount() == 0)
+  {
+    return false;
+  }
+
+  uint32_t num_bytes{ 0 };
+  if (is_)
+  {
+    std::memcpy(&record.timestamp, header.data(), sizeof(record.timestamp));
+    std::memcpy(&num_bytes, header.data() + sizeof(record.timestamp), sizeof(num_bytes));
+    record.data.resize(num_bytes);
+    is_.read(record.data.data(), static_cast<std::streamsize>(num_bytes));
+  }
+  if (!is_)
+  {
+    PSENSCAN_WARN("FrameRecording", "Ignoring the truncated last record of {}.", file_path_);
+    return false;
+  }
+  return true;
+}
+
+}  // namespace frame_recording
+}  // namespace data_conversion_layer
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_FRAME_RECORDING_H
@@ -18,6 +18,7 @@
 
 #include <array>
 #include <bitset>
+#include <cstdint>
 #include <ostream>
 #include <string>
 
@@ -49,7 +50,7 @@ static inline LogicalInputType getInputType(std::size_t byte_location, std::size
 }
 
 //! @throws std::out_of_range if byte_location >= NUMBER_OF_INPUT_BYTES or bit_location >= 8
-static inline std::string getInputName(std::size_t byte_location, std::size_t bit_location)
+static inline const IoName& getInputName(std::size_t byte_location, std::size_t bit_location)
 {
   return LOGICAL_INPUT_BIT_TO_NAME.at(getInputType(byte_location, bit_location));
 }
@@ -61,11 +62,106 @@ static inline OutputType getOutputType(std::size_t byte_location, std::size_t bi
 }
 
 //! @throws std::out_of_range if byte_location >= NUMBER_OF_OUTPUT_BYTES or bit_location >= 8
-static inline std::string getOutputName(std::size_t byte_location, std::size_t bit_location)
+static inline const IoName& getOutputName(std::size_t byte_location, std::size_t bit_location)
 {
   return OUTPUT_BIT_TO_NAME.at(getOutputType(byte_location, bit_location));
 }
 
+/**
+ * @brief Packs the given pin bytes into a single word.
+ *
+ * Bit n of byte m ends up at position m * 8 + n which is the same as the id of the corresponding PinState.
+ */
+template <std::size_t NumBytes>
+static inline uint64_t toBitmask(const std::array<std::bitset<8>, NumBytes>& bytes)
+{
+  static_assert(NumBytes <= sizeof(uint64_t), "Pin bytes do not fit into a single bitmask");
+  uint64_t mask{ 0 };
+  for (std::size_t byte_n = 0; byte_n < NumBytes; ++byte_n)
+  {
+    mask |= static_cast<uint64_t>(bytes[byte_n].to_ulong()) << (8 * byte_n);
+  }
+  return mask;
+}
+
+//! @brief Computes a bitmask with all bits set that are not marked as unused in the given bit definition.
+template <typename BitType, std::size_t NumBytes>
+static constexpr uint64_t usedBitsMask(const std::array<std::array<BitType, 8>, NumBytes>& bits,
+                                       const BitType& unused)
+{
+  uint64_t mask{ 0 };
+  for (std::size_t byte_n = 0; byte_n < NumBytes; ++byte_n)
+  {
+    for (std::size_t bit_n = 0; bit_n < 8; ++bit_n)
+    {
+      if (bits[byte_n][bit_n] != unused)
+      {
+        mask |= uint64_t{ 1 } << (byte_n * 8 + bit_n);
+      }
+    }
+  }
+  return mask;
+}
+
+//! @brief Computes a bitmask with all bits set that are of the given type in the given bit definition.
+template <typename BitType, std::size_t NumBytes>
+static constexpr uint64_t bitsMaskOfType(const std::array<std::array<BitType, 8>, NumBytes>& bits,
+                                         const BitType& type)
+{
+  uint64_t mask{ 0 };
+  for (std::size_t byte_n = 0; byte_n < NumBytes; ++byte_n)
+  {
+    for (std::size_t bit_n = 0; bit_n < 8; ++bit_n)
+    {
+      if (bits[byte_n][bit_n] == type)
+      {
+        mask |= uint64_t{ 1 } << (byte_n * 8 + bit_n);
+      }
+    }
+  }
+  return mask;
+}
+
+static constexpr uint64_t USED_INPUT_BITS_MASK{ usedBitsMask(LOGICAL_INPUT_BITS, LogicalInputType::unused) };
+static constexpr uint64_t USED_OUTPUT_BITS_MASK{ usedBitsMask(OUTPUT_BITS, OutputType::unused) };
+
+//! @brief Maps the id of a pin (byte * 8 + bit) to its name. The names are owned by the static name maps.
+using PinNameTable = std::array<const IoName*, 64>;
+
+//! @return Name table for all logical input pins, created only once.
+static inline const PinNameTable& inputNameTable()
+{
+  static const PinNameTable table = []() {
+    PinNameTable names{};
+    for (std::size_t byte_n = 0; byte_n < NUMBER_OF_INPUT_BYTES; ++byte_n)
+    {
+      for (std::size_t bit_n = 0; bit_n < 8; ++bit_n)
+      {
+        names[byte_n * 8 + bit_n] = &getInputName(byte_n, bit_n);
+      }
+    }
+    return names;
+  }();
+  return table;
+}
+
+//! @return Name table for all output pins, created only once.
+static inline const PinNameTable& outputNameTable()
+{
+  static const PinNameTable table = []() {
+    PinNameTable names{};
+    for (std::size_t byte_n = 0; byte_n < NUMBER_OF_OUTPUT_BYTES; ++byte_n)
+    {
+      for (std::size_t bit_n = 0; bit_n < 8; ++bit_n)
+      {
+        names[byte_n * 8 + bit_n] = &getOutputName(byte_n, bit_n);
+      }
+    }
+    return names;
+  }();
+  return table;
+}
+
 /**
  * @brief Represents the IO PIN field of a monitoring frame.
  */
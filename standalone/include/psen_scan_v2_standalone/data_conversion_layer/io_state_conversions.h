@@ -87,40 +87,44 @@ static inline std::vector<PinState> generateOutputPinStates(const monitoring_fra
   return pin_states;
 }
 
-static inline std::vector<PinState> generateChangedInputStates(const monitoring_frame::io::PinData& new_state,
-                                                               const monitoring_frame::io::PinData& old_state)
+static inline ChangedPinStates generateChangedInputPins(const monitoring_frame::io::PinData& new_state,
+                                                        const monitoring_frame::io::PinData& old_state)
 {
-  std::vector<PinState> pin_states;
-  for (std::size_t byte_n = 0; byte_n < new_state.input_state.size(); ++byte_n)
+  if (new_state.input_state == old_state.input_state)
   {
-    for (std::size_t bit_n = 0; bit_n < 8; ++bit_n)
-    {
-      if (isUsedInputBit(byte_n, bit_n) &&
-          (new_state.input_state.at(byte_n).test(bit_n) ^ old_state.input_state.at(byte_n).test(bit_n)))
-      {
-        pin_states.emplace_back(generateInputPinState(new_state, byte_n, bit_n));
-      }
-    }
+    return { 0, 0, monitoring_frame::io::inputNameTable() };
   }
-  return pin_states;
+  const uint64_t new_bits{ monitoring_frame::io::toBitmask(new_state.input_state) };
+  const uint64_t old_bits{ monitoring_frame::io::toBitmask(old_state.input_state) };
+  return { (new_bits ^ old_bits) & monitoring_frame::io::USED_INPUT_BITS_MASK,
+           new_bits,
+           monitoring_frame::io::inputNameTable() };
 }
 
-static inline std::vector<PinState> generateChangedOutputStates(const monitoring_frame::io::PinData& new_state,
-                                                                const monitoring_frame::io::PinData& old_state)
+static inline ChangedPinStates generateChangedOutputPins(const monitoring_frame::io::PinData& new_state,
+                                                         const monitoring_frame::io::PinData& old_state)
 {
-  std::vector<PinState> pin_states;
-  for (std::size_t byte_n = 0; byte_n < new_state.output_state.size(); ++byte_n)
+  if (new_state.output_state == old_state.output_state)
   {
-    for (std::size_t bit_n = 0; bit_n < 8; ++bit_n)
-    {
-      if (isUsedOutputBit(byte_n, bit_n) &&
-          (new_state.output_state.at(byte_n).test(bit_n) ^ old_state.output_state.at(byte_n).test(bit_n)))
-      {
-        pin_states.emplace_back(generateOutputPinState(new_state, byte_n, bit_n));
-      }
-    }
+    return { 0, 0, monitoring_frame::io::outputNameTable() };
   }
-  return pin_states;
+  const uint64_t new_bits{ monitoring_frame::io::toBitmask(new_state.output_state) };
+  const uint64_t old_bits{ monitoring_frame::io::toBitmask(old_state.output_state) };
+  return { (new_bits ^ old_bits) & monitoring_frame::io::USED_OUTPUT_BITS_MASK,
+           new_bits,
+           monitoring_frame::io::outputNameTable() };
+}
+
+static inline std::vector<PinState> generateChangedInputStates(const monitoring_frame::io::PinData& new_state,
+                                                               const monitoring_frame::io::PinData& old_state)
+{
+  return generateChangedInputPins(new_state, old_state).toPinStates();
+}
+
+static inline std::vector<PinState> generateChangedOutputStates(const monitoring_frame::io::PinData& new_state,
+                                                                const monitoring_frame::io::PinData& old_state)
+{
+  return generateChangedOutputPins(new_state, old_state).toPinStates();
 }
 
 }  // namespace data_conversion_layer
@@ -22,6 +22,7 @@
 #include "psen_scan_v2_standalone/laserscan.h"
 
 #include "psen_scan_v2_standalone/util/logging.h"
+#include "psen_scan_v2_standalone/util/scan_clock_estimator.h"
 
 #include <algorithm>
 #include <numeric>
@@ -60,8 +61,19 @@ public:
    */
   static LaserScan
   toLaserScan(const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs);
+  /**
+   * @brief Same as toLaserScan() above but the timestamp of the LaserScan is smoothed by the scan_clock.
+   *
+   * @see util::ScanClockEstimator
+   */
+  static LaserScan
+  toLaserScan(const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs,
+              util::ScanClockEstimator& scan_clock);
 
 private:
+  static LaserScan
+  toLaserScan(const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs,
+              util::ScanClockEstimator* scan_clock);
   static std::vector<int> getFilledFramesIndicesSortedByThetaAngle(
       const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs);
   static util::TenthOfDegree
@@ -69,7 +81,8 @@ private:
                     const util::TenthOfDegree& min_angle);
   static int64_t
   calculateTimestamp(const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs,
-                     const std::vector<int>& filled_stamped_msgs_indices);
+                     const std::vector<int>& filled_stamped_msgs_indices,
+                     util::ScanClockEstimator* scan_clock);
   static int64_t calculateFirstRayTime(const data_conversion_layer::monitoring_frame::MessageStamped& stamped_msg);
   static void
   validateMonitoringFrames(const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs,
@@ -79,12 +92,28 @@ private:
   static bool
   allScanCountersMatch(const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs);
   static bool
+  allScannerIdsMatch(const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs);
+  static bool
   thetaAnglesFitTogether(const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs,
                          const std::vector<int>& sorted_stamped_msgs_indices);
 };
 
 inline LaserScan LaserScanConverter::toLaserScan(
     const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs)
+{
+  return toLaserScan(stamped_msgs, nullptr);
+}
+
+inline LaserScan LaserScanConverter::toLaserScan(
+    const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs,
+    util::ScanClockEstimator& scan_clock)
+{
+  return toLaserScan(stamped_msgs, &scan_clock);
+}
+
+inline LaserScan LaserScanConverter::toLaserScan(
+    const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs,
+    util::ScanClockEstimator* scan_clock)
 {
   if (stamped_msgs.empty())
   {
@@ -97,7 +126,7 @@ inline LaserScan LaserScanConverter::toLaserScan(
   const auto min_angle = stamped_msgs[sorted_stamped_msgs_indices[0]].msg_.fromTheta();
   const auto max_angle = calculateMaxAngle(stamped_msgs, min_angle);
 
-  const auto timestamp = calculateTimestamp(stamped_msgs, sorted_stamped_msgs_indices);
+  const auto timestamp = calculateTimestamp(stamped_msgs, sorted_stamped_msgs_indices, scan_clock);
 
   std::vector<double> measurements;
   std::vector<double> intensities;
@@ -138,7 +167,8 @@ inline LaserScan LaserScanConverter::toLaserScan(
                  max_angle,
                  stamped_msgs[0].msg_.scanCounter(),
                  stamped_msgs[sorted_stamped_msgs_indices.back()].msg_.activeZoneset(),
-                 timestamp);
+                 timestamp,
+                 stamped_msgs[0].msg_.scannerId());
 
   scan.measurements(measurements);
   scan.intensities(intensities);
@@ -184,13 +214,20 @@ inline util::TenthOfDegree LaserScanConverter::calculateMaxAngle(
 
 inline int64_t LaserScanConverter::calculateTimestamp(
     const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs,
-    const std::vector<int>& filled_stamped_msgs_indices)
+    const std::vector<int>& filled_stamped_msgs_indices,
+    util::ScanClockEstimator* scan_clock)
 {
   const auto it = std::min_element(
       filled_stamped_msgs_indices.begin(), filled_stamped_msgs_indices.end(), [&stamped_msgs](int i, int j) {
         return stamped_msgs[i].stamp_ < stamped_msgs[j].stamp_;
       });  // determines stamped_msg with smallest stamp
-  return calculateFirstRayTime(stamped_msgs[*it]);
+  const auto first_ray_time = calculateFirstRayTime(stamped_msgs[*it]);
+  if (!scan_clock)
+  {
+    return first_ray_time;
+  }
+  return scan_clock->estimate(
+      stamped_msgs[*it].msg_.scanCounter(), stamped_msgs[*it].msg_.fromTheta(), first_ray_time);
 }
 
 inline int64_t
@@ -214,6 +251,10 @@ inline void LaserScanConverter::validateMonitoringFrames(
   {
     throw ScannerProtocolViolationError("The scan counters of all monitoring frames have to be the same.");
   }
+  else if (!allScannerIdsMatch(stamped_msgs))
+  {
+    throw ScannerProtocolViolationError("All monitoring frames have to stem from the same scanner device.");
+  }
   else if (!thetaAnglesFitTogether(stamped_msgs, sorted_stamped_msgs_indices))
   {
     throw ScannerProtocolViolationError("The monitoring frame ranges do not cover the whole scan range");
@@ -238,6 +279,15 @@ inline bool LaserScanConverter::allScanCountersMatch(
   });
 }
 
+inline bool LaserScanConverter::allScannerIdsMatch(
+    const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs)
+{
+  const auto scanner_id = stamped_msgs[0].msg_.scannerId();
+  return std::all_of(stamped_msgs.begin(), stamped_msgs.end(), [scanner_id](const auto& stamped_msg) {
+    return stamped_msg.msg_.scannerId() == scanner_id;
+  });
+}
+
 inline bool LaserScanConverter::thetaAnglesFitTogether(
     const std::vector<data_conversion_layer::monitoring_frame::MessageStamped>& stamped_msgs,
     const std::vector<int>& sorted_filled_stamped_msgs_indices)
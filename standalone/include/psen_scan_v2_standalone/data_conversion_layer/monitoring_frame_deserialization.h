@@ -149,7 +149,7 @@ monitoring_frame::Message deserialize(const data_conversion_layer::RawData& data
 FixedFields readFixedFields(std::istream& is);
 namespace diagnostic
 {
-std::vector<diagnostic::Message> deserializeMessages(std::istream& is);
+ErrorMask deserializeErrors(std::istream& is);
 }
 
 namespace io
@@ -75,8 +75,16 @@ public:
   const std::vector<double>& measurements() const;
   //! @throw AdditionalFieldMissing if intensities were missing during deserialization of a Message.
   const std::vector<double>& intensities() const;
-  //! @throw AdditionalFieldMissing if diagnostic_messages were missing during deserialization of a Message.
+  /**
+   * @brief Expands the diagnostic error bits to one diagnostic::Message per error.
+   *
+   * Prefer diagnosticErrors() for checking for errors or changes, it does not allocate.
+   *
+   * @throw AdditionalFieldMissing if diagnostic_messages were missing during deserialization of a Message.
+   */
   std::vector<diagnostic::Message> diagnosticMessages() const;
+  //! @throw AdditionalFieldMissing if diagnostic_messages were missing during deserialization of a Message.
+  const diagnostic::ErrorMask& diagnosticErrors() const;
 
   bool hasScanCounterField() const;
   bool hasActiveZonesetField() const;
@@ -96,7 +104,7 @@ private:
   boost::optional<io::PinData> io_pin_data_;
   boost::optional<std::vector<double>> measurements_;
   boost::optional<std::vector<double>> intensities_;
-  boost::optional<std::vector<diagnostic::Message>> diagnostic_messages_;
+  boost::optional<diagnostic::ErrorMask> diagnostic_errors_;
 
 public:
   friend class MessageBuilder;
@@ -45,6 +45,7 @@ public:
   MessageBuilder& activeZoneset(uint8_t active_zoneset);
   MessageBuilder& intensities(const std::vector<double>& intensities);
   MessageBuilder& diagnosticMessages(const std::vector<diagnostic::Message>& diagnostic_messages);
+  MessageBuilder& diagnosticErrors(const diagnostic::ErrorMask& diagnostic_errors);
   MessageBuilder& iOPinData(const io::PinData& io_pin_data);
 
 private:
@@ -105,7 +106,13 @@ inline MessageBuilder& MessageBuilder::intensities(const std::vector<double>& in
 
 inline MessageBuilder& MessageBuilder::diagnosticMessages(const std::vector<diagnostic::Message>& diagnostic_messages)
 {
-  msg_.diagnostic_messages_ = diagnostic_messages;
+  msg_.diagnostic_errors_ = diagnostic::ErrorMask(diagnostic_messages);
+  return *this;
+}
+
+inline MessageBuilder& MessageBuilder::diagnosticErrors(const diagnostic::ErrorMask& diagnostic_errors)
+{
+  msg_.diagnostic_errors_ = diagnostic_errors;
   return *this;
 }
 
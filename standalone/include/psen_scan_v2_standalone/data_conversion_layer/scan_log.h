@@ -0,0 +1,221 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_SCAN_LOG_H
+#define PSEN_SCAN_V2_STANDALONE_SCAN_LOG_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/optional.hpp>
+
+#include "psen_scan_v2_standalone/data_conversion_layer/io_pin_data.h"
+#include "psen_scan_v2_standalone/laserscan.h"
+
+namespace psen_scan_v2_standalone
+{
+namespace data_conversion_layer
+{
+/**
+ * @brief Contains a compact file format for streams of laser scans.
+ *
+ * A scan log starts with the MAGIC and the VERSION. It is followed by blocks of consecutive scans, each consisting of
+ * a BlockHeader and the encoded scans. The file ends with the block index (one BlockHeader per block together with
+ * its file offset) and an IndexTrailer, which allows to seek to a timestamp without decoding the preceding blocks.
+ *
+ * Within a block every scan is encoded relative to its predecessor:
+ * - the timestamp and the scan counter as differences,
+ * - resolution, scan angles, active zoneset and the pin data of the I/O states only if they changed,
+ * - distances in millimeters and intensities as differences to the previous value of the same scan.
+ * All differences are zigzag encoded. The differences of distances and intensities are bit packed in groups of 16
+ * values, each group using the bit width of its largest difference. A smooth contour with a few millimeters of noise
+ * therefore takes less than one byte per distance and a run of measurements without signal takes no bits at all.
+ * All other numbers are variable length integers.
+ * The first scan of a block is encoded relative to nothing, therefore every block can be decoded on its own.
+ *
+ * Fixed size numbers are written in the byte order of the host (little endian on all supported platforms).
+ * If the writing process is killed, the block index is missing; the Reader then rebuilds it from the block headers.
+ */
+namespace scan_log
+{
+static constexpr std::array<char, 8> MAGIC{ { 'P', 'S', 'E', 'N', 'L', 'O', 'G', '\0' } };
+static constexpr uint32_t VERSION{ 1 };
+static constexpr std::size_t FILE_HEADER_SIZE{ sizeof(MAGIC) + sizeof(VERSION) };
+static constexpr std::array<char, 8> INDEX_MAGIC{ { 'P', 'S', 'E', 'N', 'I', 'D', 'X', '\0' } };
+static constexpr uint32_t BLOCK_MAGIC{ 0x4B4C4250 };  // "PBLK"
+static const std::string FILE_EXTENSION{ ".psenlog" };
+
+//! Default number of scans per block. Seeking decodes at most this many scans.
+static constexpr std::size_t DEFAULT_SCANS_PER_BLOCK{ 100 };
+//! Encoded distance of measurements without a (valid) signal.
+static constexpr uint16_t NO_SIGNAL{ 0xFFFF };
+
+struct BlockHeader
+{
+  uint32_t magic{ BLOCK_MAGIC };
+  uint32_t num_scans{ 0 };
+  uint64_t payload_size{ 0 };
+  int64_t first_timestamp{ 0 };
+  int64_t last_timestamp{ 0 };
+};
+
+struct IndexEntry
+{
+  BlockHeader header;
+  //! Position of the BlockHeader in the file.
+  uint64_t offset{ 0 };
+};
+
+struct IndexTrailer
+{
+  uint64_t index_offset{ 0 };
+  uint64_t num_blocks{ 0 };
+  std::array<char, 8> magic{ INDEX_MAGIC };
+};
+
+/**
+ * @brief Exception thrown if a file is no valid scan log.
+ */
+class ReadError : public std::runtime_error
+{
+public:
+  ReadError(const std::string& msg);
+};
+
+/**
+ * @brief Encoding state shared by Writer and Reader, reset at the start of every block.
+ */
+struct CodecState
+{
+  int64_t timestamp{ 0 };
+  uint32_t scan_counter{ 0 };
+  boost::optional<std::array<int16_t, 3>> geometry;
+  boost::optional<uint8_t> active_zoneset;
+  boost::optional<monitoring_frame::io::PinData> pin_data;
+};
+
+/**
+ * @brief Appends laser scans to a scan log.
+ *
+ * write() only encodes into memory. A block is written to the file once it is full, so the caller is blocked by a
+ * single write per block. Not thread-safe.
+ */
+class Writer
+{
+public:
+  //! @throws std::runtime_error if the file cannot be created.
+  Writer(const std::string& file_path, const std::size_t& scans_per_block = DEFAULT_SCANS_PER_BLOCK);
+  //! Calls close().
+  ~Writer();
+  Writer(const Writer&) = delete;
+  Writer& operator=(const Writer&) = delete;
+
+public:
+  /**
+   * @throws std::out_of_range if a distance is not within [0, 65.534] m (except for infinity) or an intensity is not
+   * within [0, 65535]. The scan is not written in this case.
+   */
+  void write(const LaserScan& scan);
+  //! Writes the last block and the block index. Further scans cannot be written.
+  void close();
+  //! @returns the number of bytes written to the file so far.
+  std::size_t numBytesWritten() const;
+
+private:
+  void encode(const LaserScan& scan, CodecState& state, std::vector<char>& out) const;
+  void flushBlock();
+  void writeToFile(const void* data, const std::size_t& size);
+
+private:
+  const std::string file_path_;
+  const std::size_t scans_per_block_;
+  std::FILE* file_{ nullptr };
+  std::size_t num_bytes_written_{ 0 };
+  CodecState state_;
+  BlockHeader block_header_;
+  std::vector<char> block_;
+  std::vector<char> scan_buffer_;
+  std::vector<IndexEntry> index_;
+};
+
+/**
+ * @brief Reads a scan log via a read-only memory mapping.
+ */
+class Reader
+{
+public:
+  //! @throws ReadError if the file cannot be mapped or does not start with a valid file header.
+  explicit Reader(const std::string& file_path);
+
+public:
+  /**
+   * @returns the next scan or boost::none if there are no more scans.
+   * @throws ReadError if a block is corrupted.
+   */
+  boost::optional<LaserScan> read();
+  /**
+   * @brief Positions the reader at the first scan whose timestamp is not older than the specified one.
+   *
+   * Only the block containing the scan is decoded. Assumes the timestamps to be increasing.
+   */
+  void seek(const int64_t& timestamp);
+  //! Positions the reader at the first scan.
+  void rewind();
+
+  std::size_t numScans() const;
+  std::size_t numBlocks() const;
+  //! @returns the timestamp of the first scan or 0 if the log is empty.
+  int64_t firstTimestamp() const;
+  //! @returns the timestamp of the last scan or 0 if the log is empty.
+  int64_t lastTimestamp() const;
+
+private:
+  bool readIndex();
+  void rebuildIndex();
+  void enterBlock(const std::size_t& block);
+  LaserScan decode();
+
+private:
+  const std::string file_path_;
+  boost::interprocess::file_mapping file_;
+  boost::interprocess::mapped_region region_;
+  const char* data_{ nullptr };
+  std::size_t size_{ 0 };
+  std::vector<IndexEntry> index_;
+
+  std::size_t block_{ 0 };
+  std::size_t scan_in_block_{ 0 };
+  const char* pos_{ nullptr };
+  const char* block_end_{ nullptr };
+  CodecState state_;
+  boost::optional<LaserScan> pending_;
+};
+
+inline ReadError::ReadError(const std::string& msg) : std::runtime_error(msg)
+{
+}
+
+}  // namespace scan_log
+}  // namespace data_conversion_layer
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_SCAN_LOG_H
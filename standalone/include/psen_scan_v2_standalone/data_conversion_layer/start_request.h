@@ -18,6 +18,7 @@
 #include <array>
 #include <cstdint>
 
+#include "psen_scan_v2_standalone/configuration/scanner_ids.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/raw_scanner_data.h"
 #include "psen_scan_v2_standalone/scan_range.h"
 #include "psen_scan_v2_standalone/util/tenth_of_degree.h"
@@ -62,6 +63,8 @@ private:
   public:
     constexpr const ScanRange& scanRange() const;
     constexpr util::TenthOfDegree resolution() const;
+    //! @returns false for the default constructed settings of a device which is not enabled.
+    constexpr bool enabled() const;
 
   private:
     const ScanRange scan_range_{ ScanRange::createInvalidScanRange() };
@@ -88,6 +91,10 @@ private:
 private:
   static constexpr std::size_t NUM_SUBSCRIBERS{ 3 };
 
+private:
+  static LaserScanSettings subscriberSettings(const ScannerConfiguration& scanner_configuration,
+                                              const configuration::ScannerId& id);
+
 private:
   const uint32_t host_ip_;  ///< network byte order = big endian
   const uint16_t host_udp_port_data_;
@@ -114,6 +121,11 @@ constexpr util::TenthOfDegree Message::LaserScanSettings::resolution() const
   return resolution_;
 };
 
+constexpr bool Message::LaserScanSettings::enabled() const
+{
+  return resolution_ != util::TenthOfDegree(0);
+};
+
 constexpr Message::DeviceSettings::DeviceSettings(const bool diagnostics_enabled, const bool intensities_enabled)
   : diagnostics_enabled_(diagnostics_enabled), intensities_enabled_(intensities_enabled)
 {
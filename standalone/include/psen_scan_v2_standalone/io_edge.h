@@ -0,0 +1,140 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_IO_EDGE_H
+#define PSEN_SCAN_V2_STANDALONE_IO_EDGE_H
+
+#include <cstdint>
+#include <functional>
+
+#include "psen_scan_v2_standalone/io_state.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/io_constants.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/io_pin_data.h"
+
+namespace psen_scan_v2_standalone
+{
+//! @brief Represents the change of a single I/O pin between two consecutive monitoring frames.
+class IOEdge
+{
+public:
+  enum class Direction
+  {
+    rising,
+    falling
+  };
+
+  enum class PinType
+  {
+    input,
+    output
+  };
+
+public:
+  /**
+   * @param pin The changed pin containing its new state.
+   * @param pin_type Defines if the pin is a (logical) input or an output pin.
+   * @param timestamp Time[ns] of the monitoring frame in which the change was detected.
+   */
+  IOEdge(const PinStateView& pin, PinType pin_type, int64_t timestamp)
+    : pin_(pin), pin_type_(pin_type), timestamp_(timestamp)
+  {
+  }
+  const PinStateView& pin() const
+  {
+    return pin_;
+  }
+  PinType pinType() const
+  {
+    return pin_type_;
+  }
+  Direction direction() const
+  {
+    return pin_.state() ? Direction::rising : Direction::falling;
+  }
+  //! @return time[ns] of the monitoring frame in which the change was detected.
+  int64_t timestamp() const
+  {
+    return timestamp_;
+  }
+
+private:
+  PinStateView pin_;
+  PinType pin_type_;
+  int64_t timestamp_;
+};
+
+//! @brief Represents the user-provided callback for processing I/O edges.
+using IOEdgeCallback = std::function<void(const IOEdge&)>;
+
+/**
+ * @brief Selects the I/O pins for which edges are reported.
+ *
+ * Example:
+ * @code
+ * IOEdgeFilter().input(LogicalInputType::zone_sw_1).output(OutputType::safe_1_int);
+ * @endcode
+ */
+class IOEdgeFilter
+{
+public:
+  using LogicalInputType = data_conversion_layer::monitoring_frame::io::LogicalInputType;
+  using OutputType = data_conversion_layer::monitoring_frame::io::OutputType;
+
+public:
+  //! @return filter selecting all used input and output pins.
+  static IOEdgeFilter all()
+  {
+    IOEdgeFilter filter;
+    filter.input_mask_ = data_conversion_layer::monitoring_frame::io::USED_INPUT_BITS_MASK;
+    filter.output_mask_ = data_conversion_layer::monitoring_frame::io::USED_OUTPUT_BITS_MASK;
+    return filter;
+  }
+
+  //! @brief Adds all pins of the given logical input type.
+  IOEdgeFilter& input(const LogicalInputType& type)
+  {
+    input_mask_ |= data_conversion_layer::monitoring_frame::io::bitsMaskOfType(
+        data_conversion_layer::monitoring_frame::io::LOGICAL_INPUT_BITS, type);
+    return *this;
+  }
+
+  //! @brief Adds all pins of the given output type.
+  IOEdgeFilter& output(const OutputType& type)
+  {
+    output_mask_ |= data_conversion_layer::monitoring_frame::io::bitsMaskOfType(
+        data_conversion_layer::monitoring_frame::io::OUTPUT_BITS, type);
+    return *this;
+  }
+
+  //! @return bitmask containing a set bit for every selected input pin (bit position = pin id).
+  uint64_t inputMask() const
+  {
+    return input_mask_ & data_conversion_layer::monitoring_frame::io::USED_INPUT_BITS_MASK;
+  }
+
+  //! @return bitmask containing a set bit for every selected output pin (bit position = pin id).
+  uint64_t outputMask() const
+  {
+    return output_mask_ & data_conversion_layer::monitoring_frame::io::USED_OUTPUT_BITS_MASK;
+  }
+
+private:
+  uint64_t input_mask_{ 0 };
+  uint64_t output_mask_{ 0 };
+};
+
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_IO_EDGE_H
@@ -16,8 +16,11 @@
 #ifndef PSEN_SCAN_V2_STANDALONE_IO_STATE_H
 #define PSEN_SCAN_V2_STANDALONE_IO_STATE_H
 
+#include <bitset>
 #include <cstdint>
+#include <iterator>
 #include <ostream>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -72,6 +75,170 @@ inline std::string formatPinStates(const std::vector<PinState>& pins)
   return strstr.str();
 }
 
+//! @brief Non-owning representation of a single I/O pin. The name refers to a static name table.
+class PinStateView
+{
+public:
+  PinStateView(uint32_t pin_id, const std::string& name, bool state) : id_(pin_id), name_(&name), state_(state)
+  {
+  }
+  uint32_t id() const
+  {
+    return id_;
+  }
+  const std::string& name() const
+  {
+    return *name_;
+  }
+  bool state() const
+  {
+    return state_;
+  }
+  //! @return owning copy of the pin.
+  PinState toPinState() const
+  {
+    return { id_, *name_, state_ };
+  }
+
+private:
+  uint32_t id_;
+  const std::string* name_;
+  bool state_;
+};
+
+/**
+ * @brief Range over the pins that changed between two I/O records.
+ *
+ * Only the raw bitmasks are stored, the PinStateViews are created on the fly while iterating.
+ * Therefore no memory is allocated and the range stays valid independently of the compared IOStates.
+ */
+class ChangedPinStates
+{
+public:
+  class Iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = PinStateView;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const PinStateView*;
+    using reference = PinStateView;
+
+    Iterator(uint64_t remaining_changes,
+             uint64_t states,
+             const data_conversion_layer::monitoring_frame::io::PinNameTable* names)
+      : remaining_changes_(remaining_changes), states_(states), names_(names)
+    {
+    }
+    PinStateView operator*() const
+    {
+      const uint32_t pin_id{ lowestSetBit(remaining_changes_) };
+      return { pin_id, *(*names_)[pin_id], ((states_ >> pin_id) & 1U) == 1U };
+    }
+    Iterator& operator++()
+    {
+      remaining_changes_ &= remaining_changes_ - 1;
+      return *this;
+    }
+    Iterator operator++(int)
+    {
+      Iterator tmp{ *this };
+      ++(*this);
+      return tmp;
+    }
+    bool operator==(const Iterator& other) const
+    {
+      return remaining_changes_ == other.remaining_changes_;
+    }
+    bool operator!=(const Iterator& other) const
+    {
+      return !operator==(other);
+    }
+
+  private:
+    static uint32_t lowestSetBit(uint64_t mask)
+    {
+      uint32_t pos{ 0 };
+      for (; (mask & 1U) == 0U; mask >>= 1)
+      {
+        ++pos;
+      }
+      return pos;
+    }
+
+    uint64_t remaining_changes_;
+    uint64_t states_;
+    const data_conversion_layer::monitoring_frame::io::PinNameTable* names_;
+  };
+
+  /**
+   * @param changed_pins Bitmask with a bit set for every changed pin (bit position = pin id).
+   * @param states Bitmask containing the new states of all pins.
+   * @param names Table mapping the pin id to the name of the pin.
+   */
+  ChangedPinStates(uint64_t changed_pins,
+                   uint64_t states,
+                   const data_conversion_layer::monitoring_frame::io::PinNameTable& names)
+    : changed_pins_(changed_pins), states_(states), names_(&names)
+  {
+  }
+  Iterator begin() const
+  {
+    return { changed_pins_, states_, names_ };
+  }
+  Iterator end() const
+  {
+    return { 0, states_, names_ };
+  }
+  bool empty() const
+  {
+    return changed_pins_ == 0;
+  }
+  std::size_t size() const
+  {
+    return std::bitset<64>(changed_pins_).count();
+  }
+  //! @return owning copies of all changed pins.
+  std::vector<PinState> toPinStates() const
+  {
+    std::vector<PinState> pin_states;
+    pin_states.reserve(size());
+    for (const auto& pin : *this)
+    {
+      pin_states.emplace_back(pin.toPinState());
+    }
+    return pin_states;
+  }
+
+private:
+  uint64_t changed_pins_;
+  uint64_t states_;
+  const data_conversion_layer::monitoring_frame::io::PinNameTable* names_;
+};
+
+//! @brief Formats a PinStateView just using its name and state. (e.g. Safety 1 intrusion = true)
+inline std::string formatPinState(const PinStateView& pin)
+{
+  return fmt::format("{} = {}", pin.name(), pin.state());
+}
+
+//! @brief Formats a range of changed pins.
+inline std::string formatPinStates(const ChangedPinStates& pins)
+{
+  std::stringstream strstr;
+  strstr << "{";
+  for (auto it = pins.begin(); it != pins.end();)
+  {
+    strstr << formatPinState(*it);
+    if (++it != pins.end())
+    {
+      strstr << ", ";
+    }
+  }
+  strstr << "}";
+  return strstr.str();
+}
+
 //! @brief Represents the set of all I/Os of the scanner and their states.
 class IOState
 {
@@ -84,6 +251,8 @@ public:
   std::vector<PinState> output() const;
   //! @return time[ns] of the monitoring frame this state is linked to.
   int64_t timestamp() const;
+  //! @return the raw pin bytes as received from the scanner.
+  const data_conversion_layer::monitoring_frame::io::PinData& pinData() const;
   /**
    * @param ref_state another IOState that is used as reference for the changed state calculation.
    * @return std::vector<PinState> containing a PinState for every changed input pin.
@@ -94,6 +263,22 @@ public:
    * @return std::vector<PinState> containing a PinState for every changed output pin.
    */
   std::vector<PinState> changedOutputStates(const IOState& ref_state) const;
+  /**
+   * @brief Allocation free variant of changedInputStates().
+   *
+   * If nothing changed this boils down to a comparison of the raw pin bytes.
+   *
+   * @param ref_state another IOState that is used as reference for the changed state calculation.
+   * @return ChangedPinStates range containing a PinStateView for every changed input pin.
+   */
+  ChangedPinStates changedInputPins(const IOState& ref_state) const;
+  /**
+   * @brief Allocation free variant of changedOutputStates().
+   *
+   * @param ref_state another IOState that is used as reference for the changed state calculation.
+   * @return ChangedPinStates range containing a PinStateView for every changed output pin.
+   */
+  ChangedPinStates changedOutputPins(const IOState& ref_state) const;
 
   bool operator==(const IOState& io_state) const;
   bool operator!=(const IOState& io_state) const;
@@ -20,6 +20,7 @@
 #include <ostream>
 #include <vector>
 
+#include "psen_scan_v2_standalone/configuration/scanner_ids.h"
 #include "psen_scan_v2_standalone/io_state.h"
 #include "psen_scan_v2_standalone/util/tenth_of_degree.h"
 
@@ -39,6 +40,7 @@ namespace psen_scan_v2_standalone
  * - ID of the currently active zoneset.
  * - Time of the first scan ray.
  * - All states of the I/O pins recorded during the scan.
+ * - ID of the scanner device (master or subscriber) which recorded the scan.
  *
  * The measures use the target frame defined as \<tf_prefix\>.
  * @see https://github.com/PilzDE/psen_scan_v2_standalone/blob/main/README.md#tf-frames
@@ -56,7 +58,8 @@ public:
             const util::TenthOfDegree& max_scan_angle,
             const uint32_t scan_counter,
             const uint8_t active_zoneset,
-            const int64_t timestamp);
+            const int64_t timestamp,
+            const configuration::ScannerId scanner_id = configuration::ScannerId::master);
 
 public:
   /*! deprecated: use const util::TenthOfDegree& scanResolution() const instead */
@@ -86,6 +89,8 @@ public:
   [[deprecated("use int64_t timestamp() const instead")]] int64_t getTimestamp() const;
   int64_t timestamp() const;
 
+  configuration::ScannerId scannerId() const;
+
   /*! deprecated: use const MeasurementData& measurements() instead */
   [[deprecated("use const MeasurementData& measurements() const instead")]] const MeasurementData&
   getMeasurements() const;
@@ -136,6 +141,8 @@ private:
   const uint8_t active_zoneset_;
   //! Time of the first ray in this scan round (or fragment if fragmented_scans is enabled).
   const int64_t timestamp_;
+  //! The scanner device (master or one of the subscribers) which recorded the scan.
+  const configuration::ScannerId scanner_id_;
 };
 
 std::ostream& operator<<(std::ostream& os, const LaserScan& scan);
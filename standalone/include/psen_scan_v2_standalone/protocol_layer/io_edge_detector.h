@@ -0,0 +1,139 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_IO_EDGE_DETECTOR_H
+#define PSEN_SCAN_V2_STANDALONE_IO_EDGE_DETECTOR_H
+
+#include <cstdint>
+
+#include <boost/optional.hpp>
+
+#include "psen_scan_v2_standalone/io_edge.h"
+#include "psen_scan_v2_standalone/io_state.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/io_pin_data.h"
+
+namespace psen_scan_v2_standalone
+{
+namespace protocol_layer
+{
+/**
+ * @brief Detects rising and falling edges of the I/O pins in consecutive monitoring frames.
+ *
+ * The raw pin data of every frame is compared with the one of the previous frame. The user is informed via
+ * IOEdgeCallback about every changed pin selected by the IOEdgeFilter. Frames from an earlier scan round than the
+ * reference frame are ignored.
+ *
+ * If no callback is set, the detector does nothing.
+ */
+class IOEdgeDetector
+{
+public:
+  IOEdgeDetector(const IOEdgeCallback& callback, const IOEdgeFilter& filter);
+
+  /**
+   * @brief Compares the pin data with the one of the last frame and informs the user about all detected edges.
+   *
+   * The first frame after construction or reset() only serves as reference.
+   *
+   * @param pin_data The I/O pin data of the received monitoring frame.
+   * @param scan_counter The scan counter of the received monitoring frame.
+   * @param timestamp Time[ns] of the received monitoring frame.
+   */
+  void update(const data_conversion_layer::monitoring_frame::io::PinData& pin_data,
+              uint32_t scan_counter,
+              int64_t timestamp);
+
+  //! @brief Forgets the reference frame. Has to be called whenever there is an expected brake in receiving frames.
+  void reset();
+
+private:
+  void notifyEdges(uint64_t new_bits,
+                   uint64_t old_bits,
+                   uint64_t selected_bits,
+                   const data_conversion_layer::monitoring_frame::io::PinNameTable& names,
+                   IOEdge::PinType pin_type,
+                   int64_t timestamp) const;
+
+private:
+  const IOEdgeCallback callback_;
+  const IOEdgeFilter filter_;
+  boost::optional<data_conversion_layer::monitoring_frame::io::PinData> last_pin_data_{};
+  uint32_t last_scan_counter_{ 0 };
+};
+
+inline IOEdgeDetector::IOEdgeDetector(const IOEdgeCallback& callback, const IOEdgeFilter& filter)
+  : callback_(callback), filter_(filter)
+{
+}
+
+inline void IOEdgeDetector::update(const data_conversion_layer::monitoring_frame::io::PinData& pin_data,
+                                   uint32_t scan_counter,
+                                   int64_t timestamp)
+{
+  if (!callback_)
+  {
+    return;
+  }
+  if (last_pin_data_.is_initialized())
+  {
+    if (scan_counter < last_scan_counter_)
+    {
+      return;
+    }
+    if (pin_data == last_pin_data_.get())
+    {
+      last_scan_counter_ = scan_counter;
+      return;
+    }
+    notifyEdges(data_conversion_layer::monitoring_frame::io::toBitmask(pin_data.input_state),
+                data_conversion_layer::monitoring_frame::io::toBitmask(last_pin_data_->input_state),
+                filter_.inputMask(),
+                data_conversion_layer::monitoring_frame::io::inputNameTable(),
+                IOEdge::PinType::input,
+                timestamp);
+    notifyEdges(data_conversion_layer::monitoring_frame::io::toBitmask(pin_data.output_state),
+                data_conversion_layer::monitoring_frame::io::toBitmask(last_pin_data_->output_state),
+                filter_.outputMask(),
+                data_conversion_layer::monitoring_frame::io::outputNameTable(),
+                IOEdge::PinType::output,
+                timestamp);
+  }
+  last_pin_data_ = pin_data;
+  last_scan_counter_ = scan_counter;
+}
+
+inline void IOEdgeDetector::reset()
+{
+  last_pin_data_ = boost::none;
+  last_scan_counter_ = 0;
+}
+
+inline void IOEdgeDetector::notifyEdges(uint64_t new_bits,
+                                        uint64_t old_bits,
+                                        uint64_t selected_bits,
+                                        const data_conversion_layer::monitoring_frame::io::PinNameTable& names,
+                                        IOEdge::PinType pin_type,
+                                        int64_t timestamp) const
+{
+  for (const auto& pin : ChangedPinStates((new_bits ^ old_bits) & selected_bits, new_bits, names))
+  {
+    callback_(IOEdge(pin, pin_type, timestamp));
+  }
+}
+
+}  // namespace protocol_layer
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_IO_EDGE_DETECTOR_H
@@ -16,6 +16,7 @@
 #define PSEN_SCAN_V2_STANDALONE_EVENTS_H
 
 #include "psen_scan_v2_standalone/data_conversion_layer/raw_scanner_data.h"
+#include "psen_scan_v2_standalone/scanner_configuration.h"
 
 namespace psen_scan_v2_standalone
 {
@@ -39,11 +40,28 @@ class StopRequest
 {
 };
 
+//! @brief User requests the running scanner to restart with changed scan settings.
+class ReconfigureRequest
+{
+public:
+  ReconfigureRequest(const ScannerConfiguration& config) : config_(config)
+  {
+  }
+
+public:
+  const ScannerConfiguration config_;
+};
+
 //! @brief Timeout while waiting for scanner device to start.
 class StartTimeout
 {
 };
 
+//! @brief Timeout while waiting for scanner device to stop for a reconfiguration.
+class RestartStopTimeout
+{
+};
+
 //! @brief Received Start- or Stop-Reply message from scanner device.
 class RawReplyReceived
 {
@@ -15,16 +15,18 @@
 #ifndef PSEN_SCAN_V2_STANDALONE_SCANNER_PROTOCOL_DEF_H
 #define PSEN_SCAN_V2_STANDALONE_SCANNER_PROTOCOL_DEF_H
 
+#include <array>
 #include <functional>
 #include <string>
 #include <memory>
 #include <mutex>
 #include <chrono>
+#include <cstdint>
 #include <stdexcept>
 #include <vector>
 #include <boost/optional.hpp>
 
-#define BOOST_MSM_CONSTRUCTOR_ARG_SIZE 12  // see https://www.boost.org/doc/libs/1_66_0/libs/msm/doc/HTML/ch03s05.html
+#define BOOST_MSM_CONSTRUCTOR_ARG_SIZE 16  // see https://www.boost.org/doc/libs/1_66_0/libs/msm/doc/HTML/ch03s05.html
 
 // back-end
 #include <boost/msm/back/state_machine.hpp>
@@ -33,6 +35,8 @@
 
 #include <boost/msm/back/tools.hpp>
 #include <boost/msm/back/metafunctions.hpp>
+// mpl::vector is limited to 20 elements, the numbered form mpl::vectorN requires exactly N transitions.
+#include <boost/mpl/vector/vector30.hpp>
 
 #include "psen_scan_v2_standalone/protocol_layer/scanner_events.h"
 
@@ -41,7 +45,9 @@
 #include "psen_scan_v2_standalone/util/ip_conversion.h"
 #include "psen_scan_v2_standalone/communication_layer/udp_client.h"
 
+#include "psen_scan_v2_standalone/io_edge.h"
 #include "psen_scan_v2_standalone/laserscan.h"
+#include "psen_scan_v2_standalone/scan_filter.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/laserscan_conversions.h"
 
 #include "psen_scan_v2_standalone/data_conversion_layer/start_request.h"
@@ -49,10 +55,15 @@
 
 #include "psen_scan_v2_standalone/data_conversion_layer/scanner_reply_msg.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/scanner_reply_serialization_deserialization.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/diagnostics.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_msg.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_deserialization.h"
+#include "psen_scan_v2_standalone/protocol_layer/io_edge_detector.h"
 #include "psen_scan_v2_standalone/protocol_layer/scan_buffer.h"
-#include "psen_scan_v2_standalone/util/watchdog.h"
+#include "psen_scan_v2_standalone/util/hot_path_tracer.h"
+#include "psen_scan_v2_standalone/util/scan_clock_estimator.h"
+#include "psen_scan_v2_standalone/util/timer_service.h"
+#include "psen_scan_v2_standalone/util/timestamp.h"
 
 namespace psen_scan_v2_standalone
 {
@@ -81,6 +92,8 @@ namespace e = psen_scan_v2_standalone::protocol_layer::scanner_events;
 
 static constexpr std::chrono::milliseconds WATCHDOG_TIMEOUT{ 1000 };
 static constexpr uint32_t DEFAULT_NUM_MSG_PER_ROUND{ 6 };
+//! Number of devices sending their monitoring frames through one connection, i.e. the master and its subscribers.
+static constexpr std::size_t NUM_DEVICES{ configuration::VALID_SCANNER_IDS.size() };
 
 using ScannerStartedCallback = std::function<void()>;
 using ScannerStoppedCallback = std::function<void()>;
@@ -88,41 +101,11 @@ using StartErrorCallback = std::function<void(const std::string&)>;
 using StopErrorCallback = std::function<void(const std::string&)>;
 using TimeoutCallback = std::function<void()>;
 using InformUserAboutLaserScanCallback = std::function<void(const LaserScan&)>;
-
-/**
- * @brief Interface to create event timeout callbacks.
- *
- * Implementations of this Interface should create thread save timeout callbacks that
- * call an event every time a defined timeout has run out and restart themselves until deleted.
- *
- * @see util::Watchdog
- */
-class IWatchdogFactory
-{
-public:
-  virtual ~IWatchdogFactory() = default;
-
-public:
-  virtual std::unique_ptr<util::Watchdog> create(const util::Watchdog::Timeout& timeout,
-                                                 const TimeoutCallback& timeout_callback) = 0;
-};
-
-/**
- * @brief Watchdog factory implementation for scanner interaction timeouts
- *
- * Implements the IWatchdogFactory to add behavior to handle specific cases,
- * where the interaction with the scanner hardware takes longer than expected.
- *
- * @see protocol_layer::IWatchdogFactory
- * @see util::Watchdog
- */
-class WatchdogFactory : public IWatchdogFactory
-{
-public:
-  WatchdogFactory() = default;
-  std::unique_ptr<util::Watchdog> create(const util::Watchdog::Timeout& timeout,
-                                         const TimeoutCallback& timeout_callback) override;
-};
+//! @brief Receives the current diagnostic messages of a device whenever they change, an empty vector means that the
+//! device reports no more errors.
+using DiagnosticsCallback =
+    std::function<void(const configuration::ScannerId&,
+                       const std::vector<data_conversion_layer::monitoring_frame::diagnostic::Message>&)>;
 
 // front-end: define the FSM structure
 /**
@@ -134,8 +117,8 @@ public:
  * Precisely, the StateMachineArgs::control_client_ is used for the starting-/stopping procedure and the
  * StateMachineArgs::data_client_ for receiving monitoring frames.
  *
- * It also checks for internal errors of incoming messages and handles timeouts of the above mentioned actions by
- * creating watchdogs via IWatchdogFactory.
+ * It also checks for internal errors of incoming messages and handles timeouts of the above mentioned actions with
+ * timers of the shared util::TimerService.
  *
  * @see data_conversion_layer::start_request::Message
  * @see data_conversion_layer::stop_request
@@ -156,13 +139,31 @@ public:
                      const ScannerStoppedCallback& scanner_stopped_callback,
                      const InformUserAboutLaserScanCallback& laser_scan_callback,
                      const TimeoutCallback& start_timeout_callback,
-                     const TimeoutCallback& monitoring_frame_timeout_callback);
+                     const TimeoutCallback& restart_stop_timeout_callback,
+                     const TimeoutCallback& monitoring_frame_timeout_callback,
+                     const IOEdgeCallback& io_edge_callback = IOEdgeCallback(),
+                     const IOEdgeFilter& io_edge_filter = IOEdgeFilter::all(),
+                     const DiagnosticsCallback& diagnostics_callback = DiagnosticsCallback());
+
+public:
+  //! @returns the latency statistics of the monitoring frame processing, which is enabled via the configuration.
+  const util::HotPathTracer& hotPathTracer() const;
+  //! @returns the model of the scanner clock of the specified device, which is only used if enabled via the
+  //! configuration.
+  const util::ScanClockEstimator& scanClockEstimator(
+      const psen_scan_v2_standalone::configuration::ScannerId& id =
+          psen_scan_v2_standalone::configuration::ScannerId::master) const;
+  //! @returns the time between the last monitoring frame before and the first one after the last reconfiguration.
+  const boost::optional<std::chrono::nanoseconds>& lastReconfigurationGap() const;
+  //! @returns the filters applied to the laser scans and their timing statistics.
+  const ScanFilterChain& scanFilterChain() const;
 
 public:  // States
   STATE(Idle);
   STATE(WaitForStartReply);
   STATE(WaitForMonitoringFrame);
   STATE(WaitForStopReply);
+  STATE(WaitForRestartStopReply);
   STATE(Stopped);
   STATE(Error);
 
@@ -172,6 +173,8 @@ public:  // Action methods
   void handleStartRequestTimeout(const scanner_events::StartTimeout& event);
   template <class T>
   void sendStopRequest(const T& event);
+  void sendReconfigureStopRequest(const scanner_events::ReconfigureRequest& event);
+  void handleRestartStopRequestTimeout(const scanner_events::RestartStopTimeout& event);
   void handleMonitoringFrame(const scanner_events::RawMonitoringFrameReceived& event);
   void handleMonitoringFrameTimeout(const scanner_events::MonitoringFrameTimeout& event);
   void notifyUserAboutStart(scanner_events::RawReplyReceived const& reply_event);
@@ -208,7 +211,7 @@ public:  // Definition of state machine via table
   /**
    * @brief Table describing the state machine which is specified in the scanner protocol.
    */
-  struct transition_table : mpl::vector<  // NOLINT
+  struct transition_table : mpl::vector22<  // NOLINT
       //    Start                         Event                         Next                        Action                        Guard
       //  +------------------------------+----------------------------+---------------------------+--------------------------------------+-------------------------+
       a_row  < Idle,                      e::StartRequest,              WaitForStartReply,          &m::sendStartRequest                                           >,
@@ -221,6 +224,13 @@ public:  // Definition of state machine via table
       a_irow < WaitForMonitoringFrame,    e::MonitoringFrameTimeout,                                &m::handleMonitoringFrameTimeout                               >,
       a_row  < WaitForStartReply,         e::StopRequest,               WaitForStopReply,           &m::sendStopRequest                                            >,
       a_row  < WaitForMonitoringFrame,    e::StopRequest,               WaitForStopReply,           &m::sendStopRequest                                            >,
+      a_row  < WaitForMonitoringFrame,    e::ReconfigureRequest,        WaitForRestartStopReply,    &m::sendReconfigureStopRequest                                 >,
+      _irow  < WaitForRestartStopReply,   e::RawMonitoringFrameReceived                                                                                            >,
+      a_irow < WaitForRestartStopReply,   e::RestartStopTimeout,                                    &m::handleRestartStopRequestTimeout                            >,
+      row    < WaitForRestartStopReply,   e::RawReplyReceived,          WaitForStartReply,          &m::sendStartRequest,                 &m::isAcceptedStopReply  >,
+      row    < WaitForRestartStopReply,   e::RawReplyReceived,          Error,                      &m::notifyUserAboutRefusedStopReply,  &m::isRefusedStopReply   >,
+      row    < WaitForRestartStopReply,   e::RawReplyReceived,          Error,                      &m::notifyUserAboutUnknownStopReply,  &m::isUnknownStopReply   >,
+      a_row  < WaitForRestartStopReply,   e::StopRequest,               WaitForStopReply,           &m::sendStopRequest                                            >,
       _irow  < WaitForStopReply,          e::RawMonitoringFrameReceived                                                                                            >,
       row    < WaitForStopReply,          e::RawReplyReceived,          Stopped,                    &m::notifyUserAboutStop,              &m::isAcceptedStopReply  >,
       row    < WaitForStopReply,          e::RawReplyReceived,          Error,                      &m::notifyUserAboutRefusedStopReply,  &m::isRefusedStopReply   >,
@@ -250,18 +260,30 @@ private:
   bool isRefusedReply(data_conversion_layer::scanner_reply::Message const& msg);
 
   void checkForInternalErrors(const data_conversion_layer::scanner_reply::Message& msg);
+  /**
+   * @brief Expands the diagnostic errors to messages only if they differ from the previous frame of the same device.
+   *
+   * The messages are logged and passed to the diagnostics callback on every change. While the errors persist, they
+   * are repeated by a throttled warning.
+   */
   void checkForDiagnosticErrors(const data_conversion_layer::monitoring_frame::Message& msg);
   /**
    * @throws data_conversion_layer::monitoring_frame::AdditionalFieldMissing if scan_counter or active_zoneset is not
    * set.
    */
   void checkForChangedActiveZoneset(const data_conversion_layer::monitoring_frame::Message& msg);
+  /**
+   * @throws data_conversion_layer::monitoring_frame::AdditionalFieldMissing if scan_counter is not set.
+   */
+  void checkForIOEdges(const data_conversion_layer::monitoring_frame::MessageStamped& stamped_msg);
 
   /**
    * @throws data_conversion_layer::monitoring_frame::AdditionalFieldMissing if scan_counter, active_zoneset or
    * measurements is not set.
    */
   void informUserAboutTheScanData(const data_conversion_layer::monitoring_frame::MessageStamped& stamped_msg);
+  //! @returns the index of the device specific members like the scan buffers.
+  static std::size_t deviceIndex(const psen_scan_v2_standalone::configuration::ScannerId& id);
   /**
    * @throws data_conversion_layer::monitoring_frame::AdditionalFieldMissing if scan_counter, active_zoneset or
    * measurements is not set in one of the msgs.
@@ -278,11 +300,30 @@ private:
 private:
   ScannerConfiguration config_;
 
-  std::unique_ptr<util::Watchdog> start_reply_watchdog_{};
-
-  std::unique_ptr<util::Watchdog> monitoring_frame_watchdog_{};
-  ScanBuffer scan_buffer_{ DEFAULT_NUM_MSG_PER_ROUND };
+  //! One scan buffer per device, because the frames of the master and the subscribers arrive interleaved.
+  std::array<ScanBuffer, NUM_DEVICES> scan_buffers_{ { ScanBuffer{ DEFAULT_NUM_MSG_PER_ROUND },
+                                                       ScanBuffer{ DEFAULT_NUM_MSG_PER_ROUND },
+                                                       ScanBuffer{ DEFAULT_NUM_MSG_PER_ROUND },
+                                                       ScanBuffer{ DEFAULT_NUM_MSG_PER_ROUND } } };
+  IOEdgeDetector io_edge_detector_;
+  //! Own diagnostic errors of the last frame of every device, reset on every (re)start to report them again.
+  std::array<boost::optional<data_conversion_layer::monitoring_frame::diagnostic::ErrorMask>, NUM_DEVICES>
+      last_diagnostic_errors_{};
+  //! Last diagnostic messages reported for every device.
+  std::array<std::vector<data_conversion_layer::monitoring_frame::diagnostic::Message>, NUM_DEVICES>
+      last_diagnostic_messages_{};
   boost::optional<data_conversion_layer::monitoring_frame::Message> zoneset_reference_msg_;
+  util::HotPathTracer hot_path_tracer_;
+  ScanFilterChain scan_filter_chain_;
+  //! Receive time of the last monitoring frame.
+  int64_t last_monitoring_frame_timestamp_{ 0 };
+  //! Start of the interruption of the monitoring frames by a pending reconfiguration.
+  boost::optional<int64_t> reconfiguration_gap_start_;
+  boost::optional<std::chrono::nanoseconds> last_reconfiguration_gap_;
+  std::array<util::ScanClockEstimator, NUM_DEVICES> scan_clock_estimators_{ { util::ScanClockEstimator(),
+                                                                              util::ScanClockEstimator(),
+                                                                              util::ScanClockEstimator(),
+                                                                              util::ScanClockEstimator() } };
 
   // Udp Clients
   communication_layer::UdpClientImpl control_client_;
@@ -294,13 +335,13 @@ private:
   const StartErrorCallback start_error_callback_;
   const StopErrorCallback stop_error_callback_;
   const InformUserAboutLaserScanCallback inform_user_about_laser_scan_callback_;
+  const DiagnosticsCallback diagnostics_callback_;
 
   // Timeout Handler
-  const std::function<void()> start_timeout_callback_;
-  const std::function<void()> monitoring_frame_timeout_callback_;
-
-  // Factories
-  WatchdogFactory watchdog_factory_{};
+  // Declared last so that the timers are stopped before any other member is destroyed.
+  util::TimerService::Timer start_reply_timer_;
+  util::TimerService::Timer restart_stop_reply_timer_;
+  util::TimerService::Timer monitoring_frame_timer_;
 };
 
 // Pick a back-end
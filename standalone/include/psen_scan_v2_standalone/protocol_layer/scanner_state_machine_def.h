@@ -31,8 +31,15 @@ inline ScannerProtocolDef::ScannerProtocolDef(const ScannerConfiguration& config
                                               const ScannerStoppedCallback& scanner_stopped_callback,
                                               const InformUserAboutLaserScanCallback& laser_scan_callback,
                                               const TimeoutCallback& start_timeout_callback,
-                                              const TimeoutCallback& monitoring_frame_timeout_callback)
+                                              const TimeoutCallback& restart_stop_timeout_callback,
+                                              const TimeoutCallback& monitoring_frame_timeout_callback,
+                                              const IOEdgeCallback& io_edge_callback,
+                                              const IOEdgeFilter& io_edge_filter,
+                                              const DiagnosticsCallback& diagnostics_callback)
   : config_(config)
+  , io_edge_detector_(io_edge_callback, io_edge_filter)
+  , hot_path_tracer_(config_.hotPathTracingEnabled())
+  , scan_filter_chain_(config_.scanFilters())
   , control_client_(control_msg_callback,
                     control_error_callback,
                     config_.hostUDPPortControl(),  // LCOV_EXCL_LINE Lcov bug?
@@ -42,17 +49,46 @@ inline ScannerProtocolDef::ScannerProtocolDef(const ScannerConfiguration& config
                  data_error_callback,
                  config_.hostUDPPortData(),  // LCOV_EXCL_LINE Lcov bug?
                  config_.clientIp(),
-                 config_.scannerDataPort())
+                 config_.scannerDataPort(),
+                 hot_path_tracer_)
   , scanner_started_callback_(scanner_started_callback)
   , scanner_stopped_callback_(scanner_stopped_callback)
   , start_error_callback_(start_error_callback)
   , stop_error_callback_(stop_error_callback)
   , inform_user_about_laser_scan_callback_(laser_scan_callback)
-  , start_timeout_callback_(start_timeout_callback)
-  , monitoring_frame_timeout_callback_(monitoring_frame_timeout_callback)
+  , diagnostics_callback_(diagnostics_callback)
+  , start_reply_timer_(WATCHDOG_TIMEOUT, start_timeout_callback)
+  , restart_stop_reply_timer_(WATCHDOG_TIMEOUT, restart_stop_timeout_callback)
+  , monitoring_frame_timer_(WATCHDOG_TIMEOUT, monitoring_frame_timeout_callback)
 {
 }
 
+inline const util::HotPathTracer& ScannerProtocolDef::hotPathTracer() const
+{
+  return hot_path_tracer_;
+}
+
+inline const ScanFilterChain& ScannerProtocolDef::scanFilterChain() const
+{
+  return scan_filter_chain_;
+}
+
+inline const util::ScanClockEstimator&
+ScannerProtocolDef::scanClockEstimator(const psen_scan_v2_standalone::configuration::ScannerId& id) const
+{
+  return scan_clock_estimators_.at(deviceIndex(id));
+}
+
+inline const boost::optional<std::chrono::nanoseconds>& ScannerProtocolDef::lastReconfigurationGap() const
+{
+  return last_reconfiguration_gap_;
+}
+
+inline std::size_t ScannerProtocolDef::deviceIndex(const psen_scan_v2_standalone::configuration::ScannerId& id)
+{
+  return static_cast<std::size_t>(id);
+}
+
 //+++++++++++++++++++++++++++++++++ States ++++++++++++++++++++++++++++++++++++
 
 // clang-format off
@@ -92,34 +128,51 @@ template <class Event, class FSM>
 void ScannerProtocolDef::WaitForStartReply::on_entry(Event const& /*unused*/, FSM& fsm)  // NOLINT
 {
   PSENSCAN_DEBUG("StateMachine", "Entering state: WaitForStartReply");
-  // Start watchdog...
-  fsm.start_reply_watchdog_ = fsm.watchdog_factory_.create(WATCHDOG_TIMEOUT, fsm.start_timeout_callback_);
+  fsm.start_reply_timer_.start();
 }
 
 template <class Event, class FSM>
 void ScannerProtocolDef::WaitForStartReply::on_exit(Event const& /*unused*/, FSM& fsm)  // NOLINT
 {
   PSENSCAN_DEBUG("StateMachine", "Exiting state: WaitForStartReply");
-  // Stops the watchdog by resetting the pointer
-  fsm.start_reply_watchdog_.reset();
+  fsm.start_reply_timer_.stop();
+}
+
+template <class Event, class FSM>
+void ScannerProtocolDef::WaitForRestartStopReply::on_entry(Event const& /*unused*/, FSM& fsm)  // NOLINT
+{
+  PSENSCAN_DEBUG("StateMachine", "Entering state: WaitForRestartStopReply");
+  fsm.restart_stop_reply_timer_.start();
+}
+
+template <class Event, class FSM>
+void ScannerProtocolDef::WaitForRestartStopReply::on_exit(Event const& /*unused*/, FSM& fsm)  // NOLINT
+{
+  PSENSCAN_DEBUG("StateMachine", "Exiting state: WaitForRestartStopReply");
+  fsm.restart_stop_reply_timer_.stop();
 }
 
 template <class Event, class FSM>
 void ScannerProtocolDef::WaitForMonitoringFrame::on_entry(Event const& /*unused*/, FSM& fsm)  // NOLINT
 {
   PSENSCAN_DEBUG("StateMachine", "Entering state: WaitForMonitoringFrame");
-  fsm.scan_buffer_.reset();
-  // Start watchdog...
-  fsm.monitoring_frame_watchdog_ =
-      fsm.watchdog_factory_.create(WATCHDOG_TIMEOUT, fsm.monitoring_frame_timeout_callback_);
+  for (auto& scan_buffer : fsm.scan_buffers_)
+  {
+    scan_buffer.reset();
+  }
+  fsm.io_edge_detector_.reset();
+  for (auto& errors : fsm.last_diagnostic_errors_)
+  {
+    errors = boost::none;
+  }
+  fsm.monitoring_frame_timer_.start();
 }
 
 template <class Event, class FSM>
 void ScannerProtocolDef::WaitForMonitoringFrame::on_exit(Event const& /*unused*/, FSM& fsm)  // NOLINT
 {
   PSENSCAN_DEBUG("StateMachine", "Exiting state: WaitForMonitoringFrame");
-  // Stops the watchdog by resetting the pointer
-  fsm.monitoring_frame_watchdog_.reset();
+  fsm.monitoring_frame_timer_.stop();
 }
 
 template <class Event, class FSM>
@@ -168,18 +221,60 @@ inline void ScannerProtocolDef::sendStopRequest(const T& event)
   control_client_.write(data_conversion_layer::stop_request::serialize());
 }
 
+inline void ScannerProtocolDef::sendReconfigureStopRequest(const scanner_events::ReconfigureRequest& event)
+{
+  PSENSCAN_DEBUG("StateMachine", "Action: sendReconfigureStopRequest");
+  // The new configuration is used by the start request sent after the stop reply. The data client keeps receiving,
+  // so that the restart needs neither new sockets nor new threads.
+  config_ = event.config_;
+  reconfiguration_gap_start_ =
+      last_monitoring_frame_timestamp_ != 0 ? last_monitoring_frame_timestamp_ : util::getCurrentTime();
+  control_client_.write(data_conversion_layer::stop_request::serialize());
+}
+
+inline void ScannerProtocolDef::handleRestartStopRequestTimeout(const scanner_events::RestartStopTimeout& event)
+{
+  PSENSCAN_DEBUG("StateMachine", "Action: handleRestartStopRequestTimeout");
+  PSENSCAN_ERROR("StateMachine",
+                 "Timeout while waiting for the scanner to stop for the reconfiguration! Retrying... "
+                 "(Please check the ethernet connection or contact PILZ support if the error persists.)");
+  control_client_.write(data_conversion_layer::stop_request::serialize());
+}
+
 inline void ScannerProtocolDef::handleMonitoringFrame(const scanner_events::RawMonitoringFrameReceived& event)
 {
   PSENSCAN_DEBUG("StateMachine", "Action: handleMonitoringFrame");
-  monitoring_frame_watchdog_->reset();
+  monitoring_frame_timer_.reset();
+  if (reconfiguration_gap_start_)
+  {
+    last_reconfiguration_gap_ = std::chrono::nanoseconds(event.timestamp_ - *reconfiguration_gap_start_);
+    PSENSCAN_INFO("StateMachine",
+                  "Reconfiguration interrupted the monitoring frames for {:.1f} ms.",
+                  std::chrono::duration<double, std::milli>(*last_reconfiguration_gap_).count());
+    reconfiguration_gap_start_ = boost::none;
+  }
+  last_monitoring_frame_timestamp_ = event.timestamp_;
 
   try
   {
     const data_conversion_layer::monitoring_frame::Message msg{ data_conversion_layer::monitoring_frame::deserialize(
         *(event.data_), event.num_bytes_) };
+    hot_path_tracer_.traceDeserialized();
+    if (!config_.deviceEnabled(msg.scannerId()))
+    {
+      PSENSCAN_WARN_THROTTLE(1 /* sec */,
+                             "StateMachine",
+                             "Dropping monitoring frame of {}, which is not enabled.",
+                             psen_scan_v2_standalone::configuration::SCANNER_ID_TO_STRING.at(msg.scannerId()));
+      return;
+    }
     checkForDiagnosticErrors(msg);
-    checkForChangedActiveZoneset(msg);
+    if (msg.scannerId() == psen_scan_v2_standalone::configuration::ScannerId::master)
+    {
+      checkForChangedActiveZoneset(msg);
+    }
     const data_conversion_layer::monitoring_frame::MessageStamped stamped_msg{ msg, event.timestamp_ };
+    checkForIOEdges(stamped_msg);
     informUserAboutTheScanData(stamped_msg);
   }
   // LCOV_EXCL_START
@@ -227,10 +322,47 @@ inline void ScannerProtocolDef::notifyUserAboutRefusedStopReply(scanner_events::
 
 inline void ScannerProtocolDef::checkForDiagnosticErrors(const data_conversion_layer::monitoring_frame::Message& msg)
 {
-  if (msg.hasDiagnosticMessagesField() && !msg.diagnosticMessages().empty())
+  if (!msg.hasDiagnosticMessagesField())
+  {
+    return;
+  }
+
+  // Every frame contains the errors of all devices, only the ones of the sending device are evaluated.
+  const std::size_t device_index{ deviceIndex(msg.scannerId()) };
+  const auto errors{ msg.diagnosticErrors().device(msg.scannerId()) };
+  auto& last_errors{ last_diagnostic_errors_[device_index] };
+  auto& messages{ last_diagnostic_messages_[device_index] };
+  if (last_errors && *last_errors == errors)
   {
-    PSENSCAN_WARN_THROTTLE(
-        1 /* sec */, "StateMachine", "The scanner reports an error: {}", util::formatRange(msg.diagnosticMessages()));
+    if (!messages.empty())
+    {
+      PSENSCAN_WARN_THROTTLE(
+          1 /* sec */, "StateMachine", "The scanner reports an error: {}", util::formatRange(messages));
+    }
+    return;
+  }
+
+  // The first frame after a (re)start reports the errors again, but there is nothing to report without any errors.
+  const bool is_first_frame{ !last_errors };
+  last_errors = errors;
+  if (is_first_frame && errors.none() && messages.empty())
+  {
+    return;
+  }
+  messages = errors.messages();
+  if (messages.empty())
+  {
+    PSENSCAN_INFO("StateMachine",
+                  "The scanner reports no more errors of device {}.",
+                  psen_scan_v2_standalone::configuration::SCANNER_ID_TO_STRING.at(msg.scannerId()));
+  }
+  else
+  {
+    PSENSCAN_WARN("StateMachine", "The scanner reports an error: {}", util::formatRange(messages));
+  }
+  if (diagnostics_callback_)
+  {
+    diagnostics_callback_(msg.scannerId(), messages);
   }
 }
 
@@ -245,15 +377,26 @@ ScannerProtocolDef::checkForChangedActiveZoneset(const data_conversion_layer::mo
   }
 }
 
+inline void
+ScannerProtocolDef::checkForIOEdges(const data_conversion_layer::monitoring_frame::MessageStamped& stamped_msg)
+{
+  if (stamped_msg.msg_.hasIOPinField())
+  {
+    io_edge_detector_.update(stamped_msg.msg_.iOPinData(), stamped_msg.msg_.scanCounter(), stamped_msg.stamp_);
+  }
+}
+
 inline void ScannerProtocolDef::informUserAboutTheScanData(
     const data_conversion_layer::monitoring_frame::MessageStamped& stamped_msg)
 {
+  auto& scan_buffer{ scan_buffers_[deviceIndex(stamped_msg.msg_.scannerId())] };
   try
   {
-    scan_buffer_.add(stamped_msg);
-    if (!config_.fragmentedScansEnabled() && scan_buffer_.isRoundComplete())
+    scan_buffer.add(stamped_msg);
+    if (!config_.fragmentedScansEnabled() && scan_buffer.isRoundComplete())
     {
-      sendMessageWithMeasurements(scan_buffer_.currentRound());
+      hot_path_tracer_.traceRoundComplete();
+      sendMessageWithMeasurements(scan_buffer.currentRound());
     }
   }
   catch (const ScanRoundError& ex)
@@ -273,7 +416,14 @@ inline void ScannerProtocolDef::sendMessageWithMeasurements(
   {
     try
     {
-      inform_user_about_laser_scan_callback_(data_conversion_layer::LaserScanConverter::toLaserScan(stamped_msgs));
+      auto& scan_clock_estimator{ scan_clock_estimators_[deviceIndex(stamped_msgs[0].msg_.scannerId())] };
+      LaserScan scan{ config_.scannerClockTimestampsEnabled() ?
+                          data_conversion_layer::LaserScanConverter::toLaserScan(stamped_msgs, scan_clock_estimator) :
+                          data_conversion_layer::LaserScanConverter::toLaserScan(stamped_msgs) };
+      scan_filter_chain_.apply(scan);
+      hot_path_tracer_.traceConverted();
+      inform_user_about_laser_scan_callback_(scan);
+      hot_path_tracer_.traceCallbackReturned();
     }
     // LCOV_EXCL_START
     catch (const data_conversion_layer::ScannerProtocolViolationError& ex)
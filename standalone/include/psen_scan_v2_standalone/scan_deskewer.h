@@ -0,0 +1,167 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_SCAN_DESKEWER_H
+#define PSEN_SCAN_V2_STANDALONE_SCAN_DESKEWER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "psen_scan_v2_standalone/laserscan.h"
+#include "psen_scan_v2_standalone/util/tenth_of_degree.h"
+
+namespace psen_scan_v2_standalone
+{
+//! @brief Pose of the scanner in a fixed frame, e.g. the odometry frame of a vehicle.
+struct Pose2D
+{
+  //! Position in m.
+  double x{ 0. };
+  double y{ 0. };
+  //! Orientation in rad.
+  double theta{ 0. };
+};
+
+static constexpr std::size_t POSE_BUFFER_CAPACITY{ 200 };
+static constexpr int64_t POSE_BUFFER_MAX_EXTRAPOLATION_NS{ 50000000 };
+//! Number of times per scan the pose of the scanner is queried by the ScanDeskewer.
+static constexpr std::size_t DESKEW_NUM_POSE_SAMPLES{ 9 };
+
+//! @returns the pose of the scanner at the specified time in nanoseconds.
+using PoseAtTime = std::function<Pose2D(const int64_t& timestamp)>;
+
+/**
+ * @brief Timestamped poses of the scanner, e.g. from the odometry, which are interpolated linearly.
+ *
+ * Up to max_extrapolation after the newest pose, the motion between the two newest poses is extrapolated, because the
+ * last rays of a scan are usually received before the matching pose.
+ *
+ * @note The class is not thread safe.
+ */
+class PoseBuffer
+{
+public:
+  explicit PoseBuffer(const std::size_t& capacity = POSE_BUFFER_CAPACITY,
+                      const int64_t& max_extrapolation_ns = POSE_BUFFER_MAX_EXTRAPOLATION_NS);
+
+  /**
+   * @brief Adds a pose. The oldest pose is removed if the buffer is full.
+   *
+   * @throws std::invalid_argument if the timestamp is not newer than the one of the last added pose.
+   */
+  void add(const int64_t& timestamp, const Pose2D& pose);
+
+  /**
+   * @throws std::out_of_range if the timestamp is older than the oldest pose or newer than the newest pose plus the
+   * maximal extrapolation, or if there are less than two poses.
+   */
+  Pose2D interpolate(const int64_t& timestamp) const;
+
+  std::size_t size() const;
+
+private:
+  const std::size_t capacity_;
+  const int64_t max_extrapolation_ns_;
+  std::deque<std::pair<int64_t, Pose2D>> poses_;
+};
+
+//! @brief Laser scan as points in Cartesian coordinates. The i-th point belongs to the i-th measurement.
+struct DeskewedScan
+{
+  //! Time the points are referring to in nanoseconds, i.e. the time of the first ray.
+  int64_t timestamp{ 0 };
+  //! Coordinates in m in the frame of the scanner at the timestamp. Not finite for measurements without signal.
+  std::vector<double> x;
+  std::vector<double> y;
+};
+
+/**
+ * @brief Compensates the motion of the scanner during the 30ms of a scan round.
+ *
+ * Every ray is measured at the time of the first ray plus the time the scanner needs to rotate from the first ray to
+ * it. The point of a ray is transformed by the pose of the scanner at its own time into the pose at the time of the
+ * first ray.
+ *
+ * The pose callback is only called at DESKEW_NUM_POSE_SAMPLES times evenly spread over the scan. The relative motion is
+ * interpolated linearly in between. The time offsets, sines and cosines of all rays are computed once for every
+ * combination of scan range and resolution, afterwards the cached values are used. The transformation of the rays
+ * is a branch free loop over contiguous memory which can be vectorized by the compiler.
+ *
+ * @note The class is not thread safe. Use one instance per scanner.
+ */
+class ScanDeskewer
+{
+public:
+  /**
+   * @param x_axis_rotation Angle in rad between the 0 degree direction of the scanner and the x axis of the frame of
+   * the points, i.e. the same as the x_axis_rotation of the ROS node.
+   */
+  explicit ScanDeskewer(const double& x_axis_rotation = 0.);
+
+  /**
+   * @brief Transforms the measurements of the scan into de-skewed points.
+   *
+   * @param scan The laser scan, also a fragment if fragmented scans are enabled.
+   * @param pose_at_time Poses of the scanner in any fixed frame.
+   * @param result Memory for the result. It is reused in order to avoid allocations on consecutive calls.
+   *
+   * @throws Any exception thrown by pose_at_time.
+   */
+  void deskew(const LaserScan& scan, const PoseAtTime& pose_at_time, DeskewedScan& result);
+
+  //! @brief Convenience overload of deskew(const LaserScan&, const PoseAtTime&, DeskewedScan&).
+  DeskewedScan deskew(const LaserScan& scan, const PoseAtTime& pose_at_time);
+
+  //! @brief Convenience overload taking the poses from a PoseBuffer.
+  DeskewedScan deskew(const LaserScan& scan, const PoseBuffer& poses);
+
+  //! @returns the time in nanoseconds of the ray with the specified index of a scan.
+  static int64_t rayTimestamp(const LaserScan& scan, const std::size_t& index);
+
+  //! @returns the time in nanoseconds between two consecutive rays with the specified resolution.
+  static double timeIncrement(const util::TenthOfDegree& resolution);
+
+  //! @returns number of cached ray tables, i.e. of the different scan ranges and resolutions seen so far.
+  std::size_t cacheSize() const;
+
+private:
+  struct RayTable
+  {
+    //! Time of the ray relative to the first ray in ns.
+    std::vector<double> time_offsets_;
+    std::vector<double> cos_;
+    std::vector<double> sin_;
+  };
+  using CacheKey = std::tuple<int16_t, int16_t, std::size_t>;  // min angle, resolution, number of rays
+
+private:
+  const RayTable& rayTable(const LaserScan& scan);
+
+private:
+  const double x_axis_rotation_;
+  std::map<CacheKey, RayTable> cache_{};
+  //! Relative poses at the pose samples, reused between the scans.
+  std::vector<Pose2D> relative_poses_;
+};
+
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_SCAN_DESKEWER_H
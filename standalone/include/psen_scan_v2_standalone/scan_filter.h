@@ -0,0 +1,187 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_SCAN_FILTER_H
+#define PSEN_SCAN_V2_STANDALONE_SCAN_FILTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "psen_scan_v2_standalone/laserscan.h"
+#include "psen_scan_v2_standalone/util/latency_histogram.h"
+
+namespace psen_scan_v2_standalone
+{
+/**
+ * @brief Filter modifying the measurements of a laser scan in place.
+ *
+ * Removed measurements are set to infinity, i.e. they are treated like measurements without signal. The number of
+ * measurements and the intensities of the scan stay unchanged.
+ *
+ * Filters may keep memory between the scans in order to avoid allocations, so one instance must only be used by one
+ * thread. Use clone() to create an independent copy.
+ *
+ * @see ScanFilterChain
+ */
+class ScanFilter
+{
+public:
+  virtual ~ScanFilter() = default;
+
+  //! @returns a short name of the filter, e.g. for the timing summary of the ScanFilterChain.
+  virtual std::string name() const = 0;
+  virtual void apply(LaserScan& scan) = 0;
+  virtual std::unique_ptr<ScanFilter> clone() const = 0;
+  //! @returns true if the filter can only be used with intensities enabled.
+  virtual bool requiresIntensities() const;
+};
+
+/**
+ * @brief Removes the measurements outside of [min_range, max_range].
+ */
+class RangeFilter : public ScanFilter
+{
+public:
+  /**
+   * @param min_range Minimal range in m.
+   * @param max_range Maximal range in m.
+   *
+   * @throws std::invalid_argument if min_range is negative or greater than max_range.
+   */
+  RangeFilter(const double& min_range, const double& max_range);
+
+  std::string name() const override;
+  void apply(LaserScan& scan) override;
+  std::unique_ptr<ScanFilter> clone() const override;
+
+private:
+  double min_range_;
+  double max_range_;
+};
+
+/**
+ * @brief Removes the measurements with a normalized intensity below a threshold.
+ */
+class IntensityFilter : public ScanFilter
+{
+public:
+  //! @throws std::invalid_argument if min_intensity is negative.
+  explicit IntensityFilter(const double& min_intensity);
+
+  std::string name() const override;
+  void apply(LaserScan& scan) override;
+  std::unique_ptr<ScanFilter> clone() const override;
+  bool requiresIntensities() const override;
+
+private:
+  double min_intensity_;
+};
+
+/**
+ * @brief Removes veiling points, i.e. wrong measurements between an edge of an object and the background.
+ *
+ * A veiling point lies almost on the line of sight of its neighbour. For every pair of rays up to window rays apart,
+ * the angle at the measured point between the line of sight and the line to the point of the other ray is computed.
+ * Both points are removed if the angle is outside of [min_angle, max_angle]. Neighbours without signal are ignored.
+ */
+class ShadowFilter : public ScanFilter
+{
+public:
+  /**
+   * @param min_angle Minimal angle in rad, e.g. 0.17 (10 degree).
+   * @param max_angle Maximal angle in rad, e.g. 2.97 (170 degree).
+   * @param window Number of neighbours on each side of a ray which are checked.
+   *
+   * @throws std::invalid_argument unless 0 < min_angle < max_angle < pi and window > 0.
+   */
+  ShadowFilter(const double& min_angle, const double& max_angle, const std::size_t& window = 1);
+
+  std::string name() const override;
+  void apply(LaserScan& scan) override;
+  std::unique_ptr<ScanFilter> clone() const override;
+
+private:
+  double min_angle_;
+  double max_angle_;
+  std::size_t window_;
+  //! Measurements to be removed, reused between the scans.
+  std::vector<uint8_t> removed_;
+};
+
+/**
+ * @brief Replaces every measurement by the median of the measurements in a window around it.
+ *
+ * Measurements without signal take part in the median, so isolated measurements between rays without signal are
+ * removed, too. The window is shrunk symmetrically at the borders of the scan, so the first and the last measurement
+ * are kept.
+ */
+class MedianFilter : public ScanFilter
+{
+public:
+  //! @throws std::invalid_argument if window is not an odd number greater than 1.
+  explicit MedianFilter(const std::size_t& window);
+
+  std::string name() const override;
+  void apply(LaserScan& scan) override;
+  std::unique_ptr<ScanFilter> clone() const override;
+
+private:
+  std::size_t window_;
+  //! Unfiltered measurements and the current window, reused between the scans.
+  std::vector<double> measurements_;
+  std::vector<double> window_values_;
+};
+
+/**
+ * @brief Applies a sequence of filters to every laser scan before it is passed to the user.
+ *
+ * The duration of every filter is recorded in its own util::LatencyHistogram, which can be queried from other threads
+ * while the scans are filtered.
+ *
+ * @see ScannerConfigurationBuilder::addScanFilter()
+ */
+class ScanFilterChain
+{
+public:
+  //! @param filters The filters in the order they are applied. The chain uses its own copies of them.
+  explicit ScanFilterChain(const std::vector<std::shared_ptr<const ScanFilter>>& filters = {});
+
+  void apply(LaserScan& scan);
+
+  std::size_t size() const;
+  bool empty() const;
+  //! @throws std::out_of_range if there is no filter with the specified index.
+  std::string name(const std::size_t& index) const;
+  //! @throws std::out_of_range if there is no filter with the specified index.
+  const util::LatencyHistogram& histogram(const std::size_t& index) const;
+  //! @returns a table with the statistics of every filter in microseconds.
+  std::string formatSummary() const;
+
+private:
+  std::vector<std::unique_ptr<ScanFilter>> filters_;
+  std::vector<std::unique_ptr<util::LatencyHistogram>> histograms_;
+};
+
+inline bool ScanFilter::requiresIntensities() const
+{
+  return false;
+}
+
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_SCAN_FILTER_H
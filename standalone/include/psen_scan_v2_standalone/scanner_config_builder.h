@@ -16,6 +16,7 @@
 #ifndef PSEN_SCAN_V2_STANDALONE_SCANNER_CONFIG_BUILDER_H
 #define PSEN_SCAN_V2_STANDALONE_SCANNER_CONFIG_BUILDER_H
 
+#include <algorithm>
 #include <cmath>
 #include <stdexcept>
 #include <string>
@@ -35,6 +36,8 @@ class ScannerConfigurationBuilder
 {
 public:
   ScannerConfigurationBuilder(const std::string& scanner_ip);  // IP is mandatory
+  //! @brief Starts from an existing configuration, e.g. to change single parameters of it.
+  explicit ScannerConfigurationBuilder(const ScannerConfiguration& config);
   ScannerConfiguration build() const;
 
 public:
@@ -49,6 +52,63 @@ public:
   ScannerConfigurationBuilder& enableDiagnostics(const bool& enable);
   ScannerConfigurationBuilder& enableIntensities(const bool& enable);
   ScannerConfigurationBuilder& enableFragmentedScans(const bool& enable);
+  /**
+   * @brief Enables a subscriber device (cascaded scanner head) which is connected to the master device.
+   *
+   * The laser scans of the subscriber are passed to the laser scan callback separately from the ones of the master.
+   * They can be told apart via LaserScan::scannerId().
+   *
+   * @throws std::invalid_argument if the id is not the one of a subscriber or the subscriber is already enabled.
+   */
+  ScannerConfigurationBuilder& addSubscriber(const configuration::ScannerId& id,
+                                             const ScanRange& scan_range,
+                                             const util::TenthOfDegree& scan_resolution);
+  //! @brief Enables the latency histograms of the stages between frame reception and laser scan callback.
+  ScannerConfigurationBuilder& enableHotPathTracing(const bool& enable);
+  /**
+   * @brief Derives the timestamps of the laser scans from a linear model of the scanner rotation instead of taking them
+   * directly from the receive time of the monitoring frames.
+   *
+   * This removes most of the network and scheduling jitter of the host from the timestamps.
+   *
+   * @see util::ScanClockEstimator
+   */
+  ScannerConfigurationBuilder& enableScannerClockTimestamps(const bool& enable);
+  /**
+   * @brief Records all received monitoring frames together with their receive timestamps.
+   *
+   * The frames are written by a background thread into rotating files named
+   * "<file_prefix>_<start time>_<index>.psenrec". Recording does not block the reception of the frames.
+   *
+   * @param file_prefix Path and name of the recording files, e.g. "/var/log/scanner/front".
+   * @param max_file_size Size in bytes after which the next file is started.
+   * @param max_num_files Number of files after which the oldest file of the recording is deleted.
+   *
+   * @see communication_layer::FrameRecorder
+   */
+  ScannerConfigurationBuilder& recordMonitoringFrames(const std::string& file_prefix,
+                                                      const std::size_t& max_file_size,
+                                                      const std::size_t& max_num_files);
+  /**
+   * @brief Publishes all laser scans into a shared memory ring buffer, which can be read by other local processes.
+   *
+   * The scans are published before the laser scan callback is called. Other processes read them via
+   * communication_layer::ScanRingReader.
+   *
+   * @param name Name of the shared memory object, e.g. "psen_scan_front".
+   * @param num_slots Number of scans kept in the ring buffer.
+   *
+   * @see communication_layer::ScanRingPublisher
+   */
+  ScannerConfigurationBuilder& publishScansToSharedMemory(const std::string& name, const std::size_t& num_slots);
+  /**
+   * @brief Appends a filter which is applied in place to every laser scan before the laser scan callback is called.
+   *
+   * The filters are applied in the order they are added. The configuration stores a copy of the filter.
+   *
+   * @see ScanFilterChain
+   */
+  ScannerConfigurationBuilder& addScanFilter(const ScanFilter& filter);
   operator ScannerConfiguration();
 
 private:
@@ -58,11 +118,15 @@ private:
   ScannerConfiguration config_;
 };
 
-ScannerConfigurationBuilder::ScannerConfigurationBuilder(const std::string& scanner_ip)
+inline ScannerConfigurationBuilder::ScannerConfigurationBuilder(const std::string& scanner_ip)
 {
   scannerIp(scanner_ip);
 }
 
+inline ScannerConfigurationBuilder::ScannerConfigurationBuilder(const ScannerConfiguration& config) : config_(config)
+{
+}
+
 inline ScannerConfiguration ScannerConfigurationBuilder::build() const
 {
   if (!config_.isComplete())
@@ -151,7 +215,87 @@ inline ScannerConfigurationBuilder& ScannerConfigurationBuilder::enableFragmente
   return *this;
 }
 
-ScannerConfigurationBuilder::operator ScannerConfiguration()
+inline ScannerConfigurationBuilder& ScannerConfigurationBuilder::addSubscriber(
+    const configuration::ScannerId& id,
+    const ScanRange& scan_range,
+    const util::TenthOfDegree& scan_resolution =
+        util::TenthOfDegree(data_conversion_layer::radToTenthDegree(configuration::DEFAULT_SCAN_ANGLE_RESOLUTION)))
+{
+  if (id == configuration::ScannerId::master)
+  {
+    throw std::invalid_argument("The master device cannot be added as subscriber.");
+  }
+  if (config_.deviceEnabled(id))
+  {
+    throw std::invalid_argument(configuration::SCANNER_ID_TO_STRING.at(id) + " is already enabled.");
+  }
+  if (scan_resolution < util::TenthOfDegree(1) || scan_resolution > util::TenthOfDegree(100))
+  {
+    throw std::invalid_argument("Scan resolution has to be between 0.1 and 10 degrees.");
+  }
+  const auto it = std::find_if(
+      config_.subscribers_.begin(), config_.subscribers_.end(), [&id](const SubscriberConfiguration& subscriber) {
+        return subscriber.id > id;
+      });
+  config_.subscribers_.insert(it, SubscriberConfiguration(id, scan_range, scan_resolution));
+  return *this;
+}
+
+inline ScannerConfigurationBuilder& ScannerConfigurationBuilder::enableHotPathTracing(const bool& enable = true)
+{
+  config_.hot_path_tracing_ = enable;
+  return *this;
+}
+
+inline ScannerConfigurationBuilder&
+ScannerConfigurationBuilder::enableScannerClockTimestamps(const bool& enable = true)
+{
+  config_.scanner_clock_timestamps_ = enable;
+  return *this;
+}
+
+inline ScannerConfigurationBuilder& ScannerConfigurationBuilder::recordMonitoringFrames(
+    const std::string& file_prefix,
+    const std::size_t& max_file_size = configuration::FRAME_RECORDING_MAX_FILE_SIZE,
+    const std::size_t& max_num_files = configuration::FRAME_RECORDING_MAX_NUM_FILES)
+{
+  if (file_prefix.empty())
+  {
+    throw std::invalid_argument("The file prefix of the frame recording must not be empty.");
+  }
+  if (max_file_size == 0 || max_num_files == 0)
+  {
+    throw std::invalid_argument("The maximal file size and number of files of the frame recording must not be zero.");
+  }
+  config_.frame_recording_prefix_ = file_prefix;
+  config_.frame_recording_max_file_size_ = max_file_size;
+  config_.frame_recording_max_num_files_ = max_num_files;
+  return *this;
+}
+
+inline ScannerConfigurationBuilder& ScannerConfigurationBuilder::publishScansToSharedMemory(
+    const std::string& name, const std::size_t& num_slots = configuration::SCAN_RING_NUM_SLOTS)
+{
+  if (name.empty())
+  {
+    throw std::invalid_argument("The name of the shared memory object must not be empty.");
+  }
+  if (num_slots == 0)
+  {
+    throw std::invalid_argument("The number of slots of the shared memory ring buffer must not be zero.");
+  }
+  config_.scan_ring_name_ = name;
+  config_.scan_ring_num_slots_ = num_slots;
+  return *this;
+}
+
+inline ScannerConfigurationBuilder& ScannerConfigurationBuilder::addScanFilter(const ScanFilter& filter)
+{
+  config_.scan_filters_.emplace_back(filter.clone());
+  return *this;
+}
+
+inline ScannerConfigurationBuilder::operator ScannerConfiguration()
 {
   return build();
 }
@@ -15,14 +15,38 @@
 #ifndef PSEN_SCAN_V2_STANDALONE_SCANNER_CONFIGURATION_H
 #define PSEN_SCAN_V2_STANDALONE_SCANNER_CONFIGURATION_H
 
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include <boost/optional.hpp>
 
 #include "psen_scan_v2_standalone/configuration/default_parameters.h"
+#include "psen_scan_v2_standalone/configuration/scanner_ids.h"
 #include "psen_scan_v2_standalone/util/logging.h"
 #include "psen_scan_v2_standalone/scan_range.h"
+#include "psen_scan_v2_standalone/scan_filter.h"
 
 namespace psen_scan_v2_standalone
 {
+/**
+ * @brief Scan range and resolution of a subscriber device (cascaded scanner head) connected to the master device.
+ *
+ * The subscriber sends its monitoring frames through the connection of the master device.
+ */
+struct SubscriberConfiguration
+{
+  SubscriberConfiguration(const configuration::ScannerId& id,
+                          const ScanRange& scan_range,
+                          const util::TenthOfDegree& scan_resolution);
+
+  configuration::ScannerId id;
+  ScanRange scan_range;
+  util::TenthOfDegree scan_resolution;
+};
+
 /**
  * @brief Higher level data type storing the configuration details of the scanner like scanner IP, port,
  * scan range, etc.
@@ -53,6 +77,31 @@ public:
 
   bool fragmentedScansEnabled() const;
 
+  //! @returns the configured subscriber devices sorted by their id.
+  const std::vector<SubscriberConfiguration>& subscribers() const;
+  //! @returns true for the master device and every configured subscriber device.
+  bool deviceEnabled(const configuration::ScannerId& id) const;
+
+  //! @see util::HotPathTracer
+  bool hotPathTracingEnabled() const;
+
+  //! @see util::ScanClockEstimator
+  bool scannerClockTimestampsEnabled() const;
+
+  //! @returns the prefix of the files the monitoring frames are recorded to, if recording is enabled.
+  //! @see communication_layer::FrameRecorder
+  const boost::optional<std::string>& frameRecordingPrefix() const;
+  std::size_t frameRecordingMaxFileSize() const;
+  std::size_t frameRecordingMaxNumFiles() const;
+
+  //! @returns the name of the shared memory object the laser scans are published to, if publishing is enabled.
+  //! @see communication_layer::ScanRingPublisher
+  const boost::optional<std::string>& scanRingName() const;
+  std::size_t scanRingNumSlots() const;
+  //! @returns the filters applied to every laser scan in the returned order.
+  //! @see ScanFilterChain
+  const std::vector<std::shared_ptr<const ScanFilter>>& scanFilters() const;
+
   /*! deprecated: use void hostIp(const uint32_t& host_ip) instead */
   [[deprecated("use void hostIp(const uint32_t& host_ip) instead")]] void setHostIp(const uint32_t& host_ip);
   void hostIp(const uint32_t& host_ip);
@@ -79,8 +128,26 @@ private:
   bool diagnostics_enabled_{ configuration::DIAGNOSTICS };
   bool intensities_enabled_{ configuration::INTENSITIES };
   bool fragmented_scans_{ configuration::FRAGMENTED_SCANS };
+  std::vector<SubscriberConfiguration> subscribers_;
+  bool hot_path_tracing_{ configuration::HOT_PATH_TRACING };
+  bool scanner_clock_timestamps_{ configuration::SCANNER_CLOCK_TIMESTAMPS };
+
+  boost::optional<std::string> frame_recording_prefix_;
+  std::size_t frame_recording_max_file_size_{ configuration::FRAME_RECORDING_MAX_FILE_SIZE };
+  std::size_t frame_recording_max_num_files_{ configuration::FRAME_RECORDING_MAX_NUM_FILES };
+
+  boost::optional<std::string> scan_ring_name_;
+  std::size_t scan_ring_num_slots_{ configuration::SCAN_RING_NUM_SLOTS };
+  std::vector<std::shared_ptr<const ScanFilter>> scan_filters_;
 };
 
+inline SubscriberConfiguration::SubscriberConfiguration(const configuration::ScannerId& id,
+                                                        const ScanRange& scan_range,
+                                                        const util::TenthOfDegree& scan_resolution)
+  : id(id), scan_range(scan_range), scan_resolution(scan_resolution)
+{
+}
+
 inline bool ScannerConfiguration::isComplete() const
 {
   return scanner_ip_ && scan_range_;
@@ -93,6 +160,24 @@ inline bool ScannerConfiguration::isValid() const
     PSENSCAN_ERROR("ScannerConfiguration", "Requires a resolution of min: 0.2 degree when intensities are enabled");
     return false;
   }
+  for (const auto& subscriber : subscribers_)
+  {
+    if (intensities_enabled_ && subscriber.scan_resolution < util::TenthOfDegree(2u))
+    {
+      PSENSCAN_ERROR("ScannerConfiguration",
+                     "Requires a resolution of min: 0.2 degree for {} when intensities are enabled",
+                     configuration::SCANNER_ID_TO_STRING.at(subscriber.id));
+      return false;
+    }
+  }
+  for (const auto& filter : scan_filters_)
+  {
+    if (!intensities_enabled_ && filter->requiresIntensities())
+    {
+      PSENSCAN_ERROR("ScannerConfiguration", "The {} filter requires intensities to be enabled", filter->name());
+      return false;
+    }
+  }
   return true;
 }
 
@@ -151,6 +236,59 @@ inline bool ScannerConfiguration::fragmentedScansEnabled() const
   return fragmented_scans_;
 }
 
+inline const std::vector<SubscriberConfiguration>& ScannerConfiguration::subscribers() const
+{
+  return subscribers_;
+}
+
+inline bool ScannerConfiguration::deviceEnabled(const configuration::ScannerId& id) const
+{
+  return id == configuration::ScannerId::master ||
+         std::any_of(subscribers_.begin(), subscribers_.end(), [&id](const SubscriberConfiguration& subscriber) {
+           return subscriber.id == id;
+         });
+}
+
+inline bool ScannerConfiguration::hotPathTracingEnabled() const
+{
+  return hot_path_tracing_;
+}
+
+inline bool ScannerConfiguration::scannerClockTimestampsEnabled() const
+{
+  return scanner_clock_timestamps_;
+}
+
+inline const boost::optional<std::string>& ScannerConfiguration::frameRecordingPrefix() const
+{
+  return frame_recording_prefix_;
+}
+
+inline std::size_t ScannerConfiguration::frameRecordingMaxFileSize() const
+{
+  return frame_recording_max_file_size_;
+}
+
+inline std::size_t ScannerConfiguration::frameRecordingMaxNumFiles() const
+{
+  return frame_recording_max_num_files_;
+}
+
+inline const boost::optional<std::string>& ScannerConfiguration::scanRingName() const
+{
+  return scan_ring_name_;
+}
+
+inline std::size_t ScannerConfiguration::scanRingNumSlots() const
+{
+  return scan_ring_num_slots_;
+}
+
+inline const std::vector<std::shared_ptr<const ScanFilter>>& ScannerConfiguration::scanFilters() const
+{
+  return scan_filters_;
+}
+
 inline void ScannerConfiguration::hostIp(const uint32_t& host_ip)
 {
   host_ip_ = host_ip;
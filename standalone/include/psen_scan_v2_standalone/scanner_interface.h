@@ -16,10 +16,13 @@
 #ifndef PSEN_SCAN_V2_STANDALONE_SCANNER_H
 #define PSEN_SCAN_V2_STANDALONE_SCANNER_H
 
+#include <chrono>
 #include <stdexcept>
 #include <future>
 #include <functional>
 
+#include <boost/optional.hpp>
+
 #include "psen_scan_v2_standalone/laserscan.h"
 #include "psen_scan_v2_standalone/scanner_configuration.h"
 
@@ -31,6 +34,7 @@ namespace psen_scan_v2_standalone
  * This interface allows to:
  * - Set a configuration for the scanner on startup
  * - Define a callback for incoming scans
+ * - Poll for incoming scans, e.g. from a control loop running at its own rate
  * - Start and stop the communication with the scanner
  *
  * @see protocol_layer::LaserScanCallback
@@ -53,10 +57,21 @@ public:
   //! @brief Stops the scanner.
   virtual std::future<void> stop() = 0;
 
+  /**
+   * @brief Blocks until a laser scan arrives which was not returned by waitForNextScan() or tryGetLatestScan()
+   * before. Returns immediately if there already is such a scan.
+   *
+   * @returns the latest scan or boost::none if no new scan arrived within the timeout.
+   */
+  virtual boost::optional<LaserScan> waitForNextScan(const std::chrono::nanoseconds& timeout) = 0;
+  //! @returns the latest laser scan if it was not returned before, otherwise boost::none.
+  virtual boost::optional<LaserScan> tryGetLatestScan() = 0;
+
 protected:
   /*! deprecated: use const ScannerConfiguration& config() const instead */
   [[deprecated("use const ScannerConfiguration& config() const instead")]] const ScannerConfiguration&
   getConfig() const;
+  //! @returns the configuration passed on construction, which is not changed by a reconfiguration of the scanner.
   const ScannerConfiguration& config() const;
 
   /*! deprecated: use const LaserScanCallback& laserScanCallback() const instead */
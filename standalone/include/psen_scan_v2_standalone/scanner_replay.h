@@ -0,0 +1,109 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_SCANNER_REPLAY_H
+#define PSEN_SCAN_V2_STANDALONE_SCANNER_REPLAY_H
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "psen_scan_v2_standalone/io_edge.h"
+#include "psen_scan_v2_standalone/scanner_configuration.h"
+#include "psen_scan_v2_standalone/scanner_interface.h"
+
+namespace psen_scan_v2_standalone
+{
+//! @brief Replays the frames with the timing in which they were received.
+static constexpr double REPLAY_ORIGINAL_SPEED{ 1. };
+//! @brief Replays the frames without waiting between them.
+static constexpr double REPLAY_AS_FAST_AS_POSSIBLE{ std::numeric_limits<double>::infinity() };
+
+/**
+ * @brief Statistics of a finished replay.
+ */
+struct ReplayStatistics
+{
+  uint64_t num_frames{ 0 };
+  uint64_t num_laser_scans{ 0 };
+  //! Number of monitoring frame timeouts derived from the gaps between the recorded frames.
+  uint64_t num_monitoring_frame_timeouts{ 0 };
+  //! Time between the first and the last recorded frame.
+  std::chrono::nanoseconds recorded_duration{ 0 };
+  //! Wall clock time the replay took.
+  std::chrono::nanoseconds replay_duration{ 0 };
+};
+
+/**
+ * @brief Feeds recorded monitoring frames into the scanner protocol instead of frames received from a scanner.
+ *
+ * Every call of replay() runs a fresh protocol_layer::ScannerStateMachine through a complete session: The start is
+ * acknowledged by a synthetic start reply, afterwards all recorded frames are passed to the state machine and the
+ * session is finished by a synthetic stop reply. Therefore the laser scans and I/O edges are created exactly like
+ * for a connected scanner, which makes it possible to debug recorded sessions and to benchmark the throughput of the
+ * whole protocol layer without a scanner.
+ *
+ * The replay runs on a virtual clock given by the recorded receive timestamps: The frames, and therefore the laser
+ * scans, carry their original timestamps and a monitoring frame timeout is triggered for every
+ * protocol_layer::WATCHDOG_TIMEOUT without recorded frame, independent of the replay speed. The wall clock timers of
+ * the state machine are ignored.
+ *
+ * @note The state machine opens its UDP sockets on ephemeral ports of the loopback interface and sends its start and
+ * stop requests to a socket of the replay, so they never reach the scanner of the configuration or a local scanner.
+ *
+ * @see communication_layer::FrameRecorder
+ * @see data_conversion_layer::frame_recording
+ */
+class ScannerReplay
+{
+public:
+  /**
+   * @param scanner_config Configuration the frames are processed with, e.g. the configuration of the recording
+   * ScannerV2. Its network settings are ignored.
+   * @param laser_scan_callback Callback for the replayed scans. It is called from the thread calling replay().
+   * @param io_edge_callback Callback for every detected edge of the pins selected by io_edge_filter.
+   * @param io_edge_filter Pins of which the edges are reported.
+   */
+  ScannerReplay(const ScannerConfiguration& scanner_config,
+                const IScanner::LaserScanCallback& laser_scan_callback,
+                const IOEdgeCallback& io_edge_callback = IOEdgeCallback(),
+                const IOEdgeFilter& io_edge_filter = IOEdgeFilter::all());
+
+public:
+  /**
+   * @brief Replays the frames of the specified recording files in the specified order and blocks until all frames
+   * are processed.
+   *
+   * @param file_paths Files written by a communication_layer::FrameRecorder, e.g. all files of one recording.
+   * @param speed Factor by which the replay is faster than the recording, e.g. 10. for ten times the original speed
+   * or REPLAY_AS_FAST_AS_POSSIBLE.
+   *
+   * @throws std::invalid_argument if the speed is not positive.
+   * @throws data_conversion_layer::frame_recording::ReadError if one of the files is no valid recording.
+   */
+  ReplayStatistics replay(const std::vector<std::string>& file_paths, const double& speed = REPLAY_ORIGINAL_SPEED);
+
+private:
+  const ScannerConfiguration config_;
+  const IScanner::LaserScanCallback laser_scan_callback_;
+  const IOEdgeCallback io_edge_callback_;
+  const IOEdgeFilter io_edge_filter_;
+};
+
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_SCANNER_REPLAY_H
@@ -15,6 +15,9 @@
 #ifndef PSEN_SCAN_V2_STANDALONE_SCANNER_V2_H
 #define PSEN_SCAN_V2_STANDALONE_SCANNER_V2_H
 
+#include <atomic>
+#include <chrono>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <future>
@@ -22,11 +25,18 @@
 
 #include <boost/optional.hpp>
 
+#include "psen_scan_v2_standalone/io_edge.h"
 #include "psen_scan_v2_standalone/scanner_interface.h"
+#include "psen_scan_v2_standalone/scan_filter.h"
+#include "psen_scan_v2_standalone/configuration/scanner_ids.h"
+#include "psen_scan_v2_standalone/communication_layer/frame_recorder.h"
+#include "psen_scan_v2_standalone/communication_layer/scan_ring_publisher.h"
 #include "psen_scan_v2_standalone/protocol_layer/scanner_events.h"
 #include "psen_scan_v2_standalone/protocol_layer/scanner_state_machine.h"
+#include "psen_scan_v2_standalone/util/hot_path_tracer.h"
+#include "psen_scan_v2_standalone/util/latest_value.h"
+#include "psen_scan_v2_standalone/util/scan_clock_estimator.h"
 
-#include "psen_scan_v2_standalone/util/watchdog.h"
 
 /**
  * @brief Root namespace in which the software components to communicate with the scanner (firmware-version: 2)
@@ -49,7 +59,7 @@ using std::placeholders::_2;
  *
  * It uses the passed ScannerConfiguration for all configurable parts of this process.
  *
- * The class creates two UdpClientImpl, a WatchdogFactory and passes them together with the @ref LaserScanCallback to
+ * The class creates two UdpClientImpl and passes them together with the @ref LaserScanCallback to
  * the scanner_protocol::ScannerStateMachine via scanner_protocol::StateMachineArgs.
  *
  * @see IScanner
@@ -59,8 +69,55 @@ using std::placeholders::_2;
  */
 class ScannerV2 : public IScanner
 {
+public:
+  //! Callbacks for the laser scans of the subscriber devices, see ScannerConfigurationBuilder::addSubscriber().
+  using SubscriberLaserScanCallbacks = std::map<configuration::ScannerId, LaserScanCallback>;
+  //! Callback for the diagnostic messages of the scanner, see onDiagnosticsChanged().
+  using DiagnosticsCallback = protocol_layer::DiagnosticsCallback;
+
 public:
   ScannerV2(const ScannerConfiguration& scanner_config, const LaserScanCallback& laser_scan_callback);
+  /**
+   * @brief Creates a scanner whose laser scans are only fetched via waitForNextScan() or tryGetLatestScan().
+   *
+   * @param scanner_config Configuration of the scanner.
+   */
+  explicit ScannerV2(const ScannerConfiguration& scanner_config);
+  /**
+   * @brief Additionally informs the user about every rising and falling edge of the selected I/O pins.
+   *
+   * The edges are detected directly on the incoming monitoring frames and carry the frame timestamp.
+   * Therefore the user is informed without waiting for a complete scan round.
+   *
+   * @param scanner_config Configuration of the scanner.
+   * @param laser_scan_callback Callback for incoming scans.
+   * @param io_edge_callback Callback for every detected edge of the pins selected by io_edge_filter.
+   * @param io_edge_filter Pins of which the edges are reported.
+   */
+  ScannerV2(const ScannerConfiguration& scanner_config,
+            const LaserScanCallback& laser_scan_callback,
+            const IOEdgeCallback& io_edge_callback,
+            const IOEdgeFilter& io_edge_filter = IOEdgeFilter::all());
+  /**
+   * @brief Passes the laser scans of the subscriber devices to separate callbacks.
+   *
+   * The scans of subscribers without a callback of their own are passed to laser_scan_callback like the ones of the
+   * master device. Only the scans of the master device are published to shared memory.
+   *
+   * @param scanner_config Configuration of the scanner including its subscriber devices.
+   * @param laser_scan_callback Callback for incoming scans of the master device.
+   * @param subscriber_laser_scan_callbacks Callbacks for incoming scans of the subscriber devices.
+   * @param io_edge_callback Callback for every detected edge of the pins selected by io_edge_filter.
+   * @param io_edge_filter Pins of which the edges are reported.
+   *
+   * @throws std::invalid_argument if a callback is given for the master or for a subscriber which is not enabled in
+   * scanner_config.
+   */
+  ScannerV2(const ScannerConfiguration& scanner_config,
+            const LaserScanCallback& laser_scan_callback,
+            const SubscriberLaserScanCallbacks& subscriber_laser_scan_callbacks,
+            const IOEdgeCallback& io_edge_callback = IOEdgeCallback(),
+            const IOEdgeFilter& io_edge_filter = IOEdgeFilter::all());
   ~ScannerV2() override;
 
 public:
@@ -70,6 +127,90 @@ public:
   //! @brief An exception is set in the returned future if the scanner stop was not successful.
   std::future<void> stop() override;
 
+  /**
+   * @brief Waits for the next laser scan of the master device.
+   *
+   * The scans are kept in a slot holding only the latest one, so that a consumer which is slower than the scanner
+   * skips scans instead of queueing them. The laser scan callback is called for every scan in any case.
+   *
+   * @note Users of a laser scan callback do not pay for the copy into the slot until they call waitForNextScan() or
+   * tryGetLatestScan() for the first time. Scans received before are not kept.
+   */
+  boost::optional<LaserScan> waitForNextScan(const std::chrono::nanoseconds& timeout) override;
+  //! @returns the latest laser scan of the master device if it was not returned before, otherwise boost::none.
+  boost::optional<LaserScan> tryGetLatestScan() override;
+
+  /**
+   * @brief Changes the scan settings of the running scanner.
+   *
+   * The scanner is stopped and started with the new configuration via the existing connection, i.e. without
+   * creating new sockets or threads. The returned future becomes ready as soon as the scanner accepted the new start
+   * request. The monitoring frames are interrupted in between, see lastReconfigurationGap().
+   *
+   * Only the scan settings can be changed, e.g. scan range, resolution, intensities, diagnostics and subscriber
+   * devices. The scan filters cannot be changed, so derive the new configuration from the current one. An exception is
+   * set in the returned future if the scanner is not running or the restart was not successful. The configuration
+   * returned by config() stays the one passed on construction.
+   *
+   * @throws std::invalid_argument if scanner_config differs from the configuration passed on construction in other
+   * than the scan settings.
+   */
+  std::future<void> reconfigure(const ScannerConfiguration& scanner_config);
+
+  /**
+   * @returns the time between the last monitoring frame before and the first monitoring frame after the last
+   * reconfiguration, if the scanner was reconfigured and sends monitoring frames again.
+   */
+  boost::optional<std::chrono::nanoseconds> lastReconfigurationGap();
+
+  /**
+   * @brief Informs the user whenever the diagnostic messages reported by a device change.
+   *
+   * Every monitoring frame contains the error bits of all devices, but only the ones of the sending device are
+   * evaluated. The callback receives the id of this device and all its current messages, an empty vector means that
+   * its errors are resolved. The frames are only compared bitwise, so nothing is expanded or passed while the
+   * diagnostics stay the same. Errors which persist across a restart or reconfiguration are reported again. Requires
+   * diagnostics to be enabled in the ScannerConfiguration. Register the callback before start() in order to not miss
+   * errors which are present from the beginning.
+   */
+  void onDiagnosticsChanged(const DiagnosticsCallback& diagnostics_callback);
+
+  /**
+   * @brief Latency histograms of the stages between the reception of a monitoring frame and the return of the laser
+   * scan callback.
+   *
+   * The histograms are only filled if hot path tracing is enabled in the ScannerConfiguration. They can be queried
+   * at any time, e.g. via util::HotPathTracer::formatSummary().
+   */
+  const util::HotPathTracer& hotPathTracer() const;
+
+  /**
+   * @brief Filters applied to the laser scans as configured via ScannerConfigurationBuilder::addScanFilter().
+   *
+   * The timing statistics of the filters can be queried at any time, e.g. via ScanFilterChain::formatSummary().
+   */
+  const ScanFilterChain& scanFilterChain() const;
+
+  /**
+   * @returns the residuals between the receive timestamps and the timestamps of the laser scans as well as the
+   * estimated rotation period, if scanner clock timestamps are enabled in the ScannerConfiguration.
+   *
+   * @see util::ScanClockEstimator
+   */
+  util::ScanClockEstimator::Statistics scanClockStatistics();
+
+  /**
+   * @returns the recorder of the received monitoring frames, e.g. to query the number of dropped frames, or nullptr
+   * if the recording is not enabled in the ScannerConfiguration.
+   */
+  const communication_layer::FrameRecorder* frameRecorder() const;
+
+  /**
+   * @returns the publisher of the laser scans into shared memory, e.g. to query the number of published scans, or
+   * nullptr if publishing is not enabled in the ScannerConfiguration.
+   */
+  const communication_layer::ScanRingPublisher* scanRingPublisher() const;
+
 private:
   template <class T>
   void triggerEventWithParam(const T& event);
@@ -81,6 +222,22 @@ private:
   void scannerStoppedCallback();
   void scannerStartErrorCallback(const std::string& error_msg);
   void scannerStopErrorCallback(const std::string& error_msg);
+  void rawMonitoringFrameReceivedCallback(const data_conversion_layer::RawDataConstPtr& data,
+                                          const std::size_t& num_bytes,
+                                          const int64_t& timestamp);
+  void laserScanReceivedCallback(const LaserScan& scan);
+  void diagnosticsChangedCallback(
+      const configuration::ScannerId& scanner_id,
+      const std::vector<data_conversion_layer::monitoring_frame::diagnostic::Message>& diagnostic_messages);
+
+  static std::unique_ptr<communication_layer::FrameRecorder>
+  createFrameRecorder(const ScannerConfiguration& scanner_config);
+  static std::unique_ptr<communication_layer::ScanRingPublisher>
+  createScanRingPublisher(const ScannerConfiguration& scanner_config);
+  static void checkReconfigurable(const ScannerConfiguration& current_config, const ScannerConfiguration& new_config);
+  static const SubscriberLaserScanCallbacks&
+  checkSubscriberLaserScanCallbacks(const ScannerConfiguration& scanner_config,
+                                    const SubscriberLaserScanCallbacks& subscriber_laser_scan_callbacks);
 
 private:
   using OptionalPromise = boost::optional<std::promise<void>>;
@@ -88,14 +245,33 @@ private:
 private:
   OptionalPromise scanner_has_started_{ boost::none };
   OptionalPromise scanner_has_stopped_{ boost::none };
+  OptionalPromise scanner_has_reconfigured_{ boost::none };
+  //! @brief Set as long as the scanner sends monitoring frames, i.e. from a successful start until stop() is called.
+  bool scanner_is_running_{ false };
+  //! @brief Set by the destructor, so that events of callbacks already waiting for the member_mutex_ (e.g. a timeout)
+  //! are dropped instead of reaching the state machine while it is destroyed.
+  bool terminated_{ false };
 
   //! @brief This Mutex protects ALL members of the Scanner against concurrent access.
   //! So far there exist at least the following threads, potentially causing concurrent access to the members:
   //! - user-main-thread
   //! - io_service thread of UDPClient
-  //! - watchdog threads
+  //! - timer service thread (timeouts)
   std::mutex member_mutex_;
 
+  //! @brief Only set if the recording of monitoring frames is enabled. Only used by the io_service thread of the
+  //! UDPClient receiving the monitoring frames, therefore it is not protected by the member_mutex_.
+  const std::unique_ptr<communication_layer::FrameRecorder> frame_recorder_;
+  //! @brief Only set if publishing the laser scans to shared memory is enabled. Only used by the laser scan callback,
+  //! which is called with the member_mutex_ taken.
+  const std::unique_ptr<communication_layer::ScanRingPublisher> scan_ring_publisher_;
+  const SubscriberLaserScanCallbacks subscriber_laser_scan_callbacks_;
+  DiagnosticsCallback diagnostics_callback_;
+  //! @brief Filled by the laser scan callback once latest_scan_enabled_ is set. It is synchronized on its own, so that
+  //! users waiting for a scan do not hold the member_mutex_.
+  util::LatestValue<LaserScan> latest_scan_;
+  //! @brief Set by the constructor without laser scan callback or by the first call of the pull API.
+  std::atomic_bool latest_scan_enabled_{ false };
   std::unique_ptr<ScannerStateMachine> sm_;
 };
 
@@ -103,6 +279,10 @@ template <class T>
 void ScannerV2::triggerEventWithParam(const T& event)
 {
   const std::lock_guard<std::mutex> lock(member_mutex_);
+  if (terminated_)
+  {
+    return;
+  }
   sm_->process_event(event);
 }
 
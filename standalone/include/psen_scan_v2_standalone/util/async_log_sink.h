@@ -0,0 +1,306 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_ASYNC_LOG_SINK_H
+#define PSEN_SCAN_V2_STANDALONE_ASYNC_LOG_SINK_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <console_bridge/console.h>
+#include <fmt/format.h>
+
+namespace psen_scan_v2_standalone
+{
+namespace util
+{
+static constexpr std::size_t DEFAULT_ASYNC_LOG_CAPACITY{ 1024 };
+static constexpr std::chrono::milliseconds DEFAULT_ASYNC_LOG_DRAIN_PERIOD{ 10 };
+
+/**
+ * @brief Optional sink which decouples the PSENSCAN_* log macros from the console_bridge output.
+ *
+ * While an AsyncLogSink exists, the log macros only push the formatted message into a bounded lock-free queue.
+ * A background thread drains the queue into console_bridge. If the queue is full, the record is dropped and counted
+ * instead of blocking the logging thread, so slow console or rosout I/O cannot stall the reception of scans.
+ *
+ * Without an AsyncLogSink the messages are passed to console_bridge synchronously, as before.
+ *
+ * Usage:
+ * @code
+ * psen_scan_v2_standalone::util::AsyncLogSink async_logging;  // Asynchronous logging until destruction
+ * @endcode
+ *
+ * @note Only one AsyncLogSink can exist at a time.
+ */
+class AsyncLogSink
+{
+public:
+  /**
+   * @param capacity Number of records the queue can hold. It is rounded up to the next power of two.
+   * @param drain_period Maximal time a record waits in the queue before it is passed to console_bridge.
+   *
+   * @throws std::logic_error if another AsyncLogSink already exists.
+   */
+  explicit AsyncLogSink(std::size_t capacity = DEFAULT_ASYNC_LOG_CAPACITY,
+                        std::chrono::milliseconds drain_period = DEFAULT_ASYNC_LOG_DRAIN_PERIOD);
+  //! @brief Restores synchronous logging and passes all queued records to console_bridge.
+  ~AsyncLogSink();
+
+  AsyncLogSink(const AsyncLogSink&) = delete;
+  AsyncLogSink& operator=(const AsyncLogSink&) = delete;
+
+public:
+  //! @returns the number of records which were dropped because the queue was full.
+  uint64_t droppedRecords() const;
+  std::size_t capacity() const;
+
+  /**
+   * @brief Passes the message to the active AsyncLogSink or, if there is none, directly to console_bridge.
+   *
+   * @note file has to point to a string with static storage duration, like __FILE__.
+   */
+  static void log(const char* file, int line, console_bridge::LogLevel level, std::string msg);
+
+private:
+  struct Record
+  {
+    const char* file{ nullptr };
+    int line{ 0 };
+    console_bridge::LogLevel level{ console_bridge::CONSOLE_BRIDGE_LOG_NONE };
+    std::string msg;
+  };
+
+  struct Slot
+  {
+    std::atomic<std::size_t> sequence{ 0 };
+    Record record;
+  };
+
+private:
+  //! @returns false if the queue is full.
+  bool tryPush(const char* file, int line, console_bridge::LogLevel level, std::string&& msg);
+  bool tryPop(Record& record);
+  void run();
+  void drain();
+  void reportDroppedRecords();
+
+  static std::size_t nextPowerOfTwo(std::size_t value);
+  static std::atomic<AsyncLogSink*>& activeSink();
+  //! Number of threads which might currently access the active sink.
+  static std::atomic<std::size_t>& numLoggingThreads();
+
+private:
+  const std::size_t capacity_;
+  const std::chrono::milliseconds drain_period_;
+  std::unique_ptr<Slot[]> slots_;
+  std::atomic<std::size_t> enqueue_pos_{ 0 };
+  //! Only accessed by the drain thread.
+  std::size_t dequeue_pos_{ 0 };
+  std::atomic<uint64_t> dropped_records_{ 0 };
+  //! Only accessed by the drain thread.
+  uint64_t reported_dropped_records_{ 0 };
+
+  bool terminated_{ false };
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::thread thread_;
+};
+
+inline AsyncLogSink::AsyncLogSink(std::size_t capacity, std::chrono::milliseconds drain_period)
+  : capacity_(nextPowerOfTwo(capacity)), drain_period_(drain_period), slots_(new Slot[capacity_])
+{
+  for (std::size_t i = 0; i < capacity_; ++i)
+  {
+    slots_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  AsyncLogSink* no_sink{ nullptr };
+  if (!activeSink().compare_exchange_strong(no_sink, this))
+  {
+    throw std::logic_error("Only one AsyncLogSink can exist at a time.");
+  }
+  thread_ = std::thread([this]() { run(); });
+}
+
+inline AsyncLogSink::~AsyncLogSink()
+{
+  activeSink().store(nullptr);
+  // Threads which already loaded the sink pointer finish their push before the queue is drained for the last time.
+  while (numLoggingThreads().load() != 0)
+  {
+    std::this_thread::yield();
+  }
+
+  {
+    std::lock_guard<std::mutex> lk(mutex_);
+    terminated_ = true;
+  }
+  cv_.notify_all();
+  thread_.join();
+}
+
+inline uint64_t AsyncLogSink::droppedRecords() const
+{
+  return dropped_records_.load(std::memory_order_relaxed);
+}
+
+inline std::size_t AsyncLogSink::capacity() const
+{
+  return capacity_;
+}
+
+inline void AsyncLogSink::log(const char* file, int line, console_bridge::LogLevel level, std::string msg)
+{
+  ++numLoggingThreads();
+  AsyncLogSink* sink = activeSink().load();
+  if (sink)
+  {
+    if (!sink->tryPush(file, line, level, std::move(msg)))
+    {
+      sink->dropped_records_.fetch_add(1, std::memory_order_relaxed);
+    }
+    --numLoggingThreads();
+    return;
+  }
+  --numLoggingThreads();
+  console_bridge::log(file, line, level, msg.c_str());
+}
+
+// Bounded multi-producer queue, see
+// https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+inline bool AsyncLogSink::tryPush(const char* file, int line, console_bridge::LogLevel level, std::string&& msg)
+{
+  std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+  Slot* slot;
+  while (true)
+  {
+    slot = &slots_[pos & (capacity_ - 1)];
+    const std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+    const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+    if (diff == 0)
+    {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+      {
+        break;
+      }
+    }
+    else if (diff < 0)
+    {
+      return false;
+    }
+    else
+    {
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+
+  slot->record.file = file;
+  slot->record.line = line;
+  slot->record.level = level;
+  slot->record.msg = std::move(msg);
+  slot->sequence.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+inline bool AsyncLogSink::tryPop(Record& record)
+{
+  Slot& slot = slots_[dequeue_pos_ & (capacity_ - 1)];
+  if (slot.sequence.load(std::memory_order_acquire) != dequeue_pos_ + 1)
+  {
+    return false;
+  }
+
+  record = std::move(slot.record);
+  slot.sequence.store(dequeue_pos_ + capacity_, std::memory_order_release);
+  ++dequeue_pos_;
+  return true;
+}
+
+inline void AsyncLogSink::run()
+{
+  std::unique_lock<std::mutex> lk(mutex_);
+  while (!terminated_)
+  {
+    // The logging threads do not notify to stay lock-free, therefore the queue is drained periodically.
+    cv_.wait_for(lk, drain_period_);
+    lk.unlock();
+    drain();
+    lk.lock();
+  }
+  lk.unlock();
+  drain();
+}
+
+inline void AsyncLogSink::drain()
+{
+  Record record;
+  while (tryPop(record))
+  {
+    console_bridge::log(record.file, record.line, record.level, record.msg.c_str());
+  }
+  reportDroppedRecords();
+}
+
+inline void AsyncLogSink::reportDroppedRecords()
+{
+  const uint64_t dropped_records = droppedRecords();
+  if (dropped_records != reported_dropped_records_)
+  {
+    console_bridge::log(__FILE__,
+                        __LINE__,
+                        console_bridge::CONSOLE_BRIDGE_LOG_WARN,
+                        fmt::format("AsyncLogSink: Dropped {} log messages because the queue was full.",
+                                    dropped_records - reported_dropped_records_)
+                            .c_str());
+    reported_dropped_records_ = dropped_records;
+  }
+}
+
+inline std::size_t AsyncLogSink::nextPowerOfTwo(std::size_t value)
+{
+  std::size_t power_of_two{ 1 };
+  while (power_of_two < value)
+  {
+    power_of_two <<= 1;
+  }
+  return power_of_two;
+}
+
+inline std::atomic<AsyncLogSink*>& AsyncLogSink::activeSink()
+{
+  static std::atomic<AsyncLogSink*> sink{ nullptr };
+  return sink;
+}
+
+inline std::atomic<std::size_t>& AsyncLogSink::numLoggingThreads()
+{
+  static std::atomic<std::size_t> num_threads{ 0 };
+  return num_threads;
+}
+
+}  // namespace util
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_ASYNC_LOG_SINK_H
@@ -0,0 +1,224 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_HOT_PATH_TRACER_H
+#define PSEN_SCAN_V2_STANDALONE_HOT_PATH_TRACER_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+#include <fmt/format.h>
+
+#include "psen_scan_v2_standalone/util/latency_histogram.h"
+
+namespace psen_scan_v2_standalone
+{
+namespace util
+{
+/**
+ * @brief Measures the time the monitoring frames spend in the stages between reception and the user callback.
+ *
+ * The trace points are expected to be passed in order by the thread which receives the monitoring frames:
+ * traceReceive() -> traceDeserialized() -> [traceRoundComplete()] -> traceConverted() -> traceCallbackReturned().
+ * The time between two consecutive trace points is recorded in the histogram of the later stage, so the histograms
+ * can be queried by other threads at any time.
+ *
+ * If the tracer is disabled, every trace point costs a single branch.
+ */
+class HotPathTracer
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  enum class Stage : std::size_t
+  {
+    //! From the reception of a monitoring frame until it is deserialized.
+    deserialization = 0,
+    //! From the deserialization of the frame completing a scan round until the round is complete.
+    scan_round,
+    //! From the completion of the scan round (or the fragment) until the laser scan is created and filtered.
+    conversion,
+    //! Time spent in the laser scan callback of the user.
+    callback,
+    //! From the reception of the last frame of a scan until the return of the laser scan callback.
+    total
+  };
+  static constexpr std::size_t NUM_STAGES{ static_cast<std::size_t>(Stage::total) + 1 };
+
+public:
+  explicit HotPathTracer(bool enabled = false);
+
+public:
+  bool isEnabled() const;
+
+  void traceReceive();
+  void traceDeserialized();
+  void traceRoundComplete();
+  void traceConverted();
+  void traceCallbackReturned();
+
+  const LatencyHistogram& histogram(const Stage& stage) const;
+  LatencyHistogram::Summary summary(const Stage& stage) const;
+  //! @returns a human readable table with the statistics of all stages in microseconds.
+  std::string formatSummary() const;
+
+  static std::string stageName(const Stage& stage);
+
+  //! @returns a disabled tracer for components which are not traced.
+  static HotPathTracer& disabled();
+
+private:
+  //! @param start is taken by value because it usually refers to last_trace_time_, which is updated here.
+  void trace(const Stage& stage, const Clock::time_point start);
+
+private:
+  const bool enabled_;
+  std::array<LatencyHistogram, NUM_STAGES> histograms_;
+  //! Only accessed by the thread passing the trace points.
+  Clock::time_point receive_time_;
+  Clock::time_point last_trace_time_;
+};
+
+inline HotPathTracer::HotPathTracer(bool enabled) : enabled_(enabled)
+{
+}
+
+inline bool HotPathTracer::isEnabled() const
+{
+  return enabled_;
+}
+
+inline void HotPathTracer::traceReceive()
+{
+  if (enabled_)
+  {
+    receive_time_ = Clock::now();
+    last_trace_time_ = receive_time_;
+  }
+}
+
+inline void HotPathTracer::traceDeserialized()
+{
+  if (enabled_)
+  {
+    trace(Stage::deserialization, last_trace_time_);
+  }
+}
+
+inline void HotPathTracer::traceRoundComplete()
+{
+  if (enabled_)
+  {
+    trace(Stage::scan_round, last_trace_time_);
+  }
+}
+
+inline void HotPathTracer::traceConverted()
+{
+  if (enabled_)
+  {
+    trace(Stage::conversion, last_trace_time_);
+  }
+}
+
+inline void HotPathTracer::traceCallbackReturned()
+{
+  if (enabled_)
+  {
+    const auto start_of_callback = last_trace_time_;
+    trace(Stage::total, receive_time_);
+    histograms_[static_cast<std::size_t>(Stage::callback)].record(last_trace_time_ - start_of_callback);
+  }
+}
+
+inline void HotPathTracer::trace(const Stage& stage, const Clock::time_point start)
+{
+  last_trace_time_ = Clock::now();
+  histograms_[static_cast<std::size_t>(stage)].record(last_trace_time_ - start);
+}
+
+inline const LatencyHistogram& HotPathTracer::histogram(const Stage& stage) const
+{
+  return histograms_.at(static_cast<std::size_t>(stage));
+}
+
+inline LatencyHistogram::Summary HotPathTracer::summary(const Stage& stage) const
+{
+  return histogram(stage).summary();
+}
+
+inline std::string HotPathTracer::formatSummary() const
+{
+  std::string summary_table{ fmt::format("{:<16}{:>10}{:>10}{:>10}{:>10}{:>10}{:>10}{:>10}{:>10}\n",
+                                         "stage [us]",
+                                         "count",
+                                         "min",
+                                         "mean",
+                                         "p50",
+                                         "p90",
+                                         "p99",
+                                         "p99.9",
+                                         "max") };
+  const auto in_us = [](const LatencyHistogram::Duration& duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+  };
+  for (std::size_t i = 0; i < NUM_STAGES; ++i)
+  {
+    const auto stage = static_cast<Stage>(i);
+    const LatencyHistogram::Summary s{ summary(stage) };
+    summary_table += fmt::format("{:<16}{:>10}{:>10.1f}{:>10.1f}{:>10.1f}{:>10.1f}{:>10.1f}{:>10.1f}{:>10.1f}\n",
+                                 stageName(stage),
+                                 s.count,
+                                 in_us(s.min),
+                                 in_us(s.mean),
+                                 in_us(s.p50),
+                                 in_us(s.p90),
+                                 in_us(s.p99),
+                                 in_us(s.p999),
+                                 in_us(s.max));
+  }
+  return summary_table;
+}
+
+inline std::string HotPathTracer::stageName(const Stage& stage)
+{
+  switch (stage)
+  {
+    case Stage::deserialization:
+      return "deserialization";
+    case Stage::scan_round:
+      return "scan_round";
+    case Stage::conversion:
+      return "conversion";
+    case Stage::callback:
+      return "callback";
+    case Stage::total:
+      return "total";
+  }
+  return "unknown";  // LCOV_EXCL_LINE
+}
+
+inline HotPathTracer& HotPathTracer::disabled()
+{
+  static HotPathTracer disabled_tracer{ false };
+  return disabled_tracer;
+}
+
+}  // namespace util
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_HOT_PATH_TRACER_H
@@ -0,0 +1,198 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_LATENCY_HISTOGRAM_H
+#define PSEN_SCAN_V2_STANDALONE_LATENCY_HISTOGRAM_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace psen_scan_v2_standalone
+{
+namespace util
+{
+/**
+ * @brief Fixed-memory histogram of durations with log-linear buckets.
+ *
+ * Each power of two of nanoseconds is split into SUB_BUCKETS linear buckets, so every recorded value is represented
+ * with a relative error below 1/SUB_BUCKETS. Values above MAX_VALUE_NS are counted in the last bucket.
+ *
+ * record() is lock-free and does not allocate, so it can be called on the hot path while other threads query the
+ * statistics. Queries are not atomic across buckets and may therefore miss records which happen concurrently.
+ */
+class LatencyHistogram
+{
+public:
+  using Duration = std::chrono::nanoseconds;
+
+  static constexpr unsigned int SUB_BUCKET_BITS{ 4 };
+  static constexpr uint64_t SUB_BUCKETS{ uint64_t{ 1 } << SUB_BUCKET_BITS };
+  //! Values are exact up to this power of two and log-linear above.
+  static constexpr unsigned int MAX_VALUE_BITS{ 36 };  // ~68s
+  static constexpr uint64_t MAX_VALUE_NS{ (uint64_t{ 1 } << MAX_VALUE_BITS) - 1 };
+  static constexpr std::size_t NUM_BUCKETS{ SUB_BUCKETS * (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) };
+
+  struct Summary
+  {
+    uint64_t count{ 0 };
+    Duration min{ 0 };
+    Duration max{ 0 };
+    Duration mean{ 0 };
+    Duration p50{ 0 };
+    Duration p90{ 0 };
+    Duration p99{ 0 };
+    Duration p999{ 0 };
+  };
+
+public:
+  void record(const Duration& duration);
+
+  uint64_t count() const;
+  Duration min() const;
+  Duration max() const;
+  Duration mean() const;
+  /**
+   * @returns the upper bound of the bucket containing the specified percentile of all recorded values.
+   * @param percentile Percentile in the range [0, 100].
+   */
+  Duration percentile(double percentile) const;
+  Summary summary() const;
+
+private:
+  static std::size_t bucketIndex(uint64_t value_ns);
+  static uint64_t bucketUpperBound(std::size_t index);
+
+private:
+  std::array<std::atomic<uint64_t>, NUM_BUCKETS> buckets_{};
+  std::atomic<uint64_t> count_{ 0 };
+  std::atomic<uint64_t> sum_ns_{ 0 };
+  std::atomic<uint64_t> min_ns_{ std::numeric_limits<uint64_t>::max() };
+  std::atomic<uint64_t> max_ns_{ 0 };
+};
+
+inline void LatencyHistogram::record(const Duration& duration)
+{
+  const uint64_t value_ns = static_cast<uint64_t>(std::max(duration.count(), Duration::rep{ 0 }));
+  buckets_[bucketIndex(value_ns)].fetch_add(1, std::memory_order_relaxed);
+  sum_ns_.fetch_add(value_ns, std::memory_order_relaxed);
+
+  uint64_t min_ns = min_ns_.load(std::memory_order_relaxed);
+  while (value_ns < min_ns && !min_ns_.compare_exchange_weak(min_ns, value_ns, std::memory_order_relaxed))
+  {
+  }
+  uint64_t max_ns = max_ns_.load(std::memory_order_relaxed);
+  while (value_ns > max_ns && !max_ns_.compare_exchange_weak(max_ns, value_ns, std::memory_order_relaxed))
+  {
+  }
+  count_.fetch_add(1, std::memory_order_release);
+}
+
+inline uint64_t LatencyHistogram::count() const
+{
+  return count_.load(std::memory_order_acquire);
+}
+
+inline LatencyHistogram::Duration LatencyHistogram::min() const
+{
+  return count() == 0 ? Duration(0) : Duration(min_ns_.load(std::memory_order_relaxed));
+}
+
+inline LatencyHistogram::Duration LatencyHistogram::max() const
+{
+  return Duration(max_ns_.load(std::memory_order_relaxed));
+}
+
+inline LatencyHistogram::Duration LatencyHistogram::mean() const
+{
+  const uint64_t num_values = count();
+  return num_values == 0 ? Duration(0) : Duration(sum_ns_.load(std::memory_order_relaxed) / num_values);
+}
+
+inline LatencyHistogram::Duration LatencyHistogram::percentile(double percentile) const
+{
+  const uint64_t num_values = count();
+  if (num_values == 0)
+  {
+    return Duration(0);
+  }
+
+  percentile = std::min(std::max(percentile, 0.), 100.);
+  const auto rank = std::max(uint64_t{ 1 }, static_cast<uint64_t>(percentile / 100. * num_values + 0.5));
+  uint64_t num_values_below{ 0 };
+  for (std::size_t i = 0; i < NUM_BUCKETS; ++i)
+  {
+    num_values_below += buckets_[i].load(std::memory_order_relaxed);
+    if (num_values_below >= rank)
+    {
+      // The last bucket also contains all values above MAX_VALUE_NS.
+      return i == NUM_BUCKETS - 1 ? max() : std::min(Duration(bucketUpperBound(i)), max());
+    }
+  }
+  return max();
+}
+
+inline LatencyHistogram::Summary LatencyHistogram::summary() const
+{
+  Summary summary;
+  summary.count = count();
+  summary.min = min();
+  summary.max = max();
+  summary.mean = mean();
+  summary.p50 = percentile(50.);
+  summary.p90 = percentile(90.);
+  summary.p99 = percentile(99.);
+  summary.p999 = percentile(99.9);
+  return summary;
+}
+
+inline std::size_t LatencyHistogram::bucketIndex(uint64_t value_ns)
+{
+  value_ns = value_ns > MAX_VALUE_NS ? MAX_VALUE_NS : value_ns;
+  if (value_ns < SUB_BUCKETS)
+  {
+    return static_cast<std::size_t>(value_ns);
+  }
+
+  unsigned int highest_bit{ SUB_BUCKET_BITS };
+  while ((value_ns >> (highest_bit + 1)) != 0)
+  {
+    ++highest_bit;
+  }
+  const unsigned int shift = highest_bit - SUB_BUCKET_BITS;
+  const uint64_t sub_bucket = (value_ns >> shift) & (SUB_BUCKETS - 1);
+  return static_cast<std::size_t>(SUB_BUCKETS * (shift + 1) + sub_bucket);
+}
+
+inline uint64_t LatencyHistogram::bucketUpperBound(std::size_t index)
+{
+  if (index < SUB_BUCKETS)
+  {
+    return index;
+  }
+
+  const unsigned int shift = static_cast<unsigned int>(index / SUB_BUCKETS) - 1;
+  const uint64_t sub_bucket = index % SUB_BUCKETS;
+  return (((SUB_BUCKETS + sub_bucket) + 1) << shift) - 1;
+}
+
+}  // namespace util
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_LATENCY_HISTOGRAM_H
@@ -0,0 +1,100 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_LATEST_VALUE_H
+#define PSEN_SCAN_V2_STANDALONE_LATEST_VALUE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include <boost/optional.hpp>
+
+namespace psen_scan_v2_standalone
+{
+namespace util
+{
+/**
+ * @brief Slot holding the latest value of a producer for consumers polling at their own rate.
+ *
+ * A new value overwrites the previous one, i.e. a slow consumer only misses values instead of building up a queue.
+ * Every value is returned at most once. T only needs to be copy constructible, e.g. LaserScan.
+ */
+template <typename T>
+class LatestValue
+{
+public:
+  //! @brief Replaces the stored value and wakes up the threads waiting in waitForNext().
+  void put(const T& value);
+  //! @returns the stored value if it was not returned before, otherwise boost::none.
+  boost::optional<T> tryTake();
+  /**
+   * @brief Blocks until there is a value which was not returned before.
+   *
+   * @returns the value or boost::none if none arrived within the timeout.
+   */
+  boost::optional<T> waitForNext(const std::chrono::nanoseconds& timeout);
+
+private:
+  boost::optional<T> take();
+
+private:
+  std::mutex mutex_;
+  std::condition_variable value_changed_;
+  boost::optional<T> value_;
+  bool is_new_{ false };
+};
+
+template <typename T>
+inline void LatestValue<T>::put(const T& value)
+{
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    value_.emplace(value);
+    is_new_ = true;
+  }
+  value_changed_.notify_all();
+}
+
+template <typename T>
+inline boost::optional<T> LatestValue<T>::tryTake()
+{
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return take();
+}
+
+template <typename T>
+inline boost::optional<T> LatestValue<T>::waitForNext(const std::chrono::nanoseconds& timeout)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  value_changed_.wait_for(lock, timeout, [this]() { return is_new_; });
+  return take();
+}
+
+template <typename T>
+inline boost::optional<T> LatestValue<T>::take()
+{
+  if (!is_new_)
+  {
+    return boost::none;
+  }
+  is_new_ = false;
+  return value_;
+}
+
+}  // namespace util
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_LATEST_VALUE_H
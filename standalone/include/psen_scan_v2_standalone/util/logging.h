@@ -19,23 +19,45 @@
 #include <chrono>
 #include <console_bridge/console.h>
 #include <sstream>
+#include <string>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include "psen_scan_v2_standalone/util/async_log_sink.h"
+
+/**
+ * @brief Minimal level of log messages which are compiled at all.
+ *
+ * Messages below this level are removed by the compiler, e.g. -DPSENSCAN_MIN_LOG_LEVEL=CONSOLE_BRIDGE_LOG_INFO
+ * removes all PSENSCAN_DEBUG* messages including the formatting of their arguments.
+ */
+#ifndef PSENSCAN_MIN_LOG_LEVEL
+#define PSENSCAN_MIN_LOG_LEVEL CONSOLE_BRIDGE_LOG_DEBUG
+#endif
+
+//! @brief Checks the compile-time and the runtime log level, so that disabled messages are not formatted.
+#define PSENSCAN_LOG_LEVEL_ENABLED(level)                                                                              \
+  (static_cast<int>(level) >= static_cast<int>(PSENSCAN_MIN_LOG_LEVEL) &&                                              \
+   static_cast<int>(level) >= static_cast<int>(console_bridge::getLogLevel()))
+
 #define PSENSCAN_LOG(name, file, line, level, ...)                                                                     \
   do                                                                                                                   \
   {                                                                                                                    \
-    console_bridge::log(file, line, level, fmt::format("{}: {}", name, fmt::format(__VA_ARGS__)).c_str());             \
+    if (PSENSCAN_LOG_LEVEL_ENABLED(level))                                                                             \
+    {                                                                                                                  \
+      psen_scan_v2_standalone::util::AsyncLogSink::log(                                                                \
+          file, line, level, std::string(name) + ": " + fmt::format(__VA_ARGS__));                                     \
+    }                                                                                                                  \
   } while (false)  // https://stackoverflow.com/questions/1067226/c-multi-line-macro-do-while0-vs-scope-block
 
 #define PSENSCAN_LOG_ONCE(name, file, line, level, ...)                                                                \
   do                                                                                                                   \
   {                                                                                                                    \
     static bool already_logged = false;                                                                                \
-    if (!already_logged)                                                                                               \
+    if (!already_logged && PSENSCAN_LOG_LEVEL_ENABLED(level))                                                          \
     {                                                                                                                  \
-      console_bridge::log(file, line, level, fmt::format("{}: {}", name, fmt::format(__VA_ARGS__)).c_str());           \
+      PSENSCAN_LOG(name, file, line, level, __VA_ARGS__);                                                              \
       already_logged = true;                                                                                           \
     }                                                                                                                  \
   } while (false)
@@ -46,12 +68,15 @@
 #define PSENSCAN_LOG_THROTTLE_INTERNAL(now, period, name, file, line, level, ...)                                      \
   do                                                                                                                   \
   {                                                                                                                    \
-    static std::chrono::system_clock::time_point throttle_last_hit;                                                    \
-    auto throttle_now = now;                                                                                           \
-    if (throttle_last_hit + std::chrono::duration<double>(period) < throttle_now)                                      \
+    if (PSENSCAN_LOG_LEVEL_ENABLED(level))                                                                             \
     {                                                                                                                  \
-      throttle_last_hit = throttle_now;                                                                                \
-      PSENSCAN_LOG(name, file, line, level, __VA_ARGS__);                                                              \
+      static std::chrono::system_clock::time_point throttle_last_hit;                                                  \
+      auto throttle_now = now;                                                                                         \
+      if (throttle_last_hit + std::chrono::duration<double>(period) < throttle_now)                                    \
+      {                                                                                                                \
+        throttle_last_hit = throttle_now;                                                                              \
+        PSENSCAN_LOG(name, file, line, level, __VA_ARGS__);                                                            \
+      }                                                                                                                \
     }                                                                                                                  \
   } while (false)  // https://stackoverflow.com/questions/1067226/c-multi-line-macro-do-while0-vs-scope-block
 
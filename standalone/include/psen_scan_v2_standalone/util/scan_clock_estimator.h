@@ -0,0 +1,305 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_SCAN_CLOCK_ESTIMATOR_H
+#define PSEN_SCAN_V2_STANDALONE_SCAN_CLOCK_ESTIMATOR_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "psen_scan_v2_standalone/util/tenth_of_degree.h"
+
+namespace psen_scan_v2_standalone
+{
+namespace util
+{
+//! Number of scans the clock model is fitted to, i.e. 6s with complete scan rounds.
+static constexpr std::size_t SCAN_CLOCK_WINDOW_SIZE{ 200 };
+static constexpr std::size_t SCAN_CLOCK_MIN_NUM_SAMPLES{ 10 };
+static constexpr int64_t SCAN_CLOCK_OUTLIER_THRESHOLD_NS{ 10000000 };
+static constexpr std::size_t SCAN_CLOCK_MAX_CONSECUTIVE_OUTLIERS{ 10 };
+
+/**
+ * @brief Smooths the host timestamps of laser scans with a linear model of the scanner rotation.
+ *
+ * The scanner rotates with a fixed period and numbers its rotations with the scan counter. The position of a
+ * measurement within a rotation is given by its angle. Therefore the time of a ray is a linear function of
+ * x = scan counter + angle / 360°, while the host receive timestamps additionally contain the network and scheduling
+ * jitter of the host.
+ *
+ * estimate() fits a line through the last window_size (x, host timestamp) samples with least squares and returns the
+ * value of the line at the x of the current scan. The line follows a slow drift between the scanner and the host
+ * clock because old samples leave the window.
+ *
+ * Samples deviating more than outlier_threshold from the line are not added to the fit; their timestamp is taken
+ * from the line. If max_consecutive_outliers samples in a row are outliers, e.g. because the host clock jumped, or if
+ * the scan counter decreases, e.g. because the scanner was restarted, the model is started again. Until a new model
+ * contains min_num_samples samples, the host timestamps are returned unchanged.
+ *
+ * The class is not thread-safe.
+ */
+class ScanClockEstimator
+{
+public:
+  struct Statistics
+  {
+    //! Number of all scans passed to estimate().
+    uint64_t num_scans{ 0 };
+    //! Number of scans whose timestamp was taken from the model.
+    uint64_t num_estimated_scans{ 0 };
+    //! Number of scans which were not added to the model because of their deviation from it.
+    uint64_t num_outliers{ 0 };
+    //! Number of times the model was started again.
+    uint64_t num_resets{ 0 };
+    //! Current estimate of the rotation period or 0 if there is no model.
+    double period_ns{ 0. };
+    //! Mean of the host timestamps minus the estimated timestamps.
+    double residual_mean_ns{ 0. };
+    //! Root mean square of the host timestamps minus the estimated timestamps.
+    double residual_rms_ns{ 0. };
+    //! Maximum absolute difference between a host timestamp and its estimated timestamp.
+    double residual_max_abs_ns{ 0. };
+  };
+
+public:
+  /**
+   * @throws std::invalid_argument if min_num_samples is smaller than 2 or larger than window_size or if the
+   * outlier_threshold_ns is not positive.
+   */
+  explicit ScanClockEstimator(const std::size_t& window_size = SCAN_CLOCK_WINDOW_SIZE,
+                              const std::size_t& min_num_samples = SCAN_CLOCK_MIN_NUM_SAMPLES,
+                              const int64_t& outlier_threshold_ns = SCAN_CLOCK_OUTLIER_THRESHOLD_NS,
+                              const std::size_t& max_consecutive_outliers = SCAN_CLOCK_MAX_CONSECUTIVE_OUTLIERS);
+
+public:
+  /**
+   * @returns the smoothed timestamp in nanoseconds of the ray at the specified angle.
+   *
+   * @param scan_counter Scan counter of the rotation the ray belongs to.
+   * @param angle Angle of the ray.
+   * @param host_timestamp Time of the ray in nanoseconds derived from the host receive timestamp.
+   */
+  int64_t estimate(const uint32_t& scan_counter, const TenthOfDegree& angle, const int64_t& host_timestamp);
+  Statistics statistics() const;
+  //! Discards the model but keeps the statistics.
+  void reset();
+
+private:
+  struct Sample
+  {
+    //! Number of rotations since the first sample of the model.
+    double x;
+    //! Nanoseconds since the first sample of the model.
+    double t;
+  };
+
+  bool hasModel() const;
+  double predict(const double& x) const;
+  void addSample(const Sample& sample);
+  void fit();
+  void restart(const uint32_t& scan_counter, const int64_t& host_timestamp);
+  void recordResidual(const double& residual_ns);
+
+private:
+  const std::size_t window_size_;
+  const std::size_t min_num_samples_;
+  const double outlier_threshold_ns_;
+  const std::size_t max_consecutive_outliers_;
+
+  //! Ring buffer of the samples in the window, next_sample_ is the position of the oldest one.
+  std::vector<Sample> samples_;
+  std::size_t next_sample_{ 0 };
+  std::size_t num_consecutive_outliers_{ 0 };
+
+  bool started_{ false };
+  uint32_t last_scan_counter_{ 0 };
+  int64_t num_rotations_{ 0 };
+  int64_t reference_timestamp_{ 0 };
+
+  //! Model t = intercept_ + slope_ * (x - x_mean_)
+  double x_mean_{ 0. };
+  double intercept_{ 0. };
+  double slope_{ 0. };
+
+  Statistics statistics_;
+  double residual_sum_{ 0. };
+  double residual_square_sum_{ 0. };
+};
+
+inline ScanClockEstimator::ScanClockEstimator(const std::size_t& window_size,
+                                              const std::size_t& min_num_samples,
+                                              const int64_t& outlier_threshold_ns,
+                                              const std::size_t& max_consecutive_outliers)
+  : window_size_(window_size)
+  , min_num_samples_(min_num_samples)
+  , outlier_threshold_ns_(static_cast<double>(outlier_threshold_ns))
+  , max_consecutive_outliers_(max_consecutive_outliers)
+{
+  if (min_num_samples_ < 2 || min_num_samples_ > window_size_)
+  {
+    throw std::invalid_argument("The minimal number of samples has to be within [2, window size]");
+  }
+  if (outlier_threshold_ns <= 0)
+  {
+    throw std::invalid_argument("The outlier threshold has to be positive");
+  }
+  samples_.reserve(window_size_);
+}
+
+inline int64_t ScanClockEstimator::estimate(const uint32_t& scan_counter,
+                                            const TenthOfDegree& angle,
+                                            const int64_t& host_timestamp)
+{
+  ++statistics_.num_scans;
+
+  const uint32_t counter_increase{ static_cast<uint32_t>(scan_counter - last_scan_counter_) };  // Handles wrap around
+  if (!started_ || counter_increase > std::numeric_limits<uint32_t>::max() / 2)
+  {
+    restart(scan_counter, host_timestamp);
+  }
+  else
+  {
+    num_rotations_ += counter_increase;
+    last_scan_counter_ = scan_counter;
+  }
+
+  const Sample sample{ static_cast<double>(num_rotations_) + angle.value() / 3600.,
+                       static_cast<double>(host_timestamp - reference_timestamp_) };
+  if (!hasModel())
+  {
+    addSample(sample);
+    fit();
+    return host_timestamp;
+  }
+
+  if (std::abs(sample.t - predict(sample.x)) > outlier_threshold_ns_)
+  {
+    ++statistics_.num_outliers;
+    if (++num_consecutive_outliers_ >= max_consecutive_outliers_)
+    {
+      restart(scan_counter, host_timestamp);
+      addSample({ angle.value() / 3600., 0. });
+      fit();
+      return host_timestamp;
+    }
+  }
+  else
+  {
+    num_consecutive_outliers_ = 0;
+    addSample(sample);
+    fit();
+  }
+
+  const double estimated{ predict(sample.x) };
+  ++statistics_.num_estimated_scans;
+  recordResidual(sample.t - estimated);
+  return reference_timestamp_ + static_cast<int64_t>(std::llround(estimated));
+}
+
+inline ScanClockEstimator::Statistics ScanClockEstimator::statistics() const
+{
+  Statistics statistics{ statistics_ };
+  statistics.period_ns = hasModel() ? slope_ : 0.;
+  if (statistics.num_estimated_scans > 0)
+  {
+    const auto n{ static_cast<double>(statistics.num_estimated_scans) };
+    statistics.residual_mean_ns = residual_sum_ / n;
+    statistics.residual_rms_ns = std::sqrt(residual_square_sum_ / n);
+  }
+  return statistics;
+}
+
+inline void ScanClockEstimator::reset()
+{
+  started_ = false;
+  samples_.clear();
+  next_sample_ = 0;
+  num_consecutive_outliers_ = 0;
+}
+
+inline bool ScanClockEstimator::hasModel() const
+{
+  return samples_.size() >= min_num_samples_;
+}
+
+inline double ScanClockEstimator::predict(const double& x) const
+{
+  return intercept_ + slope_ * (x - x_mean_);
+}
+
+inline void ScanClockEstimator::addSample(const Sample& sample)
+{
+  if (samples_.size() < window_size_)
+  {
+    samples_.push_back(sample);
+    return;
+  }
+  samples_[next_sample_] = sample;
+  next_sample_ = (next_sample_ + 1) % window_size_;
+}
+
+inline void ScanClockEstimator::fit()
+{
+  const auto n{ static_cast<double>(samples_.size()) };
+  double x_sum{ 0. };
+  double t_sum{ 0. };
+  for (const auto& sample : samples_)
+  {
+    x_sum += sample.x;
+    t_sum += sample.t;
+  }
+  x_mean_ = x_sum / n;
+  intercept_ = t_sum / n;
+
+  // Centered sums keep the precision independent of the distance to the reference sample.
+  double xx_sum{ 0. };
+  double xt_sum{ 0. };
+  for (const auto& sample : samples_)
+  {
+    xx_sum += (sample.x - x_mean_) * (sample.x - x_mean_);
+    xt_sum += (sample.x - x_mean_) * (sample.t - intercept_);
+  }
+  slope_ = xx_sum > 0. ? xt_sum / xx_sum : 0.;
+}
+
+inline void ScanClockEstimator::restart(const uint32_t& scan_counter, const int64_t& host_timestamp)
+{
+  if (started_)
+  {
+    ++statistics_.num_resets;
+  }
+  reset();
+  started_ = true;
+  last_scan_counter_ = scan_counter;
+  num_rotations_ = 0;
+  reference_timestamp_ = host_timestamp;
+}
+
+inline void ScanClockEstimator::recordResidual(const double& residual_ns)
+{
+  residual_sum_ += residual_ns;
+  residual_square_sum_ += residual_ns * residual_ns;
+  statistics_.residual_max_abs_ns = std::max(statistics_.residual_max_abs_ns, std::abs(residual_ns));
+}
+
+}  // namespace util
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_SCAN_CLOCK_ESTIMATOR_H
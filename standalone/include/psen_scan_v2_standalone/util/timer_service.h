@@ -0,0 +1,283 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_TIMER_SERVICE_H
+#define PSEN_SCAN_V2_STANDALONE_TIMER_SERVICE_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace psen_scan_v2_standalone
+{
+namespace util
+{
+/**
+ * @brief Single thread serving the timeouts of all registered timers.
+ *
+ * All timers share the thread of the service. Timers are registered once and can afterwards be started, reset and
+ * stopped without allocation or thread creation.
+ *
+ * @see TimerService::Timer
+ */
+class TimerService
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  class Timer;
+
+public:
+  TimerService();
+  ~TimerService();
+
+  //! @returns the service shared by all users. It is created on first use and destroyed with its last user.
+  static std::shared_ptr<TimerService> shared();
+
+private:
+  void run();
+  void add(Timer* timer);
+  void remove(Timer* timer);
+  void wakeUp();
+  //! @returns true if a timer fired. The timers have to be re-evaluated in this case.
+  bool fireExpiredTimer(std::unique_lock<std::mutex>& lk, Clock::time_point& next_deadline);
+
+private:
+  std::vector<Timer*> timers_;
+  Timer* running_timer_{ nullptr };
+  bool terminated_{ false };
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::condition_variable callback_finished_cv_;
+  std::thread thread_;
+};
+
+/**
+ * @brief Timer which continuously calls the specified timeout callback while it is started
+ *
+ * After the specified timeout has passed without reset() the timeout_callback is called from the thread of the
+ * TimerService and the timer restarts. This continues until stop() is called or the timer is destroyed.
+ *
+ * start() and stop() are O(1) and do not allocate. reset() only stores the new deadline in an atomic.
+ */
+class TimerService::Timer
+{
+public:
+  Timer(const Clock::duration& timeout,
+        const std::function<void()>& timeout_callback,
+        const std::shared_ptr<TimerService>& service = TimerService::shared());
+  /**
+   * @brief Unregisters the timer. Waits until a currently running timeout callback of this timer has finished.
+   *
+   * @note A timer must not be destroyed by its own timeout callback.
+   */
+  ~Timer();
+
+  Timer(const Timer&) = delete;
+  Timer& operator=(const Timer&) = delete;
+
+public:
+  void start();
+  //! @brief Restarts the timeout of a started timer.
+  void reset();
+  void stop();
+  bool isStarted() const;
+
+private:
+  static Clock::rep toRep(const Clock::time_point& time_point);
+  static Clock::time_point toTimePoint(const Clock::rep& rep);
+
+private:
+  friend class TimerService;
+
+  const Clock::duration timeout_;
+  const std::function<void()> timeout_callback_;
+  std::atomic<Clock::rep> deadline_{ 0 };
+  std::atomic_bool started_{ false };
+  //! Incremented by start() and stop() to detect that a timeout became obsolete while it was about to be handled.
+  std::atomic<uint64_t> generation_{ 0 };
+  std::shared_ptr<TimerService> service_;
+};
+
+inline TimerService::TimerService() : thread_([this]() { run(); })
+{
+}
+
+inline TimerService::~TimerService()
+{
+  {
+    std::lock_guard<std::mutex> lk(mutex_);
+    terminated_ = true;
+  }
+  cv_.notify_all();
+  if (thread_.joinable())
+  {
+    thread_.join();
+  }
+}
+
+inline std::shared_ptr<TimerService> TimerService::shared()
+{
+  static std::mutex mutex;
+  static std::weak_ptr<TimerService> service;
+
+  std::lock_guard<std::mutex> lk(mutex);
+  auto shared_service = service.lock();
+  if (!shared_service)
+  {
+    shared_service = std::make_shared<TimerService>();
+    service = shared_service;
+  }
+  return shared_service;
+}
+
+inline void TimerService::run()
+{
+  std::unique_lock<std::mutex> lk(mutex_);
+  while (!terminated_)
+  {
+    Clock::time_point next_deadline{ Clock::time_point::max() };
+    if (fireExpiredTimer(lk, next_deadline))
+    {
+      continue;
+    }
+
+    if (next_deadline == Clock::time_point::max())
+    {
+      cv_.wait(lk);
+    }
+    else
+    {
+      cv_.wait_until(lk, next_deadline);
+    }
+  }
+}
+
+inline bool TimerService::fireExpiredTimer(std::unique_lock<std::mutex>& lk, Clock::time_point& next_deadline)
+{
+  const auto now = Clock::now();
+  for (Timer* timer : timers_)
+  {
+    if (!timer->started_)
+    {
+      continue;
+    }
+
+    auto deadline = timer->deadline_.load();
+    if (now < Timer::toTimePoint(deadline))
+    {
+      next_deadline = std::min(next_deadline, Timer::toTimePoint(deadline));
+      continue;
+    }
+
+    // Restart the timer unless reset() already postponed the deadline in the meantime.
+    timer->deadline_.compare_exchange_strong(deadline, Timer::toRep(now + timer->timeout_));
+
+    const auto generation = timer->generation_.load();
+    running_timer_ = timer;
+    lk.unlock();
+    if (timer->started_ && generation == timer->generation_)
+    {
+      timer->timeout_callback_();
+    }
+    lk.lock();
+    running_timer_ = nullptr;
+    callback_finished_cv_.notify_all();
+    return true;
+  }
+  return false;
+}
+
+inline void TimerService::add(Timer* timer)
+{
+  std::lock_guard<std::mutex> lk(mutex_);
+  timers_.push_back(timer);
+}
+
+inline void TimerService::remove(Timer* timer)
+{
+  std::unique_lock<std::mutex> lk(mutex_);
+  timers_.erase(std::remove(timers_.begin(), timers_.end(), timer), timers_.end());
+  callback_finished_cv_.wait(lk, [this, timer]() { return running_timer_ != timer; });
+}
+
+inline void TimerService::wakeUp()
+{
+  {
+    // Taking the lock ensures that the service thread either has not yet evaluated the timers or already waits.
+    std::lock_guard<std::mutex> lk(mutex_);
+  }
+  cv_.notify_one();
+}
+
+inline TimerService::Timer::Timer(const Clock::duration& timeout,
+                                  const std::function<void()>& timeout_callback,
+                                  const std::shared_ptr<TimerService>& service)
+  : timeout_(timeout), timeout_callback_(timeout_callback), service_(service)
+{
+  service_->add(this);
+}
+
+inline TimerService::Timer::~Timer()
+{
+  started_ = false;
+  service_->remove(this);
+}
+
+inline void TimerService::Timer::start()
+{
+  deadline_ = toRep(Clock::now() + timeout_);
+  ++generation_;
+  started_ = true;
+  service_->wakeUp();
+}
+
+inline void TimerService::Timer::reset()
+{
+  deadline_.store(toRep(Clock::now() + timeout_), std::memory_order_relaxed);
+}
+
+inline void TimerService::Timer::stop()
+{
+  started_ = false;
+  ++generation_;
+}
+
+inline bool TimerService::Timer::isStarted() const
+{
+  return started_;
+}
+
+inline TimerService::Clock::rep TimerService::Timer::toRep(const Clock::time_point& time_point)
+{
+  return time_point.time_since_epoch().count();
+}
+
+inline TimerService::Clock::time_point TimerService::Timer::toTimePoint(const Clock::rep& rep)
+{
+  return Clock::time_point(Clock::duration(rep));
+}
+
+}  // namespace util
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_TIMER_SERVICE_H
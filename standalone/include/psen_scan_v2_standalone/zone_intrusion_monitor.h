@@ -0,0 +1,183 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PSEN_SCAN_V2_STANDALONE_ZONE_INTRUSION_MONITOR_H
+#define PSEN_SCAN_V2_STANDALONE_ZONE_INTRUSION_MONITOR_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "psen_scan_v2_standalone/configuration/zoneset_configuration.h"
+#include "psen_scan_v2_standalone/laserscan.h"
+#include "psen_scan_v2_standalone/util/tenth_of_degree.h"
+
+namespace psen_scan_v2_standalone
+{
+//! @brief Fields of a configuration::ZoneSet.
+enum class ZoneField
+{
+  safety1,
+  safety2,
+  safety3,
+  warn1,
+  warn2,
+  muting1,
+  muting2
+};
+
+static constexpr std::size_t NUMBER_OF_ZONE_FIELDS{ 7 };
+
+//! @brief Exception thrown if the active zoneset of a scan is not part of the zoneset configuration.
+class ZoneSetNotConfigured : public std::runtime_error
+{
+public:
+  ZoneSetNotConfigured(const std::string& msg) : std::runtime_error(msg)
+  {
+  }
+};
+
+//! @brief Result of the comparison of a laser scan with a single field of a zoneset.
+class FieldIntrusion
+{
+public:
+  //! @return false if the field is not defined in the zoneset.
+  bool configured() const
+  {
+    return configured_;
+  }
+  //! @return true if at least one beam lies inside of the field.
+  bool intruded() const
+  {
+    return num_intrusions_ > 0;
+  }
+  //! @return number of beams lying inside of the field.
+  std::size_t numIntrusions() const
+  {
+    return num_intrusions_;
+  }
+  //! @return one entry per beam of the scan which is 1 if the beam lies inside of the field and 0 otherwise.
+  const std::vector<uint8_t>& intrusionMask() const
+  {
+    return intrusion_mask_;
+  }
+  /**
+   * @return smallest difference between measurement and field border in m over all beams covered by the field.
+   * A negative value describes the depth of the deepest intrusion. Infinity if no beam is covered by the field.
+   */
+  double minMargin() const
+  {
+    return min_margin_;
+  }
+
+private:
+  friend class ZoneIntrusionMonitor;
+
+  bool configured_{ false };
+  std::size_t num_intrusions_{ 0 };
+  std::vector<uint8_t> intrusion_mask_{};
+  double min_margin_{ std::numeric_limits<double>::infinity() };
+};
+
+//! @brief Result of the comparison of a laser scan with all fields of the active zoneset.
+class ZoneSetIntrusion
+{
+public:
+  const FieldIntrusion& field(const ZoneField& field) const
+  {
+    return fields_.at(static_cast<std::size_t>(field));
+  }
+  //! @return true if at least one beam lies inside of any of the fields.
+  bool intruded() const;
+
+private:
+  friend class ZoneIntrusionMonitor;
+
+  std::array<FieldIntrusion, NUMBER_OF_ZONE_FIELDS> fields_{};
+};
+
+/**
+ * @brief Computes in software which beams of a laser scan lie inside of which field of the active zoneset.
+ *
+ * The radii of the zonesets are defined in steps of configuration::ZoneSet::resolution_ starting at 0 degree
+ * of the scanner. They are linearly interpolated onto the angular grid of the scan. This is only done once for every
+ * combination of zoneset, scan range and scan resolution, afterwards the cached result is used.
+ *
+ * The actual comparison is a branch free loop over contiguous memory which can be vectorized by the compiler.
+ *
+ * @note The class is not thread safe. Use one instance per scanner.
+ * @note This is no replacement for the safety functions of the scanner. Use it for diagnostics and
+ * early warnings only.
+ */
+class ZoneIntrusionMonitor
+{
+public:
+  explicit ZoneIntrusionMonitor(const configuration::ZoneSetConfiguration& zoneset_config);
+
+  /**
+   * @brief Compares the scan with all fields of the zoneset which is active in the scan.
+   *
+   * @param scan The laser scan to check.
+   * @param result Memory for the result. It is reused in order to avoid allocations on consecutive calls.
+   *
+   * @throws ZoneSetNotConfigured if the active zoneset of the scan is not part of the zoneset configuration.
+   */
+  void check(const LaserScan& scan, ZoneSetIntrusion& result);
+
+  //! @brief Convenience overload of check(const LaserScan&, ZoneSetIntrusion&).
+  ZoneSetIntrusion check(const LaserScan& scan);
+
+  //! @return number of cached resampled zonesets.
+  std::size_t cacheSize() const;
+
+private:
+  //! @brief Field radii in m on the angular grid of a scan. -infinity marks beams not covered by the field.
+  using ResampledField = std::vector<double>;
+  struct ResampledZoneSet
+  {
+    std::array<ResampledField, NUMBER_OF_ZONE_FIELDS> fields_;
+    std::array<bool, NUMBER_OF_ZONE_FIELDS> configured_;
+  };
+  using CacheKey = std::tuple<uint8_t, int16_t, int16_t, int16_t, std::size_t>;
+
+private:
+  const ResampledZoneSet& resampledZoneSet(const LaserScan& scan);
+  static ResampledZoneSet resample(const configuration::ZoneSet& zoneset,
+                                   const util::TenthOfDegree& min_scan_angle,
+                                   const util::TenthOfDegree& scan_resolution,
+                                   std::size_t num_beams);
+  static ResampledField resample(const std::vector<unsigned long>& radii_in_mm,
+                                 const util::TenthOfDegree& zoneset_resolution,
+                                 const util::TenthOfDegree& min_scan_angle,
+                                 const util::TenthOfDegree& scan_resolution,
+                                 std::size_t num_beams);
+  static void compare(const LaserScan::MeasurementData& measurements,
+                      const ResampledField& radii,
+                      FieldIntrusion& result);
+
+private:
+  const configuration::ZoneSetConfiguration zoneset_config_;
+  std::map<CacheKey, ResampledZoneSet> cache_{};
+};
+
+}  // namespace psen_scan_v2_standalone
+
+#endif  // PSEN_SCAN_V2_STANDALONE_ZONE_INTRUSION_MONITOR_H
@@ -13,11 +13,15 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
 #include <tinyxml2.h>
 #include <fmt/format.h>
 
 #include "psen_scan_v2_standalone/configuration/xml_configuration_parsing.h"
 #include "psen_scan_v2_standalone/configuration/zoneset_configuration.h"
+#include "psen_scan_v2_standalone/configuration/zoneset_configuration_cache.h"
+#include "psen_scan_v2_standalone/util/logging.h"
 
 namespace psen_scan_v2_standalone
 {
@@ -259,6 +263,46 @@ ZoneSetConfiguration parseFile(const char* filename)
   return parseTinyXML(doc);
 }
 
+ZoneSetConfiguration parseFile(const char* filename, const std::string& cache_filename)
+{
+  boost::interprocess::mapped_region region;
+  try
+  {
+    boost::interprocess::file_mapping file(filename, boost::interprocess::read_only);
+    region = boost::interprocess::mapped_region(file, boost::interprocess::read_only);
+  }
+  catch (const boost::interprocess::interprocess_exception&)
+  {
+    throw XMLConfigurationParserException(fmt::format("Could not parse {}.", filename));
+  }
+  const char* xml = static_cast<const char*>(region.get_address());
+  const std::size_t xml_size = region.get_size();
+
+  const auto key = zoneset_configuration_cache::hash(xml, xml_size);
+  const auto cached_config = zoneset_configuration_cache::load(cache_filename, key);
+  if (cached_config)
+  {
+    return *cached_config;
+  }
+
+  tinyxml2::XMLDocument doc;
+  if (doc.Parse(xml, xml_size) != tinyxml2::XML_SUCCESS)
+  {
+    throw XMLConfigurationParserException(fmt::format("Could not parse {}.", filename));
+  }
+  const auto zoneset_config = parseTinyXML(doc);
+
+  try
+  {
+    zoneset_configuration_cache::store(cache_filename, zoneset_config, key);
+  }
+  catch (const zoneset_configuration_cache::ZoneSetConfigurationCacheException& e)
+  {
+    PSENSCAN_WARN("XMLConfigurationParser", "Could not cache the configuration of {}: {}", filename, e.what());
+  }
+  return zoneset_config;
+}
+
 ZoneSetConfiguration parseString(const char* xml)
 {
   tinyxml2::XMLDocument doc;
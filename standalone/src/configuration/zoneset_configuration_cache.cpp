@@ -0,0 +1,254 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <fmt/format.h>
+
+#include "psen_scan_v2_standalone/configuration/zoneset_configuration_cache.h"
+
+namespace psen_scan_v2_standalone
+{
+namespace configuration
+{
+namespace zoneset_configuration_cache
+{
+namespace
+{
+template <typename T>
+void write(std::string& data, const T& value)
+{
+  data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void writeRadii(std::string& data, const std::vector<unsigned long>& radii)
+{
+  write(data, static_cast<uint32_t>(radii.size()));
+  for (const auto& radius : radii)
+  {
+    if (radius > std::numeric_limits<uint16_t>::max())
+    {
+      throw ZoneSetConfigurationCacheException(fmt::format("Radius {} cannot be cached.", radius));
+    }
+    write(data, static_cast<uint16_t>(radius));
+  }
+}
+
+//! Bounds checked sequential access to the (memory-mapped) cache data.
+class Reader
+{
+public:
+  Reader(const char* data, const std::size_t& size) : data_(data), size_(size)
+  {
+  }
+
+  template <typename T>
+  bool read(T& value)
+  {
+    if (size_ - pos_ < sizeof(T))
+    {
+      return false;
+    }
+    std::memcpy(&value, data_ + pos_, sizeof(T));
+    pos_ += sizeof(T);
+    return true;
+  }
+
+  bool readRadii(std::vector<unsigned long>& radii)
+  {
+    uint32_t count;
+    if (!read(count) || (size_ - pos_) / sizeof(uint16_t) < count)
+    {
+      return false;
+    }
+    radii.resize(count);
+    for (auto& radius : radii)
+    {
+      uint16_t value;
+      read(value);
+      radius = value;
+    }
+    return true;
+  }
+
+  std::size_t remaining() const
+  {
+    return size_ - pos_;
+  }
+
+  bool atEnd() const
+  {
+    return pos_ == size_;
+  }
+
+private:
+  const char* data_;
+  std::size_t size_;
+  std::size_t pos_{ 0 };
+};
+
+//! Encoded size of a zoneset without any radii: resolution, speed range flag, min and max speed and the radii counts.
+constexpr std::size_t MIN_ENCODED_ZONESET_SIZE{ sizeof(int16_t) + sizeof(uint8_t) + 2 * sizeof(short) +
+                                                7 * sizeof(uint32_t) };
+
+std::array<const std::vector<unsigned long>*, 7> fieldsOf(const ZoneSet& zoneset)
+{
+  return { { &zoneset.safety1_,
+             &zoneset.safety2_,
+             &zoneset.safety3_,
+             &zoneset.warn1_,
+             &zoneset.warn2_,
+             &zoneset.muting1_,
+             &zoneset.muting2_ } };
+}
+
+std::array<std::vector<unsigned long>*, 7> fieldsOf(ZoneSet& zoneset)
+{
+  return { { &zoneset.safety1_,
+             &zoneset.safety2_,
+             &zoneset.safety3_,
+             &zoneset.warn1_,
+             &zoneset.warn2_,
+             &zoneset.muting1_,
+             &zoneset.muting2_ } };
+}
+}  // namespace
+
+uint64_t hash(const char* data, const std::size_t& size)
+{
+  uint64_t result{ 14695981039346656037ULL };
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    result ^= static_cast<unsigned char>(data[i]);
+    result *= 1099511628211ULL;
+  }
+  return result;
+}
+
+std::string serialize(const ZoneSetConfiguration& zoneset_config, const uint64_t& key)
+{
+  std::string data;
+  write(data, MAGIC);
+  write(data, VERSION);
+  write(data, key);
+  write(data, static_cast<uint32_t>(zoneset_config.zonesets_.size()));
+
+  for (const auto& zoneset : zoneset_config.zonesets_)
+  {
+    write(data, zoneset.resolution_.value());
+    write(data, static_cast<uint8_t>(zoneset.speed_range_.is_initialized()));
+    write(data, zoneset.speed_range_ ? zoneset.speed_range_->min_ : static_cast<short>(0));
+    write(data, zoneset.speed_range_ ? zoneset.speed_range_->max_ : static_cast<short>(0));
+    for (const auto* radii : fieldsOf(zoneset))
+    {
+      writeRadii(data, *radii);
+    }
+  }
+  return data;
+}
+
+boost::optional<ZoneSetConfiguration> deserialize(const char* data, const std::size_t& size, const uint64_t& key)
+{
+  Reader reader(data, size);
+
+  uint32_t magic, version, num_zonesets;
+  uint64_t stored_key;
+  // The number of zonesets is checked against the remaining data before any zoneset is allocated
+  if (!reader.read(magic) || magic != MAGIC || !reader.read(version) || version != VERSION ||
+      !reader.read(stored_key) || stored_key != key || !reader.read(num_zonesets) ||
+      reader.remaining() / MIN_ENCODED_ZONESET_SIZE < num_zonesets)
+  {
+    return boost::none;
+  }
+
+  ZoneSetConfiguration zoneset_config;
+  zoneset_config.zonesets_.resize(num_zonesets);
+  for (auto& zoneset : zoneset_config.zonesets_)
+  {
+    int16_t resolution;
+    uint8_t has_speed_range;
+    short min_speed, max_speed;
+    if (!reader.read(resolution) || !reader.read(has_speed_range) || !reader.read(min_speed) ||
+        !reader.read(max_speed) || min_speed > max_speed)
+    {
+      return boost::none;
+    }
+    zoneset.resolution_ = util::TenthOfDegree(resolution);
+    if (has_speed_range)
+    {
+      zoneset.speed_range_ = ZoneSetSpeedRange(min_speed, max_speed);
+    }
+    for (auto* radii : fieldsOf(zoneset))
+    {
+      if (!reader.readRadii(*radii))
+      {
+        return boost::none;
+      }
+    }
+  }
+
+  if (!reader.atEnd())
+  {
+    return boost::none;
+  }
+  return zoneset_config;
+}
+
+boost::optional<ZoneSetConfiguration> load(const std::string& filename, const uint64_t& key)
+{
+  try
+  {
+    boost::interprocess::file_mapping file(filename.c_str(), boost::interprocess::read_only);
+    boost::interprocess::mapped_region region(file, boost::interprocess::read_only);
+    return deserialize(static_cast<const char*>(region.get_address()), region.get_size(), key);
+  }
+  catch (const boost::interprocess::interprocess_exception&)
+  {  // missing or empty file
+    return boost::none;
+  }
+}
+
+void store(const std::string& filename, const ZoneSetConfiguration& zoneset_config, const uint64_t& key)
+{
+  const std::string data{ serialize(zoneset_config, key) };
+  const std::string tmp_filename{ filename + ".tmp" };
+  {
+    std::ofstream file(tmp_filename, std::ios::binary | std::ios::trunc);
+    file.write(data.data(), data.size());
+    if (!file)
+    {
+      throw ZoneSetConfigurationCacheException(fmt::format("Could not write {}.", tmp_filename));
+    }
+  }
+
+  // Windows does not replace an existing file on rename
+  if (std::rename(tmp_filename.c_str(), filename.c_str()) != 0 &&
+      (std::remove(filename.c_str()) != 0 || std::rename(tmp_filename.c_str(), filename.c_str()) != 0))
+  {
+    std::remove(tmp_filename.c_str());
+    throw ZoneSetConfigurationCacheException(fmt::format("Could not write {}.", filename));
+  }
+}
+
+}  // namespace zoneset_configuration_cache
+}  // namespace configuration
+}  // namespace psen_scan_v2_standalone
@@ -13,7 +13,10 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+#include <algorithm>
+#include <cstring>
 #include <ostream>
+#include <stdexcept>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
@@ -42,6 +45,124 @@ std::ostream& operator<<(std::ostream& os, const Message& msg)
   return os;
 }
 
+static ErrorMask createValidBitsMask()
+{
+  ErrorMask valid_bits;
+  for (const auto& scanner_id : configuration::VALID_SCANNER_IDS)
+  {
+    for (std::size_t byte_n = 0; byte_n < RAW_CHUNK_LENGTH_FOR_ONE_DEVICE_IN_BYTES; ++byte_n)
+    {
+      for (std::size_t bit_n = 0; bit_n < ERROR_BITS[byte_n].size(); ++bit_n)
+      {
+        if (ERROR_BITS[byte_n][bit_n] != ErrorType::unused)
+        {
+          valid_bits.set(Message(scanner_id, ErrorLocation(byte_n, bit_n)));
+        }
+      }
+    }
+  }
+  return valid_bits;
+}
+
+ErrorMask::ErrorMask(const RawBytes& raw_bytes)
+{
+  static const ErrorMask VALID_BITS{ createValidBitsMask() };
+
+  std::memcpy(bytes(), raw_bytes.data(), NUM_BYTES);
+  for (std::size_t i = 0; i < NUM_WORDS; ++i)
+  {
+    words_[i] &= VALID_BITS.words_[i];
+  }
+}
+
+ErrorMask::ErrorMask(const std::vector<Message>& messages)
+{
+  for (const auto& msg : messages)
+  {
+    set(msg);
+  }
+}
+
+std::size_t ErrorMask::byteIndex(const Message& msg)
+{
+  const auto location{ msg.errorLocation() };
+  if (location.byte() >= RAW_CHUNK_LENGTH_FOR_ONE_DEVICE_IN_BYTES || location.bit() >= 8)
+  {
+    throw std::out_of_range(
+        fmt::format("Invalid location (Byte:{} Bit:{}) of a diagnostic message.", location.byte(), location.bit()));
+  }
+  return static_cast<std::size_t>(msg.scannerId()) * RAW_CHUNK_LENGTH_FOR_ONE_DEVICE_IN_BYTES + location.byte();
+}
+
+const uint8_t* ErrorMask::bytes() const
+{
+  return reinterpret_cast<const uint8_t*>(words_.data());
+}
+
+uint8_t* ErrorMask::bytes()
+{
+  return reinterpret_cast<uint8_t*>(words_.data());
+}
+
+void ErrorMask::set(const Message& msg)
+{
+  bytes()[byteIndex(msg)] |= static_cast<uint8_t>(1u << msg.errorLocation().bit());
+}
+
+bool ErrorMask::test(const Message& msg) const
+{
+  return (bytes()[byteIndex(msg)] >> msg.errorLocation().bit()) & 1u;
+}
+
+bool ErrorMask::none() const
+{
+  return std::all_of(words_.begin(), words_.end(), [](const uint64_t& word) { return word == 0; });
+}
+
+std::vector<Message> ErrorMask::messages() const
+{
+  std::vector<Message> messages;
+  if (none())
+  {
+    return messages;
+  }
+  for (std::size_t i = 0; i < NUM_BYTES; ++i)
+  {
+    const uint8_t raw_byte{ bytes()[i] };
+    if (raw_byte == 0)
+    {
+      continue;
+    }
+    for (std::size_t bit_n = 0; bit_n < 8; ++bit_n)
+    {
+      if ((raw_byte >> bit_n) & 1u)
+      {
+        messages.emplace_back(configuration::VALID_SCANNER_IDS[i / RAW_CHUNK_LENGTH_FOR_ONE_DEVICE_IN_BYTES],
+                              ErrorLocation(i % RAW_CHUNK_LENGTH_FOR_ONE_DEVICE_IN_BYTES, bit_n));
+      }
+    }
+  }
+  return messages;
+}
+
+ErrorMask ErrorMask::device(const configuration::ScannerId& id) const
+{
+  const std::size_t offset{ static_cast<std::size_t>(id) * RAW_CHUNK_LENGTH_FOR_ONE_DEVICE_IN_BYTES };
+  ErrorMask device_errors;
+  std::memcpy(device_errors.bytes() + offset, bytes() + offset, RAW_CHUNK_LENGTH_FOR_ONE_DEVICE_IN_BYTES);
+  return device_errors;
+}
+
+bool ErrorMask::operator==(const ErrorMask& rhs) const
+{
+  return words_ == rhs.words_;
+}
+
+bool ErrorMask::operator!=(const ErrorMask& rhs) const
+{
+  return !(*this == rhs);
+}
+
 }  // namespace diagnostic
 }  // namespace monitoring_frame
 }  // namespace data_conversion_layer
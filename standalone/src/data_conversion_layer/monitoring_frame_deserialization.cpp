@@ -142,7 +142,7 @@ monitoring_frame::Message deserialize(const data_conversion_layer::RawData& data
         break;
 
       case AdditionalFieldHeaderID::diagnostics:
-        msg_builder.diagnosticMessages(diagnostic::deserializeMessages(ss));
+        msg_builder.diagnosticErrors(diagnostic::deserializeErrors(ss));
         break;
 
       case AdditionalFieldHeaderID::intensities: {
@@ -201,31 +201,11 @@ PinData deserializePins(std::istream& is)
 
 namespace diagnostic
 {
-std::vector<diagnostic::Message> deserializeMessages(std::istream& is)
+ErrorMask deserializeErrors(std::istream& is)
 {
-  std::vector<diagnostic::Message> diagnostic_messages;
-
   // Read-in unused data fields
   raw_processing::read<std::array<uint8_t, diagnostic::RAW_CHUNK_UNUSED_OFFSET_IN_BYTES>>(is);
-
-  for (const auto& scanner_id : configuration::VALID_SCANNER_IDS)
-  {
-    for (size_t byte_n = 0; byte_n < diagnostic::RAW_CHUNK_LENGTH_FOR_ONE_DEVICE_IN_BYTES; byte_n++)
-    {
-      const auto raw_byte = raw_processing::read<uint8_t>(is);
-      const std::bitset<8> raw_bits(raw_byte);
-
-      for (size_t bit_n = 0; bit_n < raw_bits.size(); ++bit_n)
-      {
-        if (raw_bits.test(bit_n) && (diagnostic::ErrorType::unused != diagnostic::ERROR_BITS[byte_n][bit_n]))
-        {
-          diagnostic_messages.push_back(diagnostic::Message(static_cast<configuration::ScannerId>(scanner_id),
-                                                            diagnostic::ErrorLocation(byte_n, bit_n)));
-        }
-      }
-    }
-  }
-  return diagnostic_messages;
+  return ErrorMask(raw_processing::read<ErrorMask::RawBytes>(is));
 }
 }  // namespace diagnostic
 
@@ -105,9 +105,14 @@ const std::vector<double>& Message::intensities() const
 
 std::vector<diagnostic::Message> Message::diagnosticMessages() const
 {
-  if (diagnostic_messages_.is_initialized())
+  return diagnosticErrors().messages();
+}
+
+const diagnostic::ErrorMask& Message::diagnosticErrors() const
+{
+  if (diagnostic_errors_.is_initialized())
   {
-    return diagnostic_messages_.get();
+    return diagnostic_errors_.get();
   }
   else
   {
@@ -142,7 +147,7 @@ bool Message::hasIntensitiesField() const
 
 bool Message::hasDiagnosticMessagesField() const
 {
-  return diagnostic_messages_.is_initialized();
+  return diagnostic_errors_.is_initialized();
 }
 }  // namespace monitoring_frame
 }  // namespace data_conversion_layer
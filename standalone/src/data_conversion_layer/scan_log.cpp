@@ -0,0 +1,663 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include <boost/interprocess/exceptions.hpp>
+
+#include <fmt/format.h>
+
+#include "psen_scan_v2_standalone/data_conversion_layer/scan_log.h"
+#include "psen_scan_v2_standalone/io_state.h"
+#include "psen_scan_v2_standalone/util/logging.h"
+
+namespace psen_scan_v2_standalone
+{
+namespace data_conversion_layer
+{
+namespace scan_log
+{
+static_assert(sizeof(BlockHeader) == 32, "BlockHeader must not contain padding");
+static_assert(sizeof(IndexEntry) == 40, "IndexEntry must not contain padding");
+static_assert(sizeof(IndexTrailer) == 24, "IndexTrailer must not contain padding");
+
+static constexpr uint8_t FLAG_GEOMETRY{ 0b001 };
+static constexpr uint8_t FLAG_ZONESET{ 0b010 };
+static constexpr uint8_t FLAG_INTENSITIES{ 0b100 };
+static constexpr double MILLIMETER_PER_METER{ 1000. };
+//! Number of differences sharing the same bit width.
+static constexpr std::size_t GROUP_SIZE{ 16 };
+//! Zigzag encoded differences of 16 bit values need at most 17 bits.
+static constexpr uint8_t MAX_DELTA_WIDTH{ 17 };
+
+static uint64_t toZigzag(const int64_t& value)
+{
+  return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+static int64_t fromZigzag(const uint64_t& value)
+{
+  return static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
+}
+
+//! @returns the difference of two numbers, wrapping around instead of overflowing.
+static int64_t difference(const int64_t& lhs, const int64_t& rhs)
+{
+  return static_cast<int64_t>(static_cast<uint64_t>(lhs) - static_cast<uint64_t>(rhs));
+}
+
+static int64_t sum(const int64_t& lhs, const int64_t& rhs)
+{
+  return static_cast<int64_t>(static_cast<uint64_t>(lhs) + static_cast<uint64_t>(rhs));
+}
+
+static void writeVarint(std::vector<char>& out, uint64_t value)
+{
+  while (value >= 0x80)
+  {
+    out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<char>(value));
+}
+
+static void writeSigned(std::vector<char>& out, const int64_t& value)
+{
+  writeVarint(out, toZigzag(value));
+}
+
+static uint8_t readByte(const char*& pos, const char* end)
+{
+  if (pos == end)
+  {
+    throw ReadError("Unexpected end of block");
+  }
+  return static_cast<uint8_t>(*pos++);
+}
+
+static uint64_t readVarint(const char*& pos, const char* end)
+{
+  uint64_t value{ 0 };
+  for (unsigned shift = 0; shift < 64; shift += 7)
+  {
+    const uint8_t byte{ readByte(pos, end) };
+    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0)
+    {
+      return value;
+    }
+  }
+  throw ReadError("Variable length integer exceeds 64 bit");
+}
+
+static int64_t readSigned(const char*& pos, const char* end)
+{
+  return fromZigzag(readVarint(pos, end));
+}
+
+//! @returns the number of values, which is limited by the remaining bytes of the block.
+static std::size_t readCount(const char*& pos, const char* end, const std::size_t& max_values_per_byte = 1)
+{
+  const uint64_t count{ readVarint(pos, end) };
+  if (count > static_cast<uint64_t>(end - pos) * max_values_per_byte)
+  {
+    throw ReadError(fmt::format("Number of values {} exceeds the size of the block", count));
+  }
+  return static_cast<std::size_t>(count);
+}
+
+static uint8_t bitWidth(uint32_t value)
+{
+  uint8_t width{ 0 };
+  for (; value != 0; value >>= 1)
+  {
+    ++width;
+  }
+  return width;
+}
+
+static uint16_t toMillimeter(const double& distance)
+{
+  if (std::isinf(distance) && distance > 0.)
+  {
+    return NO_SIGNAL;
+  }
+  const double millimeter{ std::round(distance * MILLIMETER_PER_METER) };
+  if (!(millimeter >= 0. && millimeter < NO_SIGNAL))
+  {
+    throw std::out_of_range(fmt::format("Distance {} m cannot be written to a scan log", distance));
+  }
+  return static_cast<uint16_t>(millimeter);
+}
+
+static double toMeter(const uint16_t& millimeter)
+{
+  if (millimeter == NO_SIGNAL)
+  {
+    return std::numeric_limits<double>::infinity();
+  }
+  return static_cast<double>(millimeter) / MILLIMETER_PER_METER;
+}
+
+static uint16_t toIntensity(const double& intensity)
+{
+  const double rounded{ std::round(intensity) };
+  if (!(rounded >= 0. && rounded <= std::numeric_limits<uint16_t>::max()))
+  {
+    throw std::out_of_range(fmt::format("Intensity {} cannot be written to a scan log", intensity));
+  }
+  return static_cast<uint16_t>(rounded);
+}
+
+template <typename T, typename Conversion>
+static void writeDeltas(std::vector<char>& out, const std::vector<T>& values, const Conversion& conversion)
+{
+  writeVarint(out, values.size());
+  std::array<uint32_t, GROUP_SIZE> group{};
+  int64_t previous{ 0 };
+  for (std::size_t start = 0; start < values.size(); start += GROUP_SIZE)
+  {
+    const std::size_t group_size{ std::min(GROUP_SIZE, values.size() - start) };
+    uint32_t all_bits{ 0 };
+    for (std::size_t i = 0; i < group_size; ++i)
+    {
+      const int64_t current{ conversion(values[start + i]) };
+      group[i] = static_cast<uint32_t>(toZigzag(current - previous));
+      all_bits |= group[i];
+      previous = current;
+    }
+
+    const uint8_t width{ bitWidth(all_bits) };
+    out.push_back(static_cast<char>(width));
+    uint64_t bits{ 0 };
+    unsigned num_bits{ 0 };
+    for (std::size_t i = 0; i < group_size; ++i)
+    {
+      bits |= static_cast<uint64_t>(group[i]) << num_bits;
+      for (num_bits += width; num_bits >= 8; num_bits -= 8)
+      {
+        out.push_back(static_cast<char>(bits & 0xFF));
+        bits >>= 8;
+      }
+    }
+    if (num_bits > 0)
+    {
+      out.push_back(static_cast<char>(bits));
+    }
+  }
+}
+
+template <typename Conversion>
+static void readDeltas(const char*& pos, const char* end, std::vector<double>& values, const Conversion& conversion)
+{
+  values.resize(readCount(pos, end, GROUP_SIZE));
+  int64_t previous{ 0 };
+  for (std::size_t start = 0; start < values.size(); start += GROUP_SIZE)
+  {
+    const std::size_t group_size{ std::min(GROUP_SIZE, values.size() - start) };
+    const uint8_t width{ readByte(pos, end) };
+    if (width > MAX_DELTA_WIDTH)
+    {
+      throw ReadError(fmt::format("Bit width {} exceeds {}", width, MAX_DELTA_WIDTH));
+    }
+
+    const uint64_t mask{ (uint64_t{ 1 } << width) - 1 };
+    uint64_t bits{ 0 };
+    unsigned num_bits{ 0 };
+    for (std::size_t i = 0; i < group_size; ++i)
+    {
+      for (; num_bits < width; num_bits += 8)
+      {
+        bits |= static_cast<uint64_t>(readByte(pos, end)) << num_bits;
+      }
+      const int64_t current{ previous + fromZigzag(bits & mask) };
+      bits >>= width;
+      num_bits -= width;
+      if (current < 0 || current > std::numeric_limits<uint16_t>::max())
+      {
+        throw ReadError(fmt::format("Value {} exceeds 16 bit", current));
+      }
+      values[start + i] = conversion(static_cast<uint16_t>(current));
+      previous = current;
+    }
+  }
+}
+
+static void writePinData(std::vector<char>& out, const monitoring_frame::io::PinData& pin_data)
+{
+  for (const auto& byte : pin_data.input_state)
+  {
+    out.push_back(static_cast<char>(byte.to_ulong()));
+  }
+  for (const auto& byte : pin_data.output_state)
+  {
+    out.push_back(static_cast<char>(byte.to_ulong()));
+  }
+}
+
+static monitoring_frame::io::PinData readPinData(const char*& pos, const char* end)
+{
+  monitoring_frame::io::PinData pin_data;
+  for (auto& byte : pin_data.input_state)
+  {
+    byte = readByte(pos, end);
+  }
+  for (auto& byte : pin_data.output_state)
+  {
+    byte = readByte(pos, end);
+  }
+  return pin_data;
+}
+
+Writer::Writer(const std::string& file_path, const std::size_t& scans_per_block)
+  : file_path_(file_path), scans_per_block_(scans_per_block)
+{
+  if (scans_per_block == 0)
+  {
+    throw std::invalid_argument("A block of a scan log has to contain at least one scan");
+  }
+  file_ = std::fopen(file_path.c_str(), "wb");
+  if (file_ == nullptr)
+  {
+    throw std::runtime_error(fmt::format("Cannot create scan log {}.", file_path));
+  }
+  writeToFile(MAGIC.data(), MAGIC.size());
+  writeToFile(&VERSION, sizeof(VERSION));
+}
+
+Writer::~Writer()
+{
+  try
+  {
+    close();
+  }
+  catch (const std::exception& e)
+  {
+    PSENSCAN_ERROR("ScanLog", "Failed to close {}: {}", file_path_, e.what());
+  }
+}
+
+void Writer::write(const LaserScan& scan)
+{
+  if (file_ == nullptr)
+  {
+    throw std::runtime_error(fmt::format("Scan log {} is already closed.", file_path_));
+  }
+
+  CodecState state{ state_ };
+  encode(scan, state, scan_buffer_);
+  state_ = state;
+
+  if (block_header_.num_scans == 0)
+  {
+    block_header_.first_timestamp = scan.timestamp();
+  }
+  block_header_.last_timestamp = scan.timestamp();
+  ++block_header_.num_scans;
+  block_.insert(block_.end(), scan_buffer_.begin(), scan_buffer_.end());
+
+  if (block_header_.num_scans == scans_per_block_)
+  {
+    flushBlock();
+  }
+}
+
+void Writer::close()
+{
+  if (file_ == nullptr)
+  {
+    return;
+  }
+  flushBlock();
+
+  IndexTrailer trailer;
+  trailer.index_offset = num_bytes_written_;
+  trailer.num_blocks = index_.size();
+  writeToFile(index_.data(), index_.size() * sizeof(IndexEntry));
+  writeToFile(&trailer, sizeof(trailer));
+
+  const int result{ std::fclose(file_) };
+  file_ = nullptr;
+  if (result != 0)
+  {
+    throw std::runtime_error(fmt::format("Cannot write scan log {}.", file_path_));
+  }
+}
+
+std::size_t Writer::numBytesWritten() const
+{
+  return num_bytes_written_;
+}
+
+void Writer::encode(const LaserScan& scan, CodecState& state, std::vector<char>& out) const
+{
+  out.clear();
+  out.push_back(0);
+  uint8_t flags{ 0 };
+
+  writeSigned(out, difference(scan.timestamp(), state.timestamp));
+  writeSigned(out, static_cast<int64_t>(scan.scanCounter()) - static_cast<int64_t>(state.scan_counter));
+  state.timestamp = scan.timestamp();
+  state.scan_counter = scan.scanCounter();
+
+  const std::array<int16_t, 3> geometry{
+    { scan.scanResolution().value(), scan.minScanAngle().value(), scan.maxScanAngle().value() }
+  };
+  if (!state.geometry || *state.geometry != geometry)
+  {
+    flags |= FLAG_GEOMETRY;
+    for (const auto& value : geometry)
+    {
+      writeSigned(out, value);
+    }
+    state.geometry = geometry;
+  }
+
+  if (!state.active_zoneset || *state.active_zoneset != scan.activeZoneset())
+  {
+    flags |= FLAG_ZONESET;
+    out.push_back(static_cast<char>(scan.activeZoneset()));
+    state.active_zoneset = scan.activeZoneset();
+  }
+
+  writeDeltas(out, scan.measurements(), toMillimeter);
+  if (!scan.intensities().empty())
+  {
+    flags |= FLAG_INTENSITIES;
+    writeDeltas(out, scan.intensities(), toIntensity);
+  }
+
+  writeVarint(out, scan.ioStates().size());
+  for (const auto& io_state : scan.ioStates())
+  {
+    writeSigned(out, difference(io_state.timestamp(), scan.timestamp()));
+    const bool changed{ !state.pin_data || !(*state.pin_data == io_state.pinData()) };
+    out.push_back(static_cast<char>(changed));
+    if (changed)
+    {
+      writePinData(out, io_state.pinData());
+      state.pin_data = io_state.pinData();
+    }
+  }
+
+  out.front() = static_cast<char>(flags);
+}
+
+void Writer::flushBlock()
+{
+  if (block_header_.num_scans == 0)
+  {
+    return;
+  }
+  block_header_.payload_size = block_.size();
+
+  IndexEntry entry;
+  entry.header = block_header_;
+  entry.offset = num_bytes_written_;
+  writeToFile(&block_header_, sizeof(block_header_));
+  writeToFile(block_.data(), block_.size());
+  index_.push_back(entry);
+
+  block_header_ = BlockHeader();
+  block_.clear();
+  state_ = CodecState();
+}
+
+void Writer::writeToFile(const void* data, const std::size_t& size)
+{
+  if (std::fwrite(data, 1, size, file_) != size)
+  {
+    throw std::runtime_error(fmt::format("Cannot write scan log {}.", file_path_));
+  }
+  num_bytes_written_ += size;
+}
+
+Reader::Reader(const std::string& file_path) : file_path_(file_path)
+{
+  try
+  {
+    file_ = boost::interprocess::file_mapping(file_path.c_str(), boost::interprocess::read_only);
+    region_ = boost::interprocess::mapped_region(file_, boost::interprocess::read_only);
+  }
+  catch (const boost::interprocess::interprocess_exception& e)
+  {
+    throw ReadError(fmt::format("Cannot map scan log {}: {}", file_path, e.what()));
+  }
+  data_ = static_cast<const char*>(region_.get_address());
+  size_ = region_.get_size();
+
+  uint32_t version{ 0 };
+  if (size_ < FILE_HEADER_SIZE || !std::equal(MAGIC.begin(), MAGIC.end(), data_))
+  {
+    throw ReadError(fmt::format("{} is no scan log.", file_path));
+  }
+  std::memcpy(&version, data_ + MAGIC.size(), sizeof(version));
+  if (version != VERSION)
+  {
+    throw ReadError(fmt::format("{} has the unsupported version {}.", file_path, version));
+  }
+
+  if (!readIndex())
+  {
+    PSENSCAN_WARN("ScanLog", "{} has no valid block index. Rebuilding it from the blocks.", file_path);
+    rebuildIndex();
+  }
+  enterBlock(0);
+}
+
+boost::optional<LaserScan> Reader::read()
+{
+  if (pending_)
+  {
+    boost::optional<LaserScan> scan{ std::move(pending_) };
+    pending_.reset();
+    return scan;
+  }
+
+  while (block_ < index_.size() && scan_in_block_ == index_[block_].header.num_scans)
+  {
+    enterBlock(block_ + 1);
+  }
+  if (block_ == index_.size())
+  {
+    return boost::none;
+  }
+  ++scan_in_block_;
+  return decode();
+}
+
+void Reader::seek(const int64_t& timestamp)
+{
+  pending_.reset();
+  const auto block{ std::lower_bound(
+      index_.begin(), index_.end(), timestamp, [](const IndexEntry& entry, const int64_t& value) {
+        return entry.header.last_timestamp < value;
+      }) };
+  enterBlock(static_cast<std::size_t>(block - index_.begin()));
+
+  while (auto scan = read())
+  {
+    if (scan->timestamp() >= timestamp)
+    {
+      pending_.emplace(std::move(*scan));
+      return;
+    }
+  }
+}
+
+void Reader::rewind()
+{
+  pending_.reset();
+  enterBlock(0);
+}
+
+std::size_t Reader::numScans() const
+{
+  std::size_t num_scans{ 0 };
+  for (const auto& entry : index_)
+  {
+    num_scans += entry.header.num_scans;
+  }
+  return num_scans;
+}
+
+std::size_t Reader::numBlocks() const
+{
+  return index_.size();
+}
+
+int64_t Reader::firstTimestamp() const
+{
+  return index_.empty() ? 0 : index_.front().header.first_timestamp;
+}
+
+int64_t Reader::lastTimestamp() const
+{
+  return index_.empty() ? 0 : index_.back().header.last_timestamp;
+}
+
+bool Reader::readIndex()
+{
+  IndexTrailer trailer;
+  if (size_ < FILE_HEADER_SIZE + sizeof(trailer))
+  {
+    return false;
+  }
+  std::memcpy(&trailer, data_ + size_ - sizeof(trailer), sizeof(trailer));
+  if (trailer.magic != INDEX_MAGIC || trailer.index_offset < FILE_HEADER_SIZE ||
+      trailer.num_blocks > (size_ - sizeof(trailer) - trailer.index_offset) / sizeof(IndexEntry) ||
+      trailer.index_offset + trailer.num_blocks * sizeof(IndexEntry) + sizeof(trailer) != size_)
+  {
+    return false;
+  }
+
+  index_.resize(trailer.num_blocks);
+  std::memcpy(index_.data(), data_ + trailer.index_offset, index_.size() * sizeof(IndexEntry));
+  const bool valid{ std::all_of(index_.begin(), index_.end(), [&trailer](const IndexEntry& entry) {
+    return entry.header.magic == BLOCK_MAGIC && entry.offset >= FILE_HEADER_SIZE &&
+           entry.offset + sizeof(BlockHeader) <= trailer.index_offset &&
+           entry.header.payload_size <= trailer.index_offset - entry.offset - sizeof(BlockHeader);
+  }) };
+  if (!valid)
+  {
+    index_.clear();
+  }
+  return valid;
+}
+
+void Reader::rebuildIndex()
+{
+  index_.clear();
+  std::size_t offset{ FILE_HEADER_SIZE };
+  while (size_ - offset >= sizeof(BlockHeader))
+  {
+    IndexEntry entry;
+    std::memcpy(&entry.header, data_ + offset, sizeof(BlockHeader));
+    if (entry.header.magic != BLOCK_MAGIC || entry.header.payload_size > size_ - offset - sizeof(BlockHeader))
+    {
+      break;
+    }
+    entry.offset = offset;
+    index_.push_back(entry);
+    offset += sizeof(BlockHeader) + entry.header.payload_size;
+  }
+  if (offset != size_)
+  {
+    PSENSCAN_WARN("ScanLog", "Ignoring the truncated last block of {}.", file_path_);
+  }
+}
+
+void Reader::enterBlock(const std::size_t& block)
+{
+  block_ = std::min(block, index_.size());
+  scan_in_block_ = 0;
+  state_ = CodecState();
+  if (block_ < index_.size())
+  {
+    pos_ = data_ + index_[block_].offset + sizeof(BlockHeader);
+    block_end_ = pos_ + index_[block_].header.payload_size;
+  }
+}
+
+LaserScan Reader::decode()
+{
+  try
+  {
+    const uint8_t flags{ readByte(pos_, block_end_) };
+    state_.timestamp = sum(state_.timestamp, readSigned(pos_, block_end_));
+    state_.scan_counter = static_cast<uint32_t>(state_.scan_counter + readSigned(pos_, block_end_));
+
+    if ((flags & FLAG_GEOMETRY) != 0)
+    {
+      std::array<int16_t, 3> geometry{};
+      for (auto& value : geometry)
+      {
+        value = static_cast<int16_t>(readSigned(pos_, block_end_));
+      }
+      state_.geometry = geometry;
+    }
+    if ((flags & FLAG_ZONESET) != 0)
+    {
+      state_.active_zoneset = readByte(pos_, block_end_);
+    }
+    if (!state_.geometry || !state_.active_zoneset)
+    {
+      throw ReadError("First scan of the block misses the scan range or the active zoneset");
+    }
+
+    LaserScan scan(util::TenthOfDegree((*state_.geometry)[0]),
+                   util::TenthOfDegree((*state_.geometry)[1]),
+                   util::TenthOfDegree((*state_.geometry)[2]),
+                   state_.scan_counter,
+                   *state_.active_zoneset,
+                   state_.timestamp);
+
+    readDeltas(pos_, block_end_, scan.measurements(), toMeter);
+    if ((flags & FLAG_INTENSITIES) != 0)
+    {
+      LaserScan::IntensityData intensities;
+      readDeltas(pos_, block_end_, intensities, [](const uint16_t& value) { return static_cast<double>(value); });
+      scan.intensities(intensities);
+    }
+
+    LaserScan::IOData io_states(readCount(pos_, block_end_));
+    for (auto& io_state : io_states)
+    {
+      const int64_t timestamp{ sum(state_.timestamp, readSigned(pos_, block_end_)) };
+      if (readByte(pos_, block_end_) != 0)
+      {
+        state_.pin_data = readPinData(pos_, block_end_);
+      }
+      if (!state_.pin_data)
+      {
+        throw ReadError("First I/O state of the block misses its pin data");
+      }
+      io_state = IOState(*state_.pin_data, timestamp);
+    }
+    scan.ioStates(io_states);
+    return scan;
+  }
+  catch (const std::exception& e)
+  {
+    throw ReadError(fmt::format("Block {} of {} is corrupted: {}", block_, file_path_, e.what()));
+  }
+}
+
+}  // namespace scan_log
+}  // namespace data_conversion_layer
+}  // namespace psen_scan_v2_standalone
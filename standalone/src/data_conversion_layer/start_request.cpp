@@ -28,9 +28,25 @@ Message::Message(const ScannerConfiguration& scanner_configuration)
   , host_udp_port_data_(scanner_configuration.hostUDPPortData())  // Write is deduced by the scanner
   , master_device_settings_(scanner_configuration.diagnosticsEnabled(), scanner_configuration.intensitiesEnabled())
   , master_(scanner_configuration.scanRange(), scanner_configuration.scanResolution())
+  , subscribers_({ subscriberSettings(scanner_configuration, configuration::ScannerId::subscriber0),
+                   subscriberSettings(scanner_configuration, configuration::ScannerId::subscriber1),
+                   subscriberSettings(scanner_configuration, configuration::ScannerId::subscriber2) })
 {
 }
 
+Message::LaserScanSettings Message::subscriberSettings(const ScannerConfiguration& scanner_configuration,
+                                                       const configuration::ScannerId& id)
+{
+  for (const auto& subscriber : scanner_configuration.subscribers())
+  {
+    if (subscriber.id == id)
+    {
+      return LaserScanSettings(subscriber.scan_range, subscriber.scan_resolution);
+    }
+  }
+  return LaserScanSettings();
+}
+
 }  // namespace start_request
 }  // namespace data_conversion_layer
 }  // namespace psen_scan_v2_standalone
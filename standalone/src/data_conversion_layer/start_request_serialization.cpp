@@ -77,17 +77,25 @@ RawData data_conversion_layer::start_request::serialize(const data_conversion_la
    * For example, (1000) only enables the Master device, while (1010) enables both the Master
    * and the second Subscriber device.
    */
+  static constexpr uint8_t MASTER_DEVICE_BIT{ 0b00001000 };
+  uint8_t device_enabled{ MASTER_DEVICE_BIT };
+  for (std::size_t i = 0; i < msg.subscribers_.size(); ++i)
+  {
+    if (msg.subscribers_[i].enabled())
+    {
+      device_enabled |= static_cast<uint8_t>(MASTER_DEVICE_BIT >> (i + 1));
+    }
+  }
 
-  const uint8_t device_enabled{ 0b00001000 };
   const uint8_t intensity_enabled{ static_cast<uint8_t>(
-      msg.master_device_settings_.intensitiesEnabled() ? 0b00001000 : 0b00000000) };
+      msg.master_device_settings_.intensitiesEnabled() ? device_enabled : 0b00000000) };
   const uint8_t point_in_safety_enabled{ 0 };
-  const uint8_t active_zone_set_enabled{ 0b00001000 };
-  const uint8_t io_pin_data_enabled{ 0b00001000 };
-  const uint8_t scan_counter_enabled{ 0b00001000 };
+  const uint8_t active_zone_set_enabled{ device_enabled };
+  const uint8_t io_pin_data_enabled{ MASTER_DEVICE_BIT }; /**< The I/O pins only exist on the Master device.*/
+  const uint8_t scan_counter_enabled{ device_enabled };
   const uint8_t speed_encoder_enabled{ 0 }; /**< 0000000bin disabled, 00001111bin enabled.*/
   const uint8_t diagnostics_enabled{ static_cast<uint8_t>(
-      msg.master_device_settings_.diagnosticsEnabled() ? 0b00001000 : 0b00000000) };
+      msg.master_device_settings_.diagnosticsEnabled() ? device_enabled : 0b00000000) };
 
   raw_processing::write(os, device_enabled);
   raw_processing::write(os, intensity_enabled);
@@ -98,32 +106,38 @@ RawData data_conversion_layer::start_request::serialize(const data_conversion_la
   raw_processing::write(os, speed_encoder_enabled);
   raw_processing::write(os, diagnostics_enabled);
 
-  const auto start = msg.master_.scanRange().start().value();
-  auto end = msg.master_.scanRange().end().value();
-  const auto resolution = msg.master_.resolution().value();
-
-  /* In order to get all the data points we want, the scanner needs a value
-     that is strictly greater than the end point */
-  if ((end - start) % resolution == 0)
-  {
-    end++;
-  }
-  raw_processing::write(os, start);
-  raw_processing::write(os, end);
-  raw_processing::write(os, resolution);
-
-  PSENSCAN_DEBUG("StartRequestSerialization",
-                 "Serializing start request with angle_start={} angle_end={} resolution={} tenths of degree.",
-                 start,
-                 end,
-                 resolution);
-
-  for (const auto& subscriber :
-       msg.subscribers_)  // Note: This refers to the scanner type subscriber, *not* a ros subscriber
+  const auto write_laser_scan_settings = [&os](const auto& settings, const std::string& device) {
+    const auto start = settings.scanRange().start().value();
+    auto end = settings.scanRange().end().value();
+    const auto resolution = settings.resolution().value();
+
+    /* In order to get all the data points we want, the scanner needs a value
+       that is strictly greater than the end point */
+    if (settings.enabled() && (end - start) % resolution == 0)
+    {
+      end++;
+    }
+    raw_processing::write(os, start);
+    raw_processing::write(os, end);
+    raw_processing::write(os, resolution);
+
+    if (settings.enabled())
+    {
+      PSENSCAN_DEBUG("StartRequestSerialization",
+                     "Serializing start request of {} with angle_start={} angle_end={} resolution={} tenths of degree.",
+                     device,
+                     start,
+                     end,
+                     resolution);
+    }
+  };
+
+  write_laser_scan_settings(msg.master_, configuration::SCANNER_ID_TO_STRING.at(configuration::ScannerId::master));
+  for (std::size_t i = 0; i < msg.subscribers_.size(); ++i)
   {
-    raw_processing::write(os, subscriber.scanRange().start().value());
-    raw_processing::write(os, subscriber.scanRange().end().value());
-    raw_processing::write(os, subscriber.resolution().value());
+    // Note: This refers to the scanner type subscriber, *not* a ros subscriber
+    write_laser_scan_settings(msg.subscribers_[i],
+                              configuration::SCANNER_ID_TO_STRING.at(static_cast<configuration::ScannerId>(i + 1)));
   }
 
   const std::string raw_data_as_str{ os.str() };
@@ -92,6 +92,11 @@ int64_t IOState::timestamp() const
   return timestamp_;
 }
 
+const data_conversion_layer::monitoring_frame::io::PinData& IOState::pinData() const
+{
+  return pin_data_;
+}
+
 std::vector<PinState> IOState::changedInputStates(const IOState& ref_state) const
 {
   return data_conversion_layer::generateChangedInputStates(pin_data_, ref_state.pin_data_);
@@ -102,6 +107,16 @@ std::vector<PinState> IOState::changedOutputStates(const IOState& ref_state) con
   return data_conversion_layer::generateChangedOutputStates(pin_data_, ref_state.pin_data_);
 }
 
+ChangedPinStates IOState::changedInputPins(const IOState& ref_state) const
+{
+  return data_conversion_layer::generateChangedInputPins(pin_data_, ref_state.pin_data_);
+}
+
+ChangedPinStates IOState::changedOutputPins(const IOState& ref_state) const
+{
+  return data_conversion_layer::generateChangedOutputPins(pin_data_, ref_state.pin_data_);
+}
+
 std::ostream& operator<<(std::ostream& os, const IOState& io_state)
 {
   return os << "IOState(timestamp = " << io_state.timestamp_ << " nsec, " << io_state.pin_data_ << ")";
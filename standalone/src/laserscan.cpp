@@ -34,13 +34,15 @@ LaserScan::LaserScan(const util::TenthOfDegree& resolution,
                      const util::TenthOfDegree& max_scan_angle,
                      const uint32_t scan_counter,
                      const uint8_t active_zoneset,
-                     const int64_t timestamp)
+                     const int64_t timestamp,
+                     const configuration::ScannerId scanner_id)
   : resolution_(resolution)
   , min_scan_angle_(min_scan_angle)
   , max_scan_angle_(max_scan_angle)
   , scan_counter_(scan_counter)
   , active_zoneset_(active_zoneset)
   , timestamp_(timestamp)
+  , scanner_id_(scanner_id)
 {
   if (scanResolution() == util::TenthOfDegree(0))
   {
@@ -150,6 +152,11 @@ int64_t LaserScan::timestamp() const
   return timestamp_;
 }
 
+configuration::ScannerId LaserScan::scannerId() const
+{
+  return scanner_id_;
+}
+
 void LaserScan::measurements(const MeasurementData& measurements)
 {
   measurements_ = measurements;
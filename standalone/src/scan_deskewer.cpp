@@ -0,0 +1,225 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "psen_scan_v2_standalone/configuration/default_parameters.h"
+#include "psen_scan_v2_standalone/scan_deskewer.h"
+
+namespace psen_scan_v2_standalone
+{
+static constexpr double PI{ 3.14159265358979323846 };
+
+//! @returns the angle normalized to [-pi, pi).
+static double normalizeAngle(const double& angle)
+{
+  return angle - 2. * PI * std::floor((angle + PI) / (2. * PI));
+}
+
+static Pose2D interpolatePose(const Pose2D& p0, const Pose2D& p1, const double& fraction)
+{
+  return Pose2D{ p0.x + fraction * (p1.x - p0.x),
+                 p0.y + fraction * (p1.y - p0.y),
+                 normalizeAngle(p0.theta + fraction * normalizeAngle(p1.theta - p0.theta)) };
+}
+
+PoseBuffer::PoseBuffer(const std::size_t& capacity, const int64_t& max_extrapolation_ns)
+  : capacity_(capacity), max_extrapolation_ns_(max_extrapolation_ns)
+{
+  if (capacity_ < 2)
+  {
+    throw std::invalid_argument("A pose buffer needs a capacity of at least 2 poses");
+  }
+}
+
+void PoseBuffer::add(const int64_t& timestamp, const Pose2D& pose)
+{
+  if (!poses_.empty() && timestamp <= poses_.back().first)
+  {
+    throw std::invalid_argument(
+        fmt::format("Pose at {} is not newer than the last pose at {}.", timestamp, poses_.back().first));
+  }
+  if (poses_.size() == capacity_)
+  {
+    poses_.pop_front();
+  }
+  poses_.emplace_back(timestamp, pose);
+}
+
+Pose2D PoseBuffer::interpolate(const int64_t& timestamp) const
+{
+  if (poses_.size() < 2 || timestamp < poses_.front().first ||
+      timestamp > poses_.back().first + max_extrapolation_ns_)
+  {
+    throw std::out_of_range(fmt::format("No pose available at {}.", timestamp));
+  }
+
+  auto next{ std::upper_bound(poses_.begin(), poses_.end(), timestamp, [](const int64_t& t, const auto& pose) {
+    return t < pose.first;
+  }) };
+  if (next == poses_.end())  // Extrapolate the motion between the two newest poses.
+  {
+    --next;
+  }
+  const auto& p0{ *std::prev(next) };
+  const auto& p1{ *next };
+  const double fraction{ static_cast<double>(timestamp - p0.first) / static_cast<double>(p1.first - p0.first) };
+  return interpolatePose(p0.second, p1.second, fraction);
+}
+
+std::size_t PoseBuffer::size() const
+{
+  return poses_.size();
+}
+
+ScanDeskewer::ScanDeskewer(const double& x_axis_rotation)
+  : x_axis_rotation_(x_axis_rotation), relative_poses_(DESKEW_NUM_POSE_SAMPLES)
+{
+}
+
+DeskewedScan ScanDeskewer::deskew(const LaserScan& scan, const PoseAtTime& pose_at_time)
+{
+  DeskewedScan result;
+  deskew(scan, pose_at_time, result);
+  return result;
+}
+
+DeskewedScan ScanDeskewer::deskew(const LaserScan& scan, const PoseBuffer& poses)
+{
+  return deskew(scan, [&poses](const int64_t& timestamp) { return poses.interpolate(timestamp); });
+}
+
+void ScanDeskewer::deskew(const LaserScan& scan, const PoseAtTime& pose_at_time, DeskewedScan& result)
+{
+  const auto& ranges{ scan.measurements() };
+  const std::size_t num_rays{ ranges.size() };
+  result.timestamp = scan.timestamp();
+  result.x.resize(num_rays);
+  result.y.resize(num_rays);
+  if (num_rays == 0)
+  {
+    return;
+  }
+
+  const RayTable& rays{ rayTable(scan) };
+  const double scan_duration{ rays.time_offsets_.back() };
+  constexpr std::size_t num_segments{ DESKEW_NUM_POSE_SAMPLES - 1 };
+
+  // Poses at the samples relative to the pose at the first ray.
+  const Pose2D reference{ pose_at_time(scan.timestamp()) };
+  const double reference_cos{ std::cos(reference.theta) };
+  const double reference_sin{ std::sin(reference.theta) };
+  std::array<double, DESKEW_NUM_POSE_SAMPLES> sample_times{};
+  for (std::size_t k = 0; k < DESKEW_NUM_POSE_SAMPLES; ++k)
+  {
+    sample_times[k] = scan_duration * static_cast<double>(k) / num_segments;
+    const Pose2D pose{ k == 0 ? reference :
+                                pose_at_time(scan.timestamp() + static_cast<int64_t>(std::llround(sample_times[k]))) };
+    const double dx{ pose.x - reference.x };
+    const double dy{ pose.y - reference.y };
+    relative_poses_[k] = Pose2D{ reference_cos * dx + reference_sin * dy,
+                                 -reference_sin * dx + reference_cos * dy,
+                                 normalizeAngle(pose.theta - reference.theta) };
+  }
+
+  const double* const time_offsets{ rays.time_offsets_.data() };
+  const double* const ray_cos{ rays.cos_.data() };
+  const double* const ray_sin{ rays.sin_.data() };
+  const double* const range{ ranges.data() };
+  double* const x{ result.x.data() };
+  double* const y{ result.y.data() };
+
+  for (std::size_t k = 0; k < num_segments; ++k)
+  {
+    // The rays are evenly spread over time, so the rays of a segment follow from their indices.
+    const std::size_t begin{ (k * (num_rays - 1) + num_segments - 1) / num_segments };
+    const std::size_t end{ k + 1 == num_segments ? num_rays :
+                                                   ((k + 1) * (num_rays - 1) + num_segments - 1) / num_segments };
+
+    const Pose2D& p0{ relative_poses_[k] };
+    const Pose2D& p1{ relative_poses_[k + 1] };
+    const double segment_duration{ sample_times[k + 1] - sample_times[k] };
+    const double inverse_duration{ segment_duration > 0. ? 1. / segment_duration : 0. };
+    const double start_time{ sample_times[k] };
+    const double dx{ p1.x - p0.x };
+    const double dy{ p1.y - p0.y };
+    const double dtheta{ normalizeAngle(p1.theta - p0.theta) };
+    const double cos0{ std::cos(p0.theta) };
+    const double sin0{ std::sin(p0.theta) };
+
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      const double fraction{ (time_offsets[i] - start_time) * inverse_duration };
+      // The rotation within a segment is small, so its sine and cosine are approximated by their Taylor series.
+      const double d{ fraction * dtheta };
+      const double d2{ d * d };
+      const double cos_d{ 1. - d2 * (1. / 2. - d2 / 24.) };
+      const double sin_d{ d * (1. - d2 * (1. / 6. - d2 / 120.)) };
+      const double cos_theta{ cos0 * cos_d - sin0 * sin_d };
+      const double sin_theta{ sin0 * cos_d + cos0 * sin_d };
+      x[i] = p0.x + fraction * dx + range[i] * (cos_theta * ray_cos[i] - sin_theta * ray_sin[i]);
+      y[i] = p0.y + fraction * dy + range[i] * (sin_theta * ray_cos[i] + cos_theta * ray_sin[i]);
+    }
+  }
+}
+
+int64_t ScanDeskewer::rayTimestamp(const LaserScan& scan, const std::size_t& index)
+{
+  return scan.timestamp() +
+         static_cast<int64_t>(std::llround(static_cast<double>(index) * timeIncrement(scan.scanResolution())));
+}
+
+double ScanDeskewer::timeIncrement(const util::TenthOfDegree& resolution)
+{
+  return configuration::TIME_PER_SCAN_IN_S * 1000000000. * resolution.value() / 3600.;
+}
+
+std::size_t ScanDeskewer::cacheSize() const
+{
+  return cache_.size();
+}
+
+const ScanDeskewer::RayTable& ScanDeskewer::rayTable(const LaserScan& scan)
+{
+  const std::size_t num_rays{ scan.measurements().size() };
+  const CacheKey key{ scan.minScanAngle().value(), scan.scanResolution().value(), num_rays };
+  const auto cached{ cache_.find(key) };
+  if (cached != cache_.end())
+  {
+    return cached->second;
+  }
+
+  RayTable rays;
+  rays.time_offsets_.resize(num_rays);
+  rays.cos_.resize(num_rays);
+  rays.sin_.resize(num_rays);
+  const double time_increment{ timeIncrement(scan.scanResolution()) };
+  for (std::size_t i = 0; i < num_rays; ++i)
+  {
+    const double angle{ (scan.minScanAngle() + scan.scanResolution() * static_cast<int>(i)).toRad() -
+                        x_axis_rotation_ };
+    rays.time_offsets_[i] = static_cast<double>(i) * time_increment;
+    rays.cos_[i] = std::cos(angle);
+    rays.sin_[i] = std::sin(angle);
+  }
+  return cache_.emplace(key, std::move(rays)).first->second;
+}
+
+}  // namespace psen_scan_v2_standalone
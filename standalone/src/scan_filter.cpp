@@ -0,0 +1,268 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "psen_scan_v2_standalone/scan_filter.h"
+
+namespace psen_scan_v2_standalone
+{
+static constexpr double PI{ 3.14159265358979323846 };
+static constexpr double NO_SIGNAL{ std::numeric_limits<double>::infinity() };
+
+RangeFilter::RangeFilter(const double& min_range, const double& max_range)
+  : min_range_(min_range), max_range_(max_range)
+{
+  if (min_range_ < 0. || min_range_ > max_range_)
+  {
+    throw std::invalid_argument(fmt::format("Invalid range [{}, {}] of the range filter.", min_range_, max_range_));
+  }
+}
+
+std::string RangeFilter::name() const
+{
+  return "range";
+}
+
+void RangeFilter::apply(LaserScan& scan)
+{
+  auto& measurements{ scan.measurements() };
+  double* const range{ measurements.data() };
+  const std::size_t num_rays{ measurements.size() };
+  for (std::size_t i = 0; i < num_rays; ++i)
+  {
+    range[i] = (range[i] < min_range_ || range[i] > max_range_) ? NO_SIGNAL : range[i];
+  }
+}
+
+std::unique_ptr<ScanFilter> RangeFilter::clone() const
+{
+  return std::unique_ptr<ScanFilter>(new RangeFilter(*this));
+}
+
+IntensityFilter::IntensityFilter(const double& min_intensity) : min_intensity_(min_intensity)
+{
+  if (min_intensity_ < 0.)
+  {
+    throw std::invalid_argument(fmt::format("Invalid minimal intensity {} of the intensity filter.", min_intensity_));
+  }
+}
+
+std::string IntensityFilter::name() const
+{
+  return "intensity";
+}
+
+void IntensityFilter::apply(LaserScan& scan)
+{
+  auto& measurements{ scan.measurements() };
+  double* const range{ measurements.data() };
+  const double* const intensity{ scan.intensities().data() };
+  const std::size_t num_rays{ std::min(measurements.size(), scan.intensities().size()) };
+  for (std::size_t i = 0; i < num_rays; ++i)
+  {
+    range[i] = intensity[i] < min_intensity_ ? NO_SIGNAL : range[i];
+  }
+}
+
+std::unique_ptr<ScanFilter> IntensityFilter::clone() const
+{
+  return std::unique_ptr<ScanFilter>(new IntensityFilter(*this));
+}
+
+bool IntensityFilter::requiresIntensities() const
+{
+  return true;
+}
+
+ShadowFilter::ShadowFilter(const double& min_angle, const double& max_angle, const std::size_t& window)
+  : min_angle_(min_angle), max_angle_(max_angle), window_(window)
+{
+  if (min_angle_ <= 0. || min_angle_ >= max_angle_ || max_angle_ >= PI)
+  {
+    throw std::invalid_argument(fmt::format(
+        "Invalid angles [{}, {}] of the shadow filter. Requires 0 < min < max < pi.", min_angle_, max_angle_));
+  }
+  if (window_ == 0)
+  {
+    throw std::invalid_argument("The window of the shadow filter must not be zero.");
+  }
+}
+
+std::string ShadowFilter::name() const
+{
+  return "shadow";
+}
+
+void ShadowFilter::apply(LaserScan& scan)
+{
+  auto& measurements{ scan.measurements() };
+  const std::size_t num_rays{ measurements.size() };
+  removed_.assign(num_rays, 0);
+
+  double* const range{ measurements.data() };
+  uint8_t* const removed{ removed_.data() };
+  const double sin_min{ std::sin(min_angle_) };
+  const double cos_min{ std::cos(min_angle_) };
+  const double sin_max{ std::sin(max_angle_) };
+  const double cos_max{ std::cos(max_angle_) };
+
+  for (std::size_t k = 1; k <= window_ && k < num_rays; ++k)
+  {
+    const double ray_angle{ scan.scanResolution().toRad() * static_cast<double>(k) };
+    const double ray_sin{ std::sin(ray_angle) };
+    const double ray_cos{ std::cos(ray_angle) };
+    // The angle at point p of the triangle (scanner, p, q) is atan2(y, x) with x = r_p - r_q * cos, y = r_q * sin.
+    // Comparing it with the limits via the cross product avoids the atan2. Not finite neighbours never remove a point.
+    const auto is_veiling = [&](const double& r_p, const double& r_q) {
+      const double x{ r_p - r_q * ray_cos };
+      const double y{ r_q * ray_sin };
+      return (r_q < NO_SIGNAL) & ((x * sin_min > y * cos_min) | (x * sin_max < y * cos_max));
+    };
+    for (std::size_t i = 0; i + k < num_rays; ++i)
+    {
+      const std::size_t j{ i + k };
+      removed[i] |= static_cast<uint8_t>(is_veiling(range[i], range[j]));
+      removed[j] |= static_cast<uint8_t>(is_veiling(range[j], range[i]));
+    }
+  }
+
+  for (std::size_t i = 0; i < num_rays; ++i)
+  {
+    range[i] = removed[i] ? NO_SIGNAL : range[i];
+  }
+}
+
+std::unique_ptr<ScanFilter> ShadowFilter::clone() const
+{
+  return std::unique_ptr<ScanFilter>(new ShadowFilter(min_angle_, max_angle_, window_));
+}
+
+MedianFilter::MedianFilter(const std::size_t& window) : window_(window)
+{
+  if (window_ < 3 || window_ % 2 == 0)
+  {
+    throw std::invalid_argument(
+        fmt::format("Invalid window {} of the median filter. Requires an odd number greater than 1.", window_));
+  }
+  window_values_.reserve(window_);
+}
+
+std::string MedianFilter::name() const
+{
+  return "median";
+}
+
+void MedianFilter::apply(LaserScan& scan)
+{
+  auto& measurements{ scan.measurements() };
+  measurements_.assign(measurements.begin(), measurements.end());
+
+  const std::size_t num_rays{ measurements_.size() };
+  const std::size_t half_window{ window_ / 2 };
+  for (std::size_t i = 0; i < num_rays; ++i)
+  {
+    const std::size_t half{ std::min({ half_window, i, num_rays - 1 - i }) };
+    const auto begin{ measurements_.begin() + static_cast<std::ptrdiff_t>(i - half) };
+    window_values_.assign(begin, begin + static_cast<std::ptrdiff_t>(2 * half + 1));
+    const auto median{ window_values_.begin() + static_cast<std::ptrdiff_t>(window_values_.size() / 2) };
+    std::nth_element(window_values_.begin(), median, window_values_.end());
+    measurements[i] = *median;
+  }
+}
+
+std::unique_ptr<ScanFilter> MedianFilter::clone() const
+{
+  return std::unique_ptr<ScanFilter>(new MedianFilter(window_));
+}
+
+ScanFilterChain::ScanFilterChain(const std::vector<std::shared_ptr<const ScanFilter>>& filters)
+{
+  for (const auto& filter : filters)
+  {
+    filters_.emplace_back(filter->clone());
+    histograms_.emplace_back(new util::LatencyHistogram());
+  }
+}
+
+void ScanFilterChain::apply(LaserScan& scan)
+{
+  for (std::size_t i = 0; i < filters_.size(); ++i)
+  {
+    const auto start{ std::chrono::steady_clock::now() };
+    filters_[i]->apply(scan);
+    histograms_[i]->record(std::chrono::steady_clock::now() - start);
+  }
+}
+
+std::size_t ScanFilterChain::size() const
+{
+  return filters_.size();
+}
+
+bool ScanFilterChain::empty() const
+{
+  return filters_.empty();
+}
+
+std::string ScanFilterChain::name(const std::size_t& index) const
+{
+  return filters_.at(index)->name();
+}
+
+const util::LatencyHistogram& ScanFilterChain::histogram(const std::size_t& index) const
+{
+  return *histograms_.at(index);
+}
+
+std::string ScanFilterChain::formatSummary() const
+{
+  std::string summary_table{ fmt::format("{:<16}{:>10}{:>10}{:>10}{:>10}{:>10}{:>10}{:>10}{:>10}\n",
+                                         "filter [us]",
+                                         "count",
+                                         "min",
+                                         "mean",
+                                         "p50",
+                                         "p90",
+                                         "p99",
+                                         "p99.9",
+                                         "max") };
+  const auto in_us = [](const util::LatencyHistogram::Duration& duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+  };
+  for (std::size_t i = 0; i < filters_.size(); ++i)
+  {
+    const util::LatencyHistogram::Summary s{ histograms_[i]->summary() };
+    summary_table += fmt::format("{:<16}{:>10}{:>10.1f}{:>10.1f}{:>10.1f}{:>10.1f}{:>10.1f}{:>10.1f}{:>10.1f}\n",
+                                 fmt::format("{} {}", i, filters_[i]->name()),
+                                 s.count,
+                                 in_us(s.min),
+                                 in_us(s.mean),
+                                 in_us(s.p50),
+                                 in_us(s.p90),
+                                 in_us(s.p99),
+                                 in_us(s.p999),
+                                 in_us(s.max));
+  }
+  return summary_table;
+}
+
+}  // namespace psen_scan_v2_standalone
@@ -0,0 +1,182 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "psen_scan_v2_standalone/scanner_replay.h"
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include <boost/asio.hpp>
+
+#include "psen_scan_v2_standalone/data_conversion_layer/frame_recording.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/raw_scanner_data.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/scanner_reply_msg.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/scanner_reply_serialization_deserialization.h"
+#include "psen_scan_v2_standalone/protocol_layer/scanner_events.h"
+#include "psen_scan_v2_standalone/protocol_layer/scanner_state_machine.h"
+#include "psen_scan_v2_standalone/scanner_config_builder.h"
+#include "psen_scan_v2_standalone/util/logging.h"
+
+namespace psen_scan_v2_standalone
+{
+using namespace psen_scan_v2_standalone::protocol_layer;
+using namespace psen_scan_v2_standalone::data_conversion_layer;
+
+static const std::string LOOPBACK_IP{ "127.0.0.1" };
+
+static ScannerConfiguration createReplayConfiguration(const ScannerConfiguration& config)
+{
+  return ScannerConfigurationBuilder(config)
+      .scannerIp(LOOPBACK_IP)
+      .hostIP(LOOPBACK_IP)
+      .hostDataPort(0)
+      .hostControlPort(0)
+      .build();
+}
+
+static ScannerConfiguration createReplayConfiguration(const ScannerConfiguration& config, const uint16_t& scanner_port)
+{
+  return ScannerConfigurationBuilder(config).scannerDataPort(scanner_port).scannerControlPort(scanner_port).build();
+}
+
+static scanner_events::RawReplyReceived createAcceptedReply(const scanner_reply::Message::Type& type,
+                                                            const int64_t& timestamp)
+{
+  const RawDataConstPtr data{ std::make_shared<RawData>(
+      scanner_reply::serialize(scanner_reply::Message(type, scanner_reply::Message::OperationResult::accepted))) };
+  return scanner_events::RawReplyReceived(data, data->size(), timestamp);
+}
+
+ScannerReplay::ScannerReplay(const ScannerConfiguration& scanner_config,
+                             const IScanner::LaserScanCallback& laser_scan_callback,
+                             const IOEdgeCallback& io_edge_callback,
+                             const IOEdgeFilter& io_edge_filter)
+  : config_(createReplayConfiguration(scanner_config))
+  , laser_scan_callback_(laser_scan_callback)
+  , io_edge_callback_(io_edge_callback)
+  , io_edge_filter_(io_edge_filter)
+{
+  if (!laser_scan_callback)
+  {
+    throw std::invalid_argument("Laserscan-callback must not be null");
+  }
+}
+
+ReplayStatistics ScannerReplay::replay(const std::vector<std::string>& file_paths, const double& speed)
+{
+  if (!(speed > 0.))
+  {
+    throw std::invalid_argument("The replay speed has to be positive.");
+  }
+
+  // Opening all files first reports invalid files before anything is replayed.
+  std::vector<std::unique_ptr<frame_recording::Reader>> readers;
+  for (const auto& file_path : file_paths)
+  {
+    readers.emplace_back(new frame_recording::Reader(file_path));
+  }
+
+  // The start and stop requests of the state machine are sent to this socket, which is never read, instead of a port
+  // a local scanner (mock) could listen on.
+  boost::asio::io_service io_service;
+  boost::asio::ip::udp::socket request_sink(
+      io_service, boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::from_string(LOOPBACK_IP), 0));
+
+  ReplayStatistics statistics;
+  const auto ignore = []() {};
+  const auto ignore_error = [](const std::string&) {};
+  const auto ignore_data = [](const RawDataConstPtr&, const std::size_t&, const int64_t&) {};
+  // clang-format off
+  ScannerStateMachine sm(createReplayConfiguration(config_, request_sink.local_endpoint().port()),
+                         ignore_data,
+                         ignore_error,
+                         [](const std::string& error_msg) { PSENSCAN_ERROR("ScannerReplay", error_msg); },
+                         [](const std::string& error_msg) { PSENSCAN_ERROR("ScannerReplay", error_msg); },
+                         ignore_data,
+                         ignore_error,
+                         ignore,
+                         ignore,
+                         [this, &statistics](const LaserScan& scan) {
+                           ++statistics.num_laser_scans;
+                           laser_scan_callback_(scan);
+                         },
+                         ignore,
+                         ignore,
+                         ignore,
+                         io_edge_callback_,
+                         io_edge_filter_);
+  // clang-format on
+
+  const auto replay_start{ std::chrono::steady_clock::now() };
+  bool started{ false };
+  int64_t first_frame_time{ 0 };
+  int64_t last_frame_time{ 0 };
+  int64_t watchdog_start{ 0 };
+  const auto watchdog_timeout{ std::chrono::duration_cast<std::chrono::nanoseconds>(WATCHDOG_TIMEOUT).count() };
+
+  sm.start();
+  frame_recording::Record record;
+  RawDataPtr data{ std::make_shared<RawData>() };
+  for (const auto& reader : readers)
+  {
+    while (reader->read(record))
+    {
+      if (!started)
+      {
+        sm.process_event(scanner_events::StartRequest());
+        sm.process_event(createAcceptedReply(scanner_reply::Message::Type::start, record.timestamp));
+        first_frame_time = record.timestamp;
+        watchdog_start = record.timestamp;
+        started = true;
+      }
+
+      if (!std::isinf(speed))
+      {
+        const std::chrono::duration<double, std::nano> recorded_offset{ record.timestamp - first_frame_time };
+        std::this_thread::sleep_until(
+            replay_start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(recorded_offset / speed));
+      }
+
+      while (record.timestamp - watchdog_start >= watchdog_timeout)
+      {
+        sm.process_event(scanner_events::MonitoringFrameTimeout());
+        ++statistics.num_monitoring_frame_timeouts;
+        watchdog_start += watchdog_timeout;
+      }
+      watchdog_start = record.timestamp;
+      last_frame_time = record.timestamp;
+
+      // Swapping the buffers avoids an allocation per frame.
+      data->swap(record.data);
+      sm.process_event(scanner_events::RawMonitoringFrameReceived(data, data->size(), record.timestamp));
+      ++statistics.num_frames;
+    }
+  }
+
+  if (started)
+  {
+    sm.process_event(scanner_events::StopRequest());
+    sm.process_event(createAcceptedReply(scanner_reply::Message::Type::stop, last_frame_time));
+  }
+  sm.stop();
+
+  statistics.recorded_duration = std::chrono::nanoseconds(last_frame_time - first_frame_time);
+  statistics.replay_duration = std::chrono::steady_clock::now() - replay_start;
+  return statistics;
+}
+
+}  // namespace psen_scan_v2_standalone
@@ -32,14 +32,35 @@ using namespace psen_scan_v2_standalone::protocol_layer::scanner_events;
   [this](const data_conversion_layer::RawDataConstPtr& data, const std::size_t& num_bytes, const int64_t& timestamp){ triggerEventWithParam(event_name(data, num_bytes, timestamp)); }
 // clang-format on
 
-std::unique_ptr<util::Watchdog> WatchdogFactory::create(const util::Watchdog::Timeout& timeout,
-                                                        const std::function<void()>& timeout_callback)
+ScannerV2::ScannerV2(const ScannerConfiguration& scanner_config, const LaserScanCallback& laser_scan_callback)
+  : ScannerV2(scanner_config, laser_scan_callback, IOEdgeCallback())
 {
-  return std::unique_ptr<util::Watchdog>(new util::Watchdog(timeout, timeout_callback));
 }
 
-ScannerV2::ScannerV2(const ScannerConfiguration& scanner_config, const LaserScanCallback& laser_scan_callback)
+ScannerV2::ScannerV2(const ScannerConfiguration& scanner_config)
+  : ScannerV2(scanner_config, LaserScanCallback([](const LaserScan& /*unused*/) {}))
+{
+  latest_scan_enabled_ = true;
+}
+
+ScannerV2::ScannerV2(const ScannerConfiguration& scanner_config,
+                     const LaserScanCallback& laser_scan_callback,
+                     const IOEdgeCallback& io_edge_callback,
+                     const IOEdgeFilter& io_edge_filter)
+  : ScannerV2(scanner_config, laser_scan_callback, SubscriberLaserScanCallbacks(), io_edge_callback, io_edge_filter)
+{
+}
+
+ScannerV2::ScannerV2(const ScannerConfiguration& scanner_config,
+                     const LaserScanCallback& laser_scan_callback,
+                     const SubscriberLaserScanCallbacks& subscriber_laser_scan_callbacks,
+                     const IOEdgeCallback& io_edge_callback,
+                     const IOEdgeFilter& io_edge_filter)
   : IScanner(scanner_config, laser_scan_callback)
+  , frame_recorder_(createFrameRecorder(scanner_config))
+  , scan_ring_publisher_(createScanRingPublisher(scanner_config))
+  , subscriber_laser_scan_callbacks_(
+        checkSubscriberLaserScanCallbacks(scanner_config, subscriber_laser_scan_callbacks))
   , sm_(new ScannerStateMachine(IScanner::config(),
                                 // LCOV_EXCL_START
                                 // The following includes calls to std::bind which are not marked correctly
@@ -48,13 +69,24 @@ ScannerV2::ScannerV2(const ScannerConfiguration& scanner_config, const LaserScan
                                 BIND_EVENT(ReplyReceiveError),
                                 std::bind(&ScannerV2::scannerStartErrorCallback, this, std::placeholders::_1),
                                 std::bind(&ScannerV2::scannerStopErrorCallback, this, std::placeholders::_1),
-                                BIND_RAW_DATA_EVENT(RawMonitoringFrameReceived),
+                                std::bind(&ScannerV2::rawMonitoringFrameReceivedCallback,
+                                          this,
+                                          std::placeholders::_1,
+                                          std::placeholders::_2,
+                                          std::placeholders::_3),
                                 BIND_EVENT(MonitoringFrameReceivedError),
                                 std::bind(&ScannerV2::scannerStartedCallback, this),
                                 std::bind(&ScannerV2::scannerStoppedCallback, this),
-                                IScanner::laserScanCallback(),
+                                std::bind(&ScannerV2::laserScanReceivedCallback, this, _1),
                                 BIND_EVENT(scanner_events::StartTimeout),
-                                BIND_EVENT(scanner_events::MonitoringFrameTimeout)))
+                                BIND_EVENT(scanner_events::RestartStopTimeout),
+                                BIND_EVENT(scanner_events::MonitoringFrameTimeout),
+                                io_edge_callback,
+                                io_edge_filter,
+                                std::bind(&ScannerV2::diagnosticsChangedCallback,
+                                          this,
+                                          std::placeholders::_1,
+                                          std::placeholders::_2)))
 // LCOV_EXCL_STOP
 {
   const std::lock_guard<std::mutex> lock(member_mutex_);
@@ -66,6 +98,7 @@ ScannerV2::~ScannerV2()
   PSENSCAN_DEBUG("Scanner", "Destruction called.");
 
   const std::lock_guard<std::mutex> lock(member_mutex_);
+  terminated_ = true;
   sm_->stop();
 }
 
@@ -97,6 +130,14 @@ std::future<void> ScannerV2::stop()
     return std::future<void>();
   }
 
+  if (scanner_has_reconfigured_)
+  {
+    scanner_has_reconfigured_.value().set_exception(
+        std::make_exception_ptr(std::runtime_error("Reconfiguration aborted by stop request.")));
+    scanner_has_reconfigured_ = boost::none;
+  }
+  scanner_is_running_ = false;
+
   // No call to triggerEvent() because lock already taken
   sm_->process_event(scanner_events::StopRequest());
   // Due to the fact that the getting of the future should always succeed (because of the
@@ -105,11 +146,87 @@ std::future<void> ScannerV2::stop()
   return scanner_has_stopped_.value().get_future();
 }
 
+std::future<void> ScannerV2::reconfigure(const ScannerConfiguration& scanner_config)
+{
+  PSENSCAN_INFO("Scanner", "Reconfigure scanner called.");
+  checkReconfigurable(IScanner::config(), scanner_config);
+  checkSubscriberLaserScanCallbacks(scanner_config, subscriber_laser_scan_callbacks_);
+
+  const std::lock_guard<std::mutex> lock(member_mutex_);
+  if (scanner_has_reconfigured_)
+  {
+    return std::future<void>();
+  }
+
+  std::promise<void> promise;
+  if (!scanner_is_running_)
+  {
+    promise.set_exception(
+        std::make_exception_ptr(std::runtime_error("The scanner has to be running to be reconfigured.")));
+    return promise.get_future();
+  }
+
+  // No call to triggerEvent() because lock already taken
+  sm_->process_event(scanner_events::ReconfigureRequest(scanner_config));
+  scanner_has_reconfigured_ = std::move(promise);
+  return scanner_has_reconfigured_.value().get_future();
+}
+
+boost::optional<std::chrono::nanoseconds> ScannerV2::lastReconfigurationGap()
+{
+  const std::lock_guard<std::mutex> lock(member_mutex_);
+  return sm_->lastReconfigurationGap();
+}
+
+void ScannerV2::onDiagnosticsChanged(const DiagnosticsCallback& diagnostics_callback)
+{
+  const std::lock_guard<std::mutex> lock(member_mutex_);
+  diagnostics_callback_ = diagnostics_callback;
+}
+
+boost::optional<LaserScan> ScannerV2::waitForNextScan(const std::chrono::nanoseconds& timeout)
+{
+  latest_scan_enabled_ = true;
+  return latest_scan_.waitForNext(timeout);
+}
+
+boost::optional<LaserScan> ScannerV2::tryGetLatestScan()
+{
+  latest_scan_enabled_ = true;
+  return latest_scan_.tryTake();
+}
+
+const util::HotPathTracer& ScannerV2::hotPathTracer() const
+{
+  // No lock needed because the tracer is thread-safe and lives as long as the state machine.
+  return sm_->hotPathTracer();
+}
+
+const ScanFilterChain& ScannerV2::scanFilterChain() const
+{
+  // No lock needed because the filters are not changed after the construction of the state machine.
+  return sm_->scanFilterChain();
+}
+
+util::ScanClockEstimator::Statistics ScannerV2::scanClockStatistics()
+{
+  const std::lock_guard<std::mutex> lock(member_mutex_);
+  return sm_->scanClockEstimator().statistics();
+}
+
 // PLEASE NOTE:
 // The callback does not take a member lock because the callback is always called
 // via call to triggerEvent() or triggerEventWithParam() which already take the mutex.
 void ScannerV2::scannerStartedCallback()
 {
+  scanner_is_running_ = true;
+  if (scanner_has_reconfigured_)
+  {
+    PSENSCAN_INFO("ScannerController", "Scanner reconfigured successfully.");
+    scanner_has_reconfigured_.value().set_value();
+    scanner_has_reconfigured_ = boost::none;
+    return;
+  }
   PSENSCAN_INFO("ScannerController", "Scanner started successfully.");
   scanner_has_started_.value().set_value();
   scanner_has_started_ = boost::none;
@@ -127,6 +244,14 @@ void ScannerV2::scannerStoppedCallback()
 
 void ScannerV2::scannerStartErrorCallback(const std::string& error_msg)
 {
+  scanner_is_running_ = false;
+  if (scanner_has_reconfigured_)
+  {
+    PSENSCAN_INFO("ScannerController", "Scanner reconfiguration failed.");
+    scanner_has_reconfigured_.value().set_exception(std::make_exception_ptr(std::runtime_error(error_msg)));
+    scanner_has_reconfigured_ = boost::none;
+    return;
+  }
   PSENSCAN_INFO("ScannerController", "Scanner start failed.");
   scanner_has_started_.value().set_exception(std::make_exception_ptr(std::runtime_error(error_msg)));
   scanner_has_started_ = boost::none;
@@ -134,9 +259,147 @@ void ScannerV2::scannerStartErrorCallback(const std::string& error_msg)
 
 void ScannerV2::scannerStopErrorCallback(const std::string& error_msg)
 {
+  if (scanner_has_reconfigured_)
+  {
+    PSENSCAN_INFO("ScannerController", "Scanner reconfiguration failed.");
+    scanner_is_running_ = false;
+    scanner_has_reconfigured_.value().set_exception(std::make_exception_ptr(std::runtime_error(error_msg)));
+    scanner_has_reconfigured_ = boost::none;
+    return;
+  }
   PSENSCAN_INFO("ScannerController", "Scanner stop failed.");
   scanner_has_stopped_.value().set_exception(std::make_exception_ptr(std::runtime_error(error_msg)));
   scanner_has_stopped_ = boost::none;
 }
 
+const communication_layer::FrameRecorder* ScannerV2::frameRecorder() const
+{
+  return frame_recorder_.get();
+}
+
+const communication_layer::ScanRingPublisher* ScannerV2::scanRingPublisher() const
+{
+  return scan_ring_publisher_.get();
+}
+
+void ScannerV2::rawMonitoringFrameReceivedCallback(const data_conversion_layer::RawDataConstPtr& data,
+                                                   const std::size_t& num_bytes,
+                                                   const int64_t& timestamp)
+{
+  if (frame_recorder_)
+  {
+    frame_recorder_->record(*data, num_bytes, timestamp);
+  }
+  triggerEventWithParam(RawMonitoringFrameReceived(data, num_bytes, timestamp));
+}
+
+// PLEASE NOTE:
+// The callback does not take a member lock because the callback is always called
+// via call to triggerEvent() or triggerEventWithParam() which already take the mutex.
+void ScannerV2::laserScanReceivedCallback(const LaserScan& scan)
+{
+  if (scan.scannerId() != configuration::ScannerId::master)
+  {
+    const auto subscriber_callback{ subscriber_laser_scan_callbacks_.find(scan.scannerId()) };
+    if (subscriber_callback != subscriber_laser_scan_callbacks_.end())
+    {
+      subscriber_callback->second(scan);
+      return;
+    }
+  }
+  else
+  {
+    if (scan_ring_publisher_)
+    {
+      scan_ring_publisher_->publish(scan);
+    }
+    // Only copied for users of the pull API
+    if (latest_scan_enabled_)
+    {
+      latest_scan_.put(scan);
+    }
+  }
+  IScanner::laserScanCallback()(scan);
+}
+
+void ScannerV2::diagnosticsChangedCallback(
+    const configuration::ScannerId& scanner_id,
+    const std::vector<data_conversion_layer::monitoring_frame::diagnostic::Message>& diagnostic_messages)
+{
+  if (diagnostics_callback_)
+  {
+    diagnostics_callback_(scanner_id, diagnostic_messages);
+  }
+}
+
+std::unique_ptr<communication_layer::FrameRecorder>
+ScannerV2::createFrameRecorder(const ScannerConfiguration& scanner_config)
+{
+  if (!scanner_config.frameRecordingPrefix())
+  {
+    return nullptr;
+  }
+  return std::unique_ptr<communication_layer::FrameRecorder>(
+      new communication_layer::FrameRecorder(scanner_config.frameRecordingPrefix().get(),
+                                             scanner_config.frameRecordingMaxFileSize(),
+                                             scanner_config.frameRecordingMaxNumFiles()));
+}
+
+std::unique_ptr<communication_layer::ScanRingPublisher>
+ScannerV2::createScanRingPublisher(const ScannerConfiguration& scanner_config)
+{
+  if (!scanner_config.scanRingName())
+  {
+    return nullptr;
+  }
+  return std::unique_ptr<communication_layer::ScanRingPublisher>(new communication_layer::ScanRingPublisher(
+      scanner_config.scanRingName().get(), scanner_config.scanRingNumSlots()));
+}
+
+void ScannerV2::checkReconfigurable(const ScannerConfiguration& current_config, const ScannerConfiguration& new_config)
+{
+  const auto throw_if_changed = [](const bool changed, const std::string& setting) {
+    if (changed)
+    {
+      throw std::invalid_argument("The " + setting + " cannot be changed by a reconfiguration.");
+    }
+  };
+  throw_if_changed(current_config.hostIp() != new_config.hostIp() ||
+                       current_config.hostUDPPortData() != new_config.hostUDPPortData() ||
+                       current_config.hostUDPPortControl() != new_config.hostUDPPortControl() ||
+                       current_config.clientIp() != new_config.clientIp() ||
+                       current_config.scannerDataPort() != new_config.scannerDataPort() ||
+                       current_config.scannerControlPort() != new_config.scannerControlPort(),
+                   "network configuration");
+  throw_if_changed(current_config.hotPathTracingEnabled() != new_config.hotPathTracingEnabled(),
+                   "hot path tracing");
+  throw_if_changed(current_config.frameRecordingPrefix() != new_config.frameRecordingPrefix() ||
+                       current_config.frameRecordingMaxFileSize() != new_config.frameRecordingMaxFileSize() ||
+                       current_config.frameRecordingMaxNumFiles() != new_config.frameRecordingMaxNumFiles(),
+                   "frame recording");
+  throw_if_changed(current_config.scanRingName() != new_config.scanRingName() ||
+                       current_config.scanRingNumSlots() != new_config.scanRingNumSlots(),
+                   "publishing to shared memory");
+  throw_if_changed(current_config.scanFilters() != new_config.scanFilters(), "scan filters");
+}
+
+const ScannerV2::SubscriberLaserScanCallbacks&
+ScannerV2::checkSubscriberLaserScanCallbacks(const ScannerConfiguration& scanner_config,
+                                             const SubscriberLaserScanCallbacks& subscriber_laser_scan_callbacks)
+{
+  for (const auto& subscriber_callback : subscriber_laser_scan_callbacks)
+  {
+    if (subscriber_callback.first == configuration::ScannerId::master)
+    {
+      throw std::invalid_argument("The laser scan callback of the master device cannot be set as subscriber callback.");
+    }
+    if (!scanner_config.deviceEnabled(subscriber_callback.first))
+    {
+      throw std::invalid_argument(configuration::SCANNER_ID_TO_STRING.at(subscriber_callback.first) +
+                                  " has a laser scan callback but is not enabled.");
+    }
+  }
+  return subscriber_laser_scan_callbacks;
+}
+
 }  // namespace psen_scan_v2_standalone
@@ -0,0 +1,175 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "psen_scan_v2_standalone/zone_intrusion_monitor.h"
+
+namespace psen_scan_v2_standalone
+{
+static constexpr double NOT_COVERED{ -std::numeric_limits<double>::infinity() };
+
+bool ZoneSetIntrusion::intruded() const
+{
+  return std::any_of(fields_.begin(), fields_.end(), [](const auto& field) { return field.intruded(); });
+}
+
+ZoneIntrusionMonitor::ZoneIntrusionMonitor(const configuration::ZoneSetConfiguration& zoneset_config)
+  : zoneset_config_(zoneset_config)
+{
+}
+
+ZoneSetIntrusion ZoneIntrusionMonitor::check(const LaserScan& scan)
+{
+  ZoneSetIntrusion result;
+  check(scan, result);
+  return result;
+}
+
+void ZoneIntrusionMonitor::check(const LaserScan& scan, ZoneSetIntrusion& result)
+{
+  const auto& zoneset{ resampledZoneSet(scan) };
+  for (std::size_t i = 0; i < NUMBER_OF_ZONE_FIELDS; ++i)
+  {
+    result.fields_[i].configured_ = zoneset.configured_[i];
+    compare(scan.measurements(), zoneset.fields_[i], result.fields_[i]);
+  }
+}
+
+std::size_t ZoneIntrusionMonitor::cacheSize() const
+{
+  return cache_.size();
+}
+
+const ZoneIntrusionMonitor::ResampledZoneSet& ZoneIntrusionMonitor::resampledZoneSet(const LaserScan& scan)
+{
+  const CacheKey key{ scan.activeZoneset(),
+                      scan.minScanAngle().value(),
+                      scan.maxScanAngle().value(),
+                      scan.scanResolution().value(),
+                      scan.measurements().size() };
+  const auto cached{ cache_.find(key) };
+  if (cached != cache_.end())
+  {
+    return cached->second;
+  }
+
+  if (scan.activeZoneset() >= zoneset_config_.zonesets_.size())
+  {
+    throw ZoneSetNotConfigured(fmt::format("Active zoneset {} is not part of the zoneset configuration ({} zonesets).",
+                                           scan.activeZoneset(),
+                                           zoneset_config_.zonesets_.size()));
+  }
+  return cache_
+      .emplace(key,
+               resample(zoneset_config_.zonesets_[scan.activeZoneset()],
+                        scan.minScanAngle(),
+                        scan.scanResolution(),
+                        scan.measurements().size()))
+      .first->second;
+}
+
+ZoneIntrusionMonitor::ResampledZoneSet ZoneIntrusionMonitor::resample(const configuration::ZoneSet& zoneset,
+                                                                      const util::TenthOfDegree& min_scan_angle,
+                                                                      const util::TenthOfDegree& scan_resolution,
+                                                                      std::size_t num_beams)
+{
+  const std::array<const std::vector<unsigned long>*, NUMBER_OF_ZONE_FIELDS> radii{
+    &zoneset.safety1_, &zoneset.safety2_, &zoneset.safety3_, &zoneset.warn1_,
+    &zoneset.warn2_,   &zoneset.muting1_, &zoneset.muting2_
+  };
+
+  ResampledZoneSet resampled;
+  for (std::size_t i = 0; i < NUMBER_OF_ZONE_FIELDS; ++i)
+  {
+    resampled.configured_[i] = !radii[i]->empty();
+    resampled.fields_[i] = resample(*radii[i], zoneset.resolution_, min_scan_angle, scan_resolution, num_beams);
+  }
+  return resampled;
+}
+
+ZoneIntrusionMonitor::ResampledField ZoneIntrusionMonitor::resample(const std::vector<unsigned long>& radii_in_mm,
+                                                                    const util::TenthOfDegree& zoneset_resolution,
+                                                                    const util::TenthOfDegree& min_scan_angle,
+                                                                    const util::TenthOfDegree& scan_resolution,
+                                                                    std::size_t num_beams)
+{
+  ResampledField field(num_beams, NOT_COVERED);
+  if (radii_in_mm.empty() || zoneset_resolution.value() <= 0)
+  {
+    return field;
+  }
+
+  const double last_index{ static_cast<double>(radii_in_mm.size() - 1) };
+  for (std::size_t beam = 0; beam < num_beams; ++beam)
+  {
+    const double index{ static_cast<double>(min_scan_angle.value() + scan_resolution.value() * beam) /
+                        zoneset_resolution.value() };
+    if (index < 0. || index > last_index)
+    {
+      continue;
+    }
+    const auto lower{ static_cast<std::size_t>(std::floor(index)) };
+    const auto upper{ static_cast<std::size_t>(std::ceil(index)) };
+    const double lower_radius{ static_cast<double>(radii_in_mm[lower]) };
+    const double upper_radius{ static_cast<double>(radii_in_mm[upper]) };
+
+    double radius_in_mm;
+    if (lower_radius == 0. || upper_radius == 0.)
+    {
+      // Do not blend into gaps of the field
+      radius_in_mm = (index - lower < upper - index) ? lower_radius : upper_radius;
+    }
+    else
+    {
+      radius_in_mm = lower_radius + (upper_radius - lower_radius) * (index - lower);
+    }
+    if (radius_in_mm > 0.)
+    {
+      field[beam] = radius_in_mm / 1000.;
+    }
+  }
+  return field;
+}
+
+void ZoneIntrusionMonitor::compare(const LaserScan::MeasurementData& measurements,
+                                   const ResampledField& radii,
+                                   FieldIntrusion& result)
+{
+  const std::size_t num_beams{ std::min(measurements.size(), radii.size()) };
+  result.intrusion_mask_.resize(num_beams);
+
+  const double* meas{ measurements.data() };
+  const double* rad{ radii.data() };
+  uint8_t* mask{ result.intrusion_mask_.data() };
+  std::size_t num_intrusions{ 0 };
+  double min_margin{ std::numeric_limits<double>::infinity() };
+  for (std::size_t beam = 0; beam < num_beams; ++beam)
+  {
+    const uint8_t intruded{ static_cast<uint8_t>(meas[beam] < rad[beam]) };
+    mask[beam] = intruded;
+    num_intrusions += intruded;
+    min_margin = std::min(min_margin, meas[beam] - rad[beam]);
+  }
+  result.num_intrusions_ = num_intrusions;
+  result.min_margin_ = min_margin;
+}
+
+}  // namespace psen_scan_v2_standalone
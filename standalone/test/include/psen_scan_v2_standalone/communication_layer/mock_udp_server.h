@@ -66,6 +66,9 @@ public:
   void asyncSend(const udp::endpoint& receiver_of_data,
                  const psen_scan_v2_standalone::data_conversion_layer::RawData& data);
 
+  //! @brief Sends the data from the calling thread. Must not be called concurrently with other operations.
+  void send(const udp::endpoint& receiver_of_data, const psen_scan_v2_standalone::data_conversion_layer::RawData& data);
+
 private:
   void handleSend(const boost::system::error_code& error, std::size_t bytes_transferred);
   void handleReceive(const ReceiveMode& modi,
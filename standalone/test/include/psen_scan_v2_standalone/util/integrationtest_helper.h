@@ -48,7 +48,7 @@ static constexpr ScanRange DEFAULT_SCAN_RANGE{ util::TenthOfDegree(1), util::Ten
 static constexpr util::TenthOfDegree DEFAULT_SCAN_RESOLUTION{ 2 };
 static constexpr int64_t DEFAULT_TIMESTAMP{ 1000000000 };
 
-static double randDouble(double low, double high)
+inline double randDouble(double low, double high)
 {
   static std::default_random_engine re{};
   using Dist = std::uniform_real_distribution<double>;
@@ -56,12 +56,12 @@ static double randDouble(double low, double high)
   return uid(re, Dist::param_type{ low, high });
 }
 
-static double restrictToOneDigitsAfterComma(const double& value)
+inline double restrictToOneDigitsAfterComma(const double& value)
 {
   return std::round(value * 10.) / 10.;
 }
 
-static std::vector<double> generateMeasurements(const unsigned int& num_elements, const double& low, const double& high)
+inline std::vector<double> generateMeasurements(const unsigned int& num_elements, const double& low, const double& high)
 {
   std::vector<double> vec(num_elements);
   // The scanner sends tenth degree values. Therefore, restrict values to one digit after the comma.
@@ -69,7 +69,7 @@ static std::vector<double> generateMeasurements(const unsigned int& num_elements
   return vec;
 }
 
-static std::vector<double> generateIntensities(const unsigned int& num_elements, const double& low, const double& high)
+inline std::vector<double> generateIntensities(const unsigned int& num_elements, const double& low, const double& high)
 {
   std::vector<double> vec(num_elements);
   // The scanner sends intensities as int values, therefore, the values are rounded.
@@ -77,7 +77,7 @@ static std::vector<double> generateIntensities(const unsigned int& num_elements,
   return vec;
 }
 
-static data_conversion_layer::monitoring_frame::MessageBuilder
+inline data_conversion_layer::monitoring_frame::MessageBuilder
 createMonitoringFrameMsgBuilderWithoutDiagnostics(const util::TenthOfDegree start_angle = DEFAULT_SCAN_RANGE.start(),
                                                   const util::TenthOfDegree end_angle = DEFAULT_SCAN_RANGE.end())
 {
@@ -100,7 +100,7 @@ createMonitoringFrameMsgBuilderWithoutDiagnostics(const util::TenthOfDegree star
   return msg_builder;
 }
 
-static data_conversion_layer::monitoring_frame::MessageBuilder
+inline data_conversion_layer::monitoring_frame::MessageBuilder
 createMonitoringFrameMsgBuilder(const util::TenthOfDegree start_angle = DEFAULT_SCAN_RANGE.start(),
                                 const util::TenthOfDegree end_angle = DEFAULT_SCAN_RANGE.end())
 {
@@ -109,7 +109,7 @@ createMonitoringFrameMsgBuilder(const util::TenthOfDegree start_angle = DEFAULT_
                               data_conversion_layer::monitoring_frame::diagnostic::ErrorLocation(1, 7) } });
 }
 
-static data_conversion_layer::monitoring_frame::Message
+inline data_conversion_layer::monitoring_frame::Message
 createMonitoringFrameMsg(const uint32_t scan_counter = DEFAULT_SCAN_COUNTER,
                          const util::TenthOfDegree start_angle = DEFAULT_SCAN_RANGE.start(),
                          const util::TenthOfDegree end_angle = DEFAULT_SCAN_RANGE.end())
@@ -117,12 +117,12 @@ createMonitoringFrameMsg(const uint32_t scan_counter = DEFAULT_SCAN_COUNTER,
   return createMonitoringFrameMsgBuilder(start_angle, end_angle).scanCounter(scan_counter);
 }
 
-static data_conversion_layer::monitoring_frame::Message createMonitoringFrameMsgWithoutDiagnostics()
+inline data_conversion_layer::monitoring_frame::Message createMonitoringFrameMsgWithoutDiagnostics()
 {
   return createMonitoringFrameMsgBuilderWithoutDiagnostics();
 }
 
-static data_conversion_layer::monitoring_frame::Message
+inline data_conversion_layer::monitoring_frame::Message
 createMonitoringFrameMsgWithZoneset(const uint8_t active_zoneset)
 {
   return createMonitoringFrameMsgBuilder().activeZoneset(active_zoneset);
@@ -139,7 +139,9 @@ std::vector<data_conversion_layer::monitoring_frame::Message> createMonitoringFr
 }
 
 std::vector<data_conversion_layer::monitoring_frame::Message>
-createMonitoringFrameMsgsForScanRound(const uint32_t scan_counter, const std::size_t num_elements)
+createMonitoringFrameMsgsForScanRound(const uint32_t scan_counter,
+                                      const std::size_t num_elements,
+                                      const configuration::ScannerId scanner_id = configuration::ScannerId::master)
 {
   std::vector<data_conversion_layer::monitoring_frame::Message> msgs;
   for (std::size_t i = 0; i < num_elements; ++i)
@@ -148,12 +150,13 @@ createMonitoringFrameMsgsForScanRound(const uint32_t scan_counter, const std::si
         (DEFAULT_SCAN_RANGE.end() / static_cast<int>(num_elements)) * static_cast<int>(i);
     const util::TenthOfDegree end_angle =
         (DEFAULT_SCAN_RANGE.end() / static_cast<int>(num_elements)) * static_cast<int>(i + 1);
-    msgs.push_back(createMonitoringFrameMsgBuilder(start_angle, end_angle).scanCounter(scan_counter));
+    msgs.push_back(
+        createMonitoringFrameMsgBuilder(start_angle, end_angle).scanCounter(scan_counter).scannerId(scanner_id));
   }
   return msgs;
 }
 
-static std::vector<data_conversion_layer::monitoring_frame::MessageStamped>
+inline std::vector<data_conversion_layer::monitoring_frame::MessageStamped>
 stampMonitoringFrameMsgs(const std::vector<data_conversion_layer::monitoring_frame::Message>& msgs, int64_t stamp)
 {
   std::vector<data_conversion_layer::monitoring_frame::MessageStamped> stamped_msgs;
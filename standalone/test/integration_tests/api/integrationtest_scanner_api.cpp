@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <cstdio>
 #include <cstddef>
 #include <functional>
 #include <future>
@@ -26,19 +27,25 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 
 // Test frameworks
 #include "psen_scan_v2_standalone/communication_layer/scanner_mock.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_serialization.h"
 #include "psen_scan_v2_standalone/util/integrationtest_helper.h"
 #include "psen_scan_v2_standalone/util/gtest_expectations.h"
 #include "psen_scan_v2_standalone/util/matchers_and_actions.h"
 #include "psen_scan_v2_standalone/util/mock_console_bridge_output_handler.h"
 
 // Software under testing
+#include "psen_scan_v2_standalone/communication_layer/scan_ring_reader.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/frame_recording.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/start_request.h"
 #include "psen_scan_v2_standalone/data_conversion_layer/start_request_serialization.h"
+#include "psen_scan_v2_standalone/io_edge.h"
 #include "psen_scan_v2_standalone/laserscan.h"
+#include "psen_scan_v2_standalone/scan_filter.h"
 #include "psen_scan_v2_standalone/scanner_config_builder.h"
 #include "psen_scan_v2_standalone/scanner_configuration.h"
 #include "psen_scan_v2_standalone/scanner_v2.h"
@@ -63,6 +70,11 @@ class UserCallbacks
 {
 public:
   MOCK_METHOD1(LaserScanCallback, void(const LaserScan&));
+  MOCK_METHOD1(SubscriberLaserScanCallback, void(const LaserScan&));
+  MOCK_METHOD1(IOEdgeCallback, void(const IOEdge&));
+  MOCK_METHOD2(DiagnosticsCallback,
+               void(const configuration::ScannerId&,
+                    const std::vector<data_conversion_layer::monitoring_frame::diagnostic::Message>&));
 };
 
 #define EXPECT_STOP_REQUEST_CALL(hw_mock)                                                                              \
@@ -458,6 +470,24 @@ TEST_F(ScannerAPITestsDefaultSetUp, shouldShowUserMsgIfMonitoringFrameReceiveTim
   REMOVE_LOG_MOCK
 }
 
+TEST_F(ScannerAPITestsDefaultSetUp, shouldDropMonitoringFrameTimeoutWhichFiresDuringDestruction)
+{
+  INJECT_LOG_MOCK
+  EXPECT_ANY_LOG().Times(AnyNumber());
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  // The destructor holds the lock of the scanner until the timeout fired, so that its event has to wait for the lock.
+  EXPECT_LOG_SHORT(DEBUG, "StateMachine: Exiting state: WaitForMonitoringFrame")
+      .WillOnce(InvokeWithoutArgs([]() { std::this_thread::sleep_for(protocol_layer::WATCHDOG_TIMEOUT + 500ms); }));
+  EXPECT_LOG_SHORT(WARN,
+                   "StateMachine: Timeout while waiting for MonitoringFrame message."
+                   " (Please check the ethernet connection or contact PILZ support if the error persists.)")
+      .Times(0);
+
+  driver_.reset();
+  REMOVE_LOG_MOCK
+}
+
 TEST_F(ScannerAPITestsFragmented, LaserScanShouldContainAllInfosTransferedByMonitoringFrameMsg)
 {
   INJECT_LOG_MOCK
@@ -484,6 +514,116 @@ TEST_F(ScannerAPITestsFragmented, LaserScanShouldContainAllInfosTransferedByMoni
   REMOVE_LOG_MOCK
 }
 
+TEST_F(ScannerAPITestsDefaultSetUp, shouldCallDiagnosticsCallbackOnlyWhenDiagnosticsChange)
+{
+  INJECT_LOG_MOCK
+  EXPECT_ANY_LOG().Times(AnyNumber());
+  EXPECT_CALL(user_callbacks_, LaserScanCallback(_)).Times(AnyNumber());
+  driver_->onDiagnosticsChanged(std::bind(
+      &UserCallbacks::DiagnosticsCallback, &user_callbacks_, std::placeholders::_1, std::placeholders::_2));
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  const auto msg_with_error{ createMonitoringFrameMsg() };
+  const auto msg_without_error{ createMonitoringFrameMsgBuilderWithoutDiagnostics().diagnosticMessages({}).build() };
+  util::Barrier diagnostics_cleared_barrier;
+  {
+    InSequence seq;
+    EXPECT_CALL(user_callbacks_,
+                DiagnosticsCallback(configuration::ScannerId::master,
+                                    Pointwise(Eq(), msg_with_error.diagnosticMessages())));
+    EXPECT_CALL(user_callbacks_, DiagnosticsCallback(configuration::ScannerId::master, IsEmpty()))
+        .WillOnce(OpenBarrier(&diagnostics_cleared_barrier));
+  }
+  EXPECT_LOG_SHORT(INFO, "StateMachine: The scanner reports no more errors of device Master.").Times(1);
+
+  hw_mock_->sendMonitoringFrame(msg_with_error);
+  hw_mock_->sendMonitoringFrame(msg_with_error);
+  hw_mock_->sendMonitoringFrame(msg_without_error);
+  hw_mock_->sendMonitoringFrame(msg_without_error);
+
+  diagnostics_cleared_barrier.waitTillRelease(2s);
+
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+  REMOVE_LOG_MOCK
+}
+
+TEST_F(ScannerAPITestsDefaultSetUp, shouldReportPersistingDiagnosticsAgainAfterReconfiguration)
+{
+  INJECT_LOG_MOCK
+  EXPECT_ANY_LOG().Times(AnyNumber());
+  EXPECT_CALL(user_callbacks_, LaserScanCallback(_)).Times(AnyNumber());
+  driver_->onDiagnosticsChanged(std::bind(
+      &UserCallbacks::DiagnosticsCallback, &user_callbacks_, std::placeholders::_1, std::placeholders::_2));
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  const auto msg_with_error{ createMonitoringFrameMsg() };
+  util::Barrier diagnostics_before_barrier;
+  util::Barrier diagnostics_after_barrier;
+  EXPECT_CALL(user_callbacks_,
+              DiagnosticsCallback(configuration::ScannerId::master,
+                                  Pointwise(Eq(), msg_with_error.diagnosticMessages())))
+      .WillOnce(OpenBarrier(&diagnostics_before_barrier))
+      .WillOnce(OpenBarrier(&diagnostics_after_barrier));
+  hw_mock_->sendMonitoringFrame(msg_with_error);
+  diagnostics_before_barrier.waitTillRelease(2s);
+
+  const ScannerConfiguration new_config{ ScannerConfigurationBuilder(*config_).scanResolution(util::TenthOfDegree(2)) };
+  util::Barrier stop_req_barrier;
+  util::Barrier start_req_barrier;
+  EXPECT_STOP_REQUEST_CALL(*hw_mock_).WillOnce(OpenBarrier(&stop_req_barrier));
+  EXPECT_START_REQUEST_CALL(*hw_mock_, new_config).WillOnce(OpenBarrier(&start_req_barrier));
+  auto reconfigure_future{ driver_->reconfigure(new_config) };
+  stop_req_barrier.waitTillRelease(2s);
+  hw_mock_->sendStopReply();
+  start_req_barrier.waitTillRelease(2s);
+  hw_mock_->sendStartReply();
+  EXPECT_FUTURE_IS_READY(reconfigure_future, 2s) << "Scanner::reconfigure() not finished";
+
+  hw_mock_->sendMonitoringFrame(msg_with_error);
+  diagnostics_after_barrier.waitTillRelease(2s);
+
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+  REMOVE_LOG_MOCK
+}
+
+TEST_F(ScannerAPITests, shouldOnlyReportDiagnosticsOfDeviceWhichSentMonitoringFrame)
+{
+  config_.reset(new ScannerConfiguration(
+      ScannerConfigurationBuilder(generateScannerConfig(HOST_IP_ADDRESS, UNFRAGMENTED_SCAN))
+          .addSubscriber(configuration::ScannerId::subscriber0, DEFAULT_SCAN_RANGE, DEFAULT_SCAN_RESOLUTION)));
+  setUpScannerV2Driver();
+  setUpScannerHwMock();
+  EXPECT_CALL(user_callbacks_, LaserScanCallback(_)).Times(AnyNumber());
+  driver_->onDiagnosticsChanged(std::bind(
+      &UserCallbacks::DiagnosticsCallback, &user_callbacks_, std::placeholders::_1, std::placeholders::_2));
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  namespace diagnostic = data_conversion_layer::monitoring_frame::diagnostic;
+  const diagnostic::Message master_error(configuration::ScannerId::master, diagnostic::ErrorLocation(1, 7));
+  const diagnostic::Message subscriber_error(configuration::ScannerId::subscriber0, diagnostic::ErrorLocation(1, 6));
+  // Every frame carries the errors of all devices.
+  const auto master_msg{ createMonitoringFrameMsgBuilder().diagnosticMessages({ master_error }).build() };
+  const auto subscriber_msg{ createMonitoringFrameMsgBuilder()
+                                 .scannerId(configuration::ScannerId::subscriber0)
+                                 .diagnosticMessages({ master_error, subscriber_error })
+                                 .build() };
+  util::Barrier subscriber_barrier;
+  EXPECT_CALL(user_callbacks_,
+              DiagnosticsCallback(configuration::ScannerId::master, ElementsAre(master_error)));
+  EXPECT_CALL(user_callbacks_,
+              DiagnosticsCallback(configuration::ScannerId::subscriber0, ElementsAre(subscriber_error)))
+      .WillOnce(OpenBarrier(&subscriber_barrier));
+
+  hw_mock_->sendMonitoringFrame(master_msg);
+  hw_mock_->sendMonitoringFrame(subscriber_msg);
+  hw_mock_->sendMonitoringFrame(master_msg);
+  hw_mock_->sendMonitoringFrame(subscriber_msg);
+
+  subscriber_barrier.waitTillRelease(2s);
+
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+}
+
 TEST_F(ScannerAPITestsFragmented, shouldCallLaserscanCallbackInCaseOfMissingDiagnostics)
 {
   EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
@@ -607,6 +747,37 @@ TEST_F(ScannerAPITestsFragmented, shouldShowUserMsgIfTooManyMonitoringFramesAreR
   REMOVE_LOG_MOCK
 }
 
+TEST_F(ScannerAPITests, shouldCallIOEdgeCallbackForChangedSelectedPinsOfSingleFrame)
+{
+  setUpScannerConfig(HOST_IP_ADDRESS, UNFRAGMENTED_SCAN);
+  const auto filter{ IOEdgeFilter().output(data_conversion_layer::monitoring_frame::io::OutputType::safe_1_int) };
+  driver_.reset(new ScannerV2(*config_,
+                              std::bind(&UserCallbacks::LaserScanCallback, &user_callbacks_, std::placeholders::_1),
+                              std::bind(&UserCallbacks::IOEdgeCallback, &user_callbacks_, std::placeholders::_1),
+                              filter));
+  setUpScannerHwMock();
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  data_conversion_layer::monitoring_frame::io::PinData pin_data{};
+  const data_conversion_layer::monitoring_frame::Message msg1{ createMonitoringFrameMsgBuilder().iOPinData(pin_data) };
+  pin_data.output_state.at(0).set(0);  // Safety 1 intrusion
+  pin_data.input_state.at(4).set(6);   // Zone Set Switching Input 1 is not selected
+  const data_conversion_layer::monitoring_frame::Message msg2{ createMonitoringFrameMsgBuilder().iOPinData(pin_data) };
+
+  util::Barrier edge_barrier;
+  EXPECT_CALL(user_callbacks_,
+              IOEdgeCallback(AllOf(Property(&IOEdge::direction, IOEdge::Direction::rising),
+                                   Property(&IOEdge::pinType, IOEdge::PinType::output))))
+      .WillOnce(OpenBarrier(&edge_barrier));
+
+  hw_mock_->sendMonitoringFrame(msg1);
+  hw_mock_->sendMonitoringFrame(msg2);
+
+  edge_barrier.waitTillRelease(2s);
+
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+}
+
 TEST_F(ScannerAPITestsUnfragmented, shouldCallLaserScanCallbackOnlyOneTimeWithAllInformation)
 {
   EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
@@ -622,6 +793,289 @@ TEST_F(ScannerAPITestsUnfragmented, shouldCallLaserScanCallbackOnlyOneTimeWithAl
   EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
 }
 
+TEST_F(ScannerAPITests, shouldTraceAllStagesOfScanRoundIfHotPathTracingIsEnabled)
+{
+  config_.reset(new ScannerConfiguration(ScannerConfigurationBuilder(SCANNER_IP_ADDRESS)
+                                             .hostIP(HOST_IP_ADDRESS)
+                                             .hostDataPort(port_holder_.data_port_host)
+                                             .hostControlPort(port_holder_.control_port_host)
+                                             .scannerDataPort(port_holder_.data_port_scanner)
+                                             .scannerControlPort(port_holder_.control_port_scanner)
+                                             .scanRange(DEFAULT_SCAN_RANGE)
+                                             .scanResolution(DEFAULT_SCAN_RESOLUTION)
+                                             .enableIntensities()
+                                             .enableHotPathTracing(true)));
+  setUpScannerV2Driver();
+  setUpScannerHwMock();
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  const auto msgs{ createMonitoringFrameMsgsForScanRound(2, 6) };
+  util::Barrier monitoring_frame_barrier;
+  EXPECT_CALLBACK_WILL_OPEN_BARRIER(user_callbacks_, msgs, monitoring_frame_barrier);
+
+  hw_mock_->sendMonitoringFrames(msgs);
+
+  monitoring_frame_barrier.waitTillRelease(2s);
+
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+
+  using Stage = util::HotPathTracer::Stage;
+  const util::HotPathTracer& tracer{ driver_->hotPathTracer() };
+  EXPECT_EQ(msgs.size(), tracer.histogram(Stage::deserialization).count());
+  EXPECT_EQ(1u, tracer.histogram(Stage::scan_round).count());
+  EXPECT_EQ(1u, tracer.histogram(Stage::conversion).count());
+  EXPECT_EQ(1u, tracer.histogram(Stage::callback).count());
+  EXPECT_EQ(1u, tracer.histogram(Stage::total).count());
+  for (std::size_t i = 0; i < util::HotPathTracer::NUM_STAGES; ++i)
+  {
+    const Stage stage{ static_cast<Stage>(i) };
+    EXPECT_GT(tracer.summary(stage).max, 0ns) << util::HotPathTracer::stageName(stage);
+  }
+}
+
+TEST_F(ScannerAPITestsUnfragmented, shouldNotTraceIfHotPathTracingIsDisabled)
+{
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  const auto msgs{ createMonitoringFrameMsgsForScanRound(2, 6) };
+  util::Barrier monitoring_frame_barrier;
+  EXPECT_CALLBACK_WILL_OPEN_BARRIER(user_callbacks_, msgs, monitoring_frame_barrier);
+
+  hw_mock_->sendMonitoringFrames(msgs);
+
+  monitoring_frame_barrier.waitTillRelease(2s);
+
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+
+  EXPECT_EQ(0u, driver_->hotPathTracer().histogram(util::HotPathTracer::Stage::deserialization).count());
+}
+
+TEST_F(ScannerAPITests, shouldPassScansToScanClockIfScannerClockTimestampsAreEnabled)
+{
+  config_.reset(new ScannerConfiguration(ScannerConfigurationBuilder(SCANNER_IP_ADDRESS)
+                                             .hostIP(HOST_IP_ADDRESS)
+                                             .hostDataPort(port_holder_.data_port_host)
+                                             .hostControlPort(port_holder_.control_port_host)
+                                             .scannerDataPort(port_holder_.data_port_scanner)
+                                             .scannerControlPort(port_holder_.control_port_scanner)
+                                             .scanRange(DEFAULT_SCAN_RANGE)
+                                             .scanResolution(DEFAULT_SCAN_RESOLUTION)
+                                             .enableIntensities()
+                                             .enableScannerClockTimestamps(true)));
+  setUpScannerV2Driver();
+  setUpScannerHwMock();
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  const auto msgs{ createMonitoringFrameMsgsForScanRound(2, 6) };
+  util::Barrier monitoring_frame_barrier;
+  // The model needs several scans, so the timestamp of the first scan is the same as without scanner clock.
+  EXPECT_CALLBACK_WILL_OPEN_BARRIER(user_callbacks_, msgs, monitoring_frame_barrier);
+
+  hw_mock_->sendMonitoringFrames(msgs);
+
+  monitoring_frame_barrier.waitTillRelease(2s);
+
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+
+  const auto statistics{ driver_->scanClockStatistics() };
+  EXPECT_EQ(1u, statistics.num_scans);
+  EXPECT_EQ(0u, statistics.num_estimated_scans);
+}
+
+TEST_F(ScannerAPITestsUnfragmented, shouldNotUseScanClockByDefault)
+{
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  const auto msgs{ createMonitoringFrameMsgsForScanRound(2, 6) };
+  util::Barrier monitoring_frame_barrier;
+  EXPECT_CALLBACK_WILL_OPEN_BARRIER(user_callbacks_, msgs, monitoring_frame_barrier);
+
+  hw_mock_->sendMonitoringFrames(msgs);
+
+  monitoring_frame_barrier.waitTillRelease(2s);
+
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+
+  EXPECT_EQ(0u, driver_->scanClockStatistics().num_scans);
+}
+
+TEST_F(ScannerAPITests, shouldPassScansOfSubscriberToItsOwnCallback)
+{
+  config_.reset(new ScannerConfiguration(
+      ScannerConfigurationBuilder(generateScannerConfig(HOST_IP_ADDRESS, UNFRAGMENTED_SCAN))
+          .addSubscriber(configuration::ScannerId::subscriber0, DEFAULT_SCAN_RANGE, DEFAULT_SCAN_RESOLUTION)));
+  driver_.reset(new ScannerV2(
+      *config_,
+      std::bind(&UserCallbacks::LaserScanCallback, &user_callbacks_, std::placeholders::_1),
+      { { configuration::ScannerId::subscriber0,
+          std::bind(&UserCallbacks::SubscriberLaserScanCallback, &user_callbacks_, std::placeholders::_1) } }));
+  setUpScannerHwMock();
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  const auto master_msgs{ createMonitoringFrameMsgsForScanRound(2, 6) };
+  const auto subscriber_msgs{ createMonitoringFrameMsgsForScanRound(7, 6, configuration::ScannerId::subscriber0) };
+  util::Barrier master_barrier;
+  util::Barrier subscriber_barrier;
+  EXPECT_CALL(user_callbacks_,
+              LaserScanCallback(AllOf(ScanDataEqual(createReferenceScan(master_msgs, 0)),
+                                      Property(&LaserScan::scannerId, configuration::ScannerId::master))))
+      .WillOnce(OpenBarrier(&master_barrier));
+  EXPECT_CALL(user_callbacks_,
+              SubscriberLaserScanCallback(
+                  AllOf(ScanDataEqual(createReferenceScan(subscriber_msgs, 0)),
+                        Property(&LaserScan::scannerId, configuration::ScannerId::subscriber0))))
+      .WillOnce(OpenBarrier(&subscriber_barrier));
+
+  // The frames of the master and the subscriber arrive interleaved.
+  for (std::size_t i = 0; i < master_msgs.size(); ++i)
+  {
+    hw_mock_->sendMonitoringFrame(master_msgs[i]);
+    hw_mock_->sendMonitoringFrame(subscriber_msgs[i]);
+  }
+
+  master_barrier.waitTillRelease(2s);
+  subscriber_barrier.waitTillRelease(2s);
+
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+}
+
+TEST_F(ScannerAPITests, shouldPassScansOfSubscriberWithoutOwnCallbackToLaserScanCallback)
+{
+  config_.reset(new ScannerConfiguration(
+      ScannerConfigurationBuilder(generateScannerConfig(HOST_IP_ADDRESS, UNFRAGMENTED_SCAN))
+          .addSubscriber(configuration::ScannerId::subscriber2, DEFAULT_SCAN_RANGE, DEFAULT_SCAN_RESOLUTION)));
+  setUpScannerV2Driver();
+  setUpScannerHwMock();
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  const auto subscriber_msgs{ createMonitoringFrameMsgsForScanRound(2, 6, configuration::ScannerId::subscriber2) };
+  util::Barrier subscriber_barrier;
+  EXPECT_CALL(user_callbacks_,
+              LaserScanCallback(AllOf(ScanDataEqual(createReferenceScan(subscriber_msgs, 0)),
+                                      Property(&LaserScan::scannerId, configuration::ScannerId::subscriber2))))
+      .WillOnce(OpenBarrier(&subscriber_barrier));
+
+  hw_mock_->sendMonitoringFrames(subscriber_msgs);
+
+  subscriber_barrier.waitTillRelease(2s);
+
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+}
+
+TEST_F(ScannerAPITestsUnfragmented, shouldDropFramesOfSubscriberWhichIsNotEnabled)
+{
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  const auto master_msgs{ createMonitoringFrameMsgsForScanRound(2, 6) };
+  util::Barrier monitoring_frame_barrier;
+  EXPECT_CALL(user_callbacks_, LaserScanCallback(Property(&LaserScan::scannerId, configuration::ScannerId::master)))
+      .WillOnce(OpenBarrier(&monitoring_frame_barrier));
+
+  hw_mock_->sendMonitoringFrames(createMonitoringFrameMsgsForScanRound(2, 6, configuration::ScannerId::subscriber1));
+  hw_mock_->sendMonitoringFrames(master_msgs);
+
+  monitoring_frame_barrier.waitTillRelease(2s);
+
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+}
+
+TEST_F(ScannerAPITests, shouldThrowIfSubscriberCallbackIsGivenForDeviceWhichIsNotEnabled)
+{
+  setUpScannerConfig(HOST_IP_ADDRESS, UNFRAGMENTED_SCAN);
+  const auto callback{ std::bind(
+      &UserCallbacks::SubscriberLaserScanCallback, &user_callbacks_, std::placeholders::_1) };
+  EXPECT_THROW(ScannerV2(*config_, callback, { { configuration::ScannerId::subscriber0, callback } }),
+               std::invalid_argument);
+  EXPECT_THROW(ScannerV2(*config_, callback, { { configuration::ScannerId::master, callback } }),
+               std::invalid_argument);
+}
+
+TEST_F(ScannerAPITests, shouldRecordAllMonitoringFramesIfRecordingIsEnabled)
+{
+  config_.reset(new ScannerConfiguration(ScannerConfigurationBuilder(SCANNER_IP_ADDRESS)
+                                             .hostIP(HOST_IP_ADDRESS)
+                                             .hostDataPort(port_holder_.data_port_host)
+                                             .hostControlPort(port_holder_.control_port_host)
+                                             .scannerDataPort(port_holder_.data_port_scanner)
+                                             .scannerControlPort(port_holder_.control_port_scanner)
+                                             .scanRange(DEFAULT_SCAN_RANGE)
+                                             .scanResolution(DEFAULT_SCAN_RESOLUTION)
+                                             .enableIntensities()
+                                             .recordMonitoringFrames("integrationtest_scanner_api")));
+  setUpScannerV2Driver();
+  setUpScannerHwMock();
+  ASSERT_NE(nullptr, driver_->frameRecorder());
+  const std::string file_path{ data_conversion_layer::frame_recording::fileName(
+      driver_->frameRecorder()->recordingPrefix(), 0) };
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  const auto msgs{ createMonitoringFrameMsgsForScanRound(2, 6) };
+  util::Barrier monitoring_frame_barrier;
+  EXPECT_CALLBACK_WILL_OPEN_BARRIER(user_callbacks_, msgs, monitoring_frame_barrier);
+
+  hw_mock_->sendMonitoringFrames(msgs);
+
+  monitoring_frame_barrier.waitTillRelease(2s);
+
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+  driver_.reset();
+
+  data_conversion_layer::frame_recording::Reader reader(file_path);
+  data_conversion_layer::frame_recording::Record record;
+  for (const auto& msg : msgs)
+  {
+    ASSERT_TRUE(reader.read(record));
+    EXPECT_EQ(data_conversion_layer::monitoring_frame::serialize(msg), record.data);
+    EXPECT_GT(record.timestamp, 0);
+  }
+  EXPECT_FALSE(reader.read(record));
+  std::remove(file_path.c_str());
+}
+
+TEST_F(ScannerAPITestsUnfragmented, shouldNotRecordMonitoringFramesByDefault)
+{
+  EXPECT_EQ(nullptr, driver_->frameRecorder());
+}
+
+TEST_F(ScannerAPITests, shouldPublishScansToSharedMemoryIfEnabled)
+{
+  config_.reset(new ScannerConfiguration(ScannerConfigurationBuilder(SCANNER_IP_ADDRESS)
+                                             .hostIP(HOST_IP_ADDRESS)
+                                             .hostDataPort(port_holder_.data_port_host)
+                                             .hostControlPort(port_holder_.control_port_host)
+                                             .scannerDataPort(port_holder_.data_port_scanner)
+                                             .scannerControlPort(port_holder_.control_port_scanner)
+                                             .scanRange(DEFAULT_SCAN_RANGE)
+                                             .scanResolution(DEFAULT_SCAN_RESOLUTION)
+                                             .enableIntensities()
+                                             .publishScansToSharedMemory("integrationtest_scanner_api")));
+  setUpScannerV2Driver();
+  setUpScannerHwMock();
+  ASSERT_NE(nullptr, driver_->scanRingPublisher());
+  communication_layer::ScanRingReader reader("integrationtest_scanner_api");
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  const auto msgs{ createMonitoringFrameMsgsForScanRound(2, 6) };
+  util::Barrier monitoring_frame_barrier;
+  EXPECT_CALLBACK_WILL_OPEN_BARRIER(user_callbacks_, msgs, monitoring_frame_barrier);
+
+  hw_mock_->sendMonitoringFrames(msgs);
+
+  monitoring_frame_barrier.waitTillRelease(2s);
+
+  const auto scan{ reader.readNext() };
+  ASSERT_TRUE(scan);
+  EXPECT_THAT(*scan, ScanDataEqual(createReferenceScan(msgs, 0)));
+  EXPECT_FALSE(reader.readNext());
+
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+}
+
+TEST_F(ScannerAPITestsUnfragmented, shouldNotPublishScansToSharedMemoryByDefault)
+{
+  EXPECT_EQ(nullptr, driver_->scanRingPublisher());
+}
+
 TEST_F(ScannerAPITestsUnfragmented, shouldShowOneUserMsgIfFirstTwoScanRoundsStartEarly)
 {
   INJECT_LOG_MOCK
@@ -687,6 +1141,201 @@ TEST_F(ScannerAPITestsUnfragmented, shouldIgnoreMonitoringFrameOfFormerScanRound
   REMOVE_LOG_MOCK
 }
 
+TEST_F(ScannerAPITestsUnfragmented, shouldProvideLatestScanAlongsideLaserScanCallback)
+{
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+  EXPECT_FALSE(driver_->tryGetLatestScan());
+
+  const auto msgs{ createMonitoringFrameMsgsForScanRound(2, 6) };
+  util::Barrier monitoring_frame_barrier;
+  EXPECT_CALLBACK_WILL_OPEN_BARRIER(user_callbacks_, msgs, monitoring_frame_barrier);
+  hw_mock_->sendMonitoringFrames(msgs);
+  monitoring_frame_barrier.waitTillRelease(2s);
+
+  const auto scan{ driver_->tryGetLatestScan() };
+  ASSERT_TRUE(scan);
+  EXPECT_THAT(*scan, ScanDataEqual(createReferenceScan(msgs, 0)));
+  EXPECT_FALSE(driver_->tryGetLatestScan()) << "Scan was returned twice";
+
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+}
+
+TEST_F(ScannerAPITestsUnfragmented, shouldNotKeepLatestScanBeforePullApiIsUsed)
+{
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  const auto msgs{ createMonitoringFrameMsgsForScanRound(2, 6) };
+  util::Barrier monitoring_frame_barrier;
+  EXPECT_CALLBACK_WILL_OPEN_BARRIER(user_callbacks_, msgs, monitoring_frame_barrier);
+  hw_mock_->sendMonitoringFrames(msgs);
+  monitoring_frame_barrier.waitTillRelease(2s);
+
+  EXPECT_FALSE(driver_->tryGetLatestScan());
+
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+}
+
+TEST_F(ScannerAPITests, waitForNextScanShouldReturnScanOfScannerWithoutLaserScanCallback)
+{
+  setUpScannerConfig(HOST_IP_ADDRESS, UNFRAGMENTED_SCAN);
+  driver_.reset(new ScannerV2(*config_));
+  setUpScannerHwMock();
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+  EXPECT_FALSE(driver_->waitForNextScan(10ms));
+
+  const auto msgs{ createMonitoringFrameMsgsForScanRound(2, 6) };
+  auto next_scan{ std::async(std::launch::async, [this]() { return driver_->waitForNextScan(2s); }) };
+  hw_mock_->sendMonitoringFrames(msgs);
+
+  ASSERT_EQ(next_scan.wait_for(2s), std::future_status::ready);
+  const auto scan{ next_scan.get() };
+  ASSERT_TRUE(scan);
+  EXPECT_THAT(*scan, ScanDataEqual(createReferenceScan(msgs, 0)));
+
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+}
+
+TEST_F(ScannerAPITests, shouldPassFilteredScansToUser)
+{
+  setUpScannerConfig(HOST_IP_ADDRESS, UNFRAGMENTED_SCAN);
+  const RangeFilter range_filter(0., 2.);
+  config_.reset(new ScannerConfiguration(ScannerConfigurationBuilder(*config_).addScanFilter(range_filter)));
+  driver_.reset(new ScannerV2(*config_));
+  setUpScannerHwMock();
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  const auto msgs{ createMonitoringFrameMsgsForScanRound(2, 6) };
+  hw_mock_->sendMonitoringFrames(msgs);
+  const auto scan{ driver_->waitForNextScan(2s) };
+  ASSERT_TRUE(scan);
+
+  LaserScan expected_scan{ createReferenceScan(msgs, 0) };
+  RangeFilter(range_filter).apply(expected_scan);
+  ASSERT_NE(createReferenceScan(msgs, 0).measurements(), expected_scan.measurements()) << "Nothing was filtered";
+  EXPECT_THAT(*scan, ScanDataEqual(expected_scan));
+  EXPECT_EQ(1u, driver_->scanFilterChain().histogram(0).count());
+
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+}
+
+TEST_F(ScannerAPITestsUnfragmented, shouldRestartWithNewScanSettingsViaSameConnectionOnReconfigure)
+{
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  const auto msgs_before{ createMonitoringFrameMsgsForScanRound(2, 6) };
+  util::Barrier scan_before_barrier;
+  EXPECT_CALLBACK_WILL_OPEN_BARRIER(user_callbacks_, msgs_before, scan_before_barrier);
+  hw_mock_->sendMonitoringFrames(msgs_before);
+  scan_before_barrier.waitTillRelease(2s);
+
+  const ScannerConfiguration new_config{
+    ScannerConfigurationBuilder(*config_)
+        .scanRange(ScanRange{ util::TenthOfDegree(10), util::TenthOfDegree(50) })
+        .scanResolution(util::TenthOfDegree(2))
+  };
+  util::Barrier stop_req_barrier;
+  util::Barrier start_req_barrier;
+  {
+    InSequence seq;
+    EXPECT_STOP_REQUEST_CALL(*hw_mock_).WillOnce(OpenBarrier(&stop_req_barrier));
+    EXPECT_START_REQUEST_CALL(*hw_mock_, new_config).WillOnce(OpenBarrier(&start_req_barrier));
+  }
+
+  std::future<void> reconfigure_future;
+  EXPECT_NO_BLOCK_NO_THROW(reconfigure_future = driver_->reconfigure(new_config););
+  EXPECT_TRUE(reconfigure_future.valid());
+  stop_req_barrier.waitTillRelease(2s);
+  // Frames still arriving with the old settings are ignored.
+  hw_mock_->sendMonitoringFrames(createMonitoringFrameMsgsForScanRound(3, 6));
+  hw_mock_->sendStopReply();
+  start_req_barrier.waitTillRelease(2s);
+  EXPECT_FUTURE_TIMEOUT(reconfigure_future, FUTURE_WAIT_TIMEOUT) << "Scanner::reconfigure() finished without start";
+  hw_mock_->sendStartReply();
+  EXPECT_FUTURE_IS_READY(reconfigure_future, 2s) << "Scanner::reconfigure() not finished";
+  EXPECT_FALSE(driver_->lastReconfigurationGap());
+
+  const auto msgs_after{ createMonitoringFrameMsgsForScanRound(4, 6) };
+  util::Barrier scan_after_barrier;
+  EXPECT_CALLBACK_WILL_OPEN_BARRIER(user_callbacks_, msgs_after, scan_after_barrier);
+  hw_mock_->sendMonitoringFrames(msgs_after);
+  scan_after_barrier.waitTillRelease(2s);
+
+  const auto gap{ driver_->lastReconfigurationGap() };
+  ASSERT_TRUE(gap);
+  EXPECT_GT(gap->count(), 0);
+
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+}
+
+TEST_F(ScannerAPITestsDefaultSetUp, reconfigureShouldReturnFutureWithExceptionIfScannerIsNotRunning)
+{
+  std::future<void> reconfigure_future;
+  EXPECT_NO_BLOCK_NO_THROW(reconfigure_future = driver_->reconfigure(*config_););
+  EXPECT_THROW_AND_WHAT(
+      reconfigure_future.get(), std::runtime_error, "The scanner has to be running to be reconfigured.");
+}
+
+TEST_F(ScannerAPITestsDefaultSetUp, reconfigureShouldReturnFutureWithExceptionIfStopRequestRefused)
+{
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  util::Barrier stop_req_barrier;
+  EXPECT_STOP_REQUEST_CALL(*hw_mock_).WillOnce(OpenBarrier(&stop_req_barrier));
+  std::future<void> reconfigure_future = driver_->reconfigure(*config_);
+  stop_req_barrier.waitTillRelease(2s);
+  hw_mock_->sendStopReply(data_conversion_layer::scanner_reply::Message::OperationResult::refused);
+  EXPECT_THROW_AND_WHAT(reconfigure_future.get(), std::runtime_error, "Stop Request refused by device.");
+}
+
+TEST_F(ScannerAPITestsDefaultSetUp, shouldResendStopRequestOnReconfigureIfNoStopReplyIsSent)
+{
+  EXPECT_SCANNER_TO_START_SUCCESSFULLY(hw_mock_, driver_, config_);
+
+  INJECT_LOG_MOCK;
+  EXPECT_ANY_LOG().Times(AnyNumber());
+  util::Barrier error_msg_barrier;
+  EXPECT_LOG_SHORT(ERROR,
+                   "StateMachine: Timeout while waiting for the scanner to stop for the reconfiguration! Retrying... "
+                   "(Please check the ethernet connection or contact PILZ support if the error persists.)")
+      .Times(AtLeast(1))
+      .WillOnce(OpenBarrier(&error_msg_barrier));
+
+  util::Barrier resent_stop_req_barrier;
+  util::Barrier start_req_barrier;
+  {
+    InSequence seq;
+    EXPECT_STOP_REQUEST_CALL(*hw_mock_).Times(1);
+    EXPECT_STOP_REQUEST_CALL(*hw_mock_).WillOnce(OpenBarrier(&resent_stop_req_barrier)).WillRepeatedly(Return());
+    EXPECT_START_REQUEST_CALL(*hw_mock_, *config_).WillOnce(OpenBarrier(&start_req_barrier));
+  }
+
+  std::future<void> reconfigure_future{ driver_->reconfigure(*config_) };
+  // The reply to the first stop request is lost.
+  error_msg_barrier.waitTillRelease(2s);
+  resent_stop_req_barrier.waitTillRelease(2s);
+  hw_mock_->sendStopReply();
+  start_req_barrier.waitTillRelease(2s);
+  hw_mock_->sendStartReply();
+  EXPECT_FUTURE_IS_READY(reconfigure_future, 2s) << "Scanner::reconfigure() not finished";
+
+  EXPECT_SCANNER_TO_STOP_SUCCESSFULLY(hw_mock_, driver_);
+  REMOVE_LOG_MOCK
+}
+
+TEST_F(ScannerAPITestsDefaultSetUp, shouldThrowIfReconfigurationChangesMoreThanScanSettings)
+{
+  EXPECT_THROW(
+      driver_->reconfigure(ScannerConfigurationBuilder(*config_).hostDataPort(port_holder_.data_port_host + 1)),
+      std::invalid_argument);
+  EXPECT_THROW(driver_->reconfigure(ScannerConfigurationBuilder(*config_).enableHotPathTracing()),
+               std::invalid_argument);
+  EXPECT_THROW(driver_->reconfigure(
+                   ScannerConfigurationBuilder(*config_).publishScansToSharedMemory("psen_scan_reconfigure_test", 4)),
+               std::invalid_argument);
+  EXPECT_THROW(driver_->reconfigure(ScannerConfigurationBuilder(*config_).addScanFilter(MedianFilter(3))),
+               std::invalid_argument);
+}
+
 }  // namespace psen_scan_v2_standalone_test
 
 int main(int argc, char* argv[])
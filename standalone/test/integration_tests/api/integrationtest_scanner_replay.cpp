@@ -0,0 +1,263 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Test frameworks
+#include "psen_scan_v2_standalone/communication_layer/mock_udp_server.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/monitoring_frame_serialization.h"
+#include "psen_scan_v2_standalone/util/integrationtest_helper.h"
+#include "psen_scan_v2_standalone/util/matchers_and_actions.h"
+
+// Software under testing
+#include "psen_scan_v2_standalone/communication_layer/frame_recorder.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/frame_recording.h"
+#include "psen_scan_v2_standalone/laserscan.h"
+#include "psen_scan_v2_standalone/scanner_config_builder.h"
+#include "psen_scan_v2_standalone/scanner_configuration.h"
+#include "psen_scan_v2_standalone/scanner_replay.h"
+
+namespace psen_scan_v2_standalone_test
+{
+using namespace psen_scan_v2_standalone;
+using namespace std::chrono_literals;
+
+static const std::string FILE_PREFIX{ "integrationtest_scanner_replay" };
+static constexpr std::size_t MAX_NUM_FILES{ 100 };
+
+struct RecordedRound
+{
+  std::vector<data_conversion_layer::monitoring_frame::Message> msgs;
+  int64_t timestamp;
+};
+
+static int64_t toNanoseconds(const std::chrono::nanoseconds& duration)
+{
+  return duration.count();
+}
+
+class ScannerReplayTests : public testing::Test
+{
+protected:
+  void TearDown() override
+  {
+    for (const auto& file_path : recordedFiles())
+    {
+      std::remove(file_path.c_str());
+    }
+  }
+
+  void record(const std::vector<RecordedRound>& rounds,
+              const std::size_t& max_file_size = std::numeric_limits<uint32_t>::max())
+  {
+    communication_layer::FrameRecorder recorder(FILE_PREFIX, max_file_size, MAX_NUM_FILES);
+    recording_prefix_ = recorder.recordingPrefix();
+    for (const auto& round : rounds)
+    {
+      for (const auto& msg : round.msgs)
+      {
+        const auto data{ data_conversion_layer::monitoring_frame::serialize(msg) };
+        recorder.record(data, data.size(), round.timestamp);
+      }
+    }
+  }
+
+  //! @returns all files of the last recording, which starts with the first file.
+  std::vector<std::string> recordedFiles() const
+  {
+    std::vector<std::string> file_paths;
+    for (std::size_t i = 0; i < MAX_NUM_FILES; ++i)
+    {
+      const auto file_path{ data_conversion_layer::frame_recording::fileName(recording_prefix_, i) };
+      if (!std::ifstream(file_path).good())
+      {
+        break;
+      }
+      file_paths.push_back(file_path);
+    }
+    return file_paths;
+  }
+
+  ReplayStatistics replay(const double& speed = REPLAY_AS_FAST_AS_POSSIBLE)
+  {
+    ScannerReplay scanner_replay(config_, [this](const LaserScan& scan) { scans_.push_back(scan); });
+    return scanner_replay.replay(recordedFiles(), speed);
+  }
+
+protected:
+  const ScannerConfiguration config_{ ScannerConfigurationBuilder("192.168.0.10")
+                                          .scanRange(DEFAULT_SCAN_RANGE)
+                                          .scanResolution(DEFAULT_SCAN_RESOLUTION) };
+  std::string recording_prefix_;
+  std::vector<LaserScan> scans_;
+};
+
+TEST_F(ScannerReplayTests, shouldCallLaserScanCallbackForEveryRecordedScanRoundWithRecordedTimestamp)
+{
+  std::vector<RecordedRound> rounds;
+  for (uint32_t i = 0; i < 3; ++i)
+  {
+    rounds.push_back({ createMonitoringFrameMsgsForScanRound(i + 1, 6), DEFAULT_TIMESTAMP + i * toNanoseconds(30ms) });
+  }
+  record(rounds);
+
+  const auto statistics{ replay() };
+
+  ASSERT_EQ(rounds.size(), scans_.size());
+  for (std::size_t i = 0; i < rounds.size(); ++i)
+  {
+    const LaserScan reference_scan{ createReferenceScan(rounds[i].msgs, rounds[i].timestamp) };
+    EXPECT_THAT(scans_[i], ScanDataEqual(reference_scan));
+    EXPECT_EQ(reference_scan.timestamp(), scans_[i].timestamp());
+  }
+  EXPECT_EQ(18u, statistics.num_frames);
+  EXPECT_EQ(3u, statistics.num_laser_scans);
+  EXPECT_EQ(0u, statistics.num_monitoring_frame_timeouts);
+  EXPECT_EQ(60ms, statistics.recorded_duration);
+}
+
+TEST_F(ScannerReplayTests, shouldTriggerMonitoringFrameTimeoutForEveryWatchdogTimeoutOfVirtualClock)
+{
+  record({ { createMonitoringFrameMsgsForScanRound(1, 6), DEFAULT_TIMESTAMP },
+           { createMonitoringFrameMsgsForScanRound(2, 6), DEFAULT_TIMESTAMP + toNanoseconds(2500ms) } });
+
+  const auto statistics{ replay() };
+
+  EXPECT_EQ(2u, statistics.num_monitoring_frame_timeouts);
+  EXPECT_EQ(2u, statistics.num_laser_scans);
+  EXPECT_LT(statistics.replay_duration, statistics.recorded_duration);
+}
+
+TEST_F(ScannerReplayTests, shouldKeepRecordedTimingWithOriginalSpeed)
+{
+  record({ { createMonitoringFrameMsgsForScanRound(1, 6), DEFAULT_TIMESTAMP },
+           { createMonitoringFrameMsgsForScanRound(2, 6), DEFAULT_TIMESTAMP + toNanoseconds(100ms) } });
+
+  const auto statistics{ replay(REPLAY_ORIGINAL_SPEED) };
+
+  EXPECT_EQ(2u, statistics.num_laser_scans);
+  EXPECT_GE(statistics.replay_duration, 100ms);
+}
+
+TEST_F(ScannerReplayTests, shouldScaleRecordedTimingWithSpeed)
+{
+  record({ { createMonitoringFrameMsgsForScanRound(1, 6), DEFAULT_TIMESTAMP },
+           { createMonitoringFrameMsgsForScanRound(2, 6), DEFAULT_TIMESTAMP + toNanoseconds(1000ms) } });
+
+  const auto statistics{ replay(10.) };
+
+  EXPECT_EQ(2u, statistics.num_laser_scans);
+  EXPECT_GE(statistics.replay_duration, 100ms);
+  EXPECT_LT(statistics.replay_duration, 1000ms);
+}
+
+TEST_F(ScannerReplayTests, shouldReplayAllFilesOfRotatedRecordingInOrder)
+{
+  std::vector<RecordedRound> rounds;
+  for (uint32_t i = 0; i < 3; ++i)
+  {
+    rounds.push_back({ createMonitoringFrameMsgsForScanRound(i + 1, 6), DEFAULT_TIMESTAMP + i * toNanoseconds(30ms) });
+  }
+  record(rounds, 1u);  // Every frame is written into its own file.
+  ASSERT_EQ(18u, recordedFiles().size());
+
+  const auto statistics{ replay() };
+
+  EXPECT_EQ(18u, statistics.num_frames);
+  ASSERT_EQ(rounds.size(), scans_.size());
+  for (std::size_t i = 0; i < rounds.size(); ++i)
+  {
+    EXPECT_EQ(i + 1, scans_[i].scanCounter());
+  }
+}
+
+TEST_F(ScannerReplayTests, shouldNotSendRequestsToScannerPorts)
+{
+  static constexpr unsigned short SCANNER_PORT{ 45000 };
+  std::atomic_int num_requests{ 0 };
+  MockUDPServer scanner(SCANNER_PORT, [&num_requests](const udp::endpoint&, const data_conversion_layer::RawData&) {
+    ++num_requests;
+  });
+  scanner.asyncReceive(MockUDPServer::ReceiveMode::continuous);
+  record({ { createMonitoringFrameMsgsForScanRound(1, 6), DEFAULT_TIMESTAMP } });
+
+  ScannerReplay scanner_replay(ScannerConfigurationBuilder(config_)
+                                   .scannerIp(MOCK_IP_ADDRESS)
+                                   .scannerControlPort(SCANNER_PORT)
+                                   .scannerDataPort(SCANNER_PORT),
+                               [](const LaserScan&) {});
+  EXPECT_EQ(1u, scanner_replay.replay(recordedFiles(), REPLAY_AS_FAST_AS_POSSIBLE).num_laser_scans);
+
+  std::this_thread::sleep_for(100ms);
+  EXPECT_EQ(0, num_requests);
+}
+
+TEST_F(ScannerReplayTests, shouldReplayNothingWithoutFiles)
+{
+  ScannerReplay scanner_replay(config_, [this](const LaserScan& scan) { scans_.push_back(scan); });
+  const auto statistics{ scanner_replay.replay({}) };
+  EXPECT_EQ(0u, statistics.num_frames);
+  EXPECT_TRUE(scans_.empty());
+}
+
+TEST_F(ScannerReplayTests, shouldBeAbleToReplayMultipleTimes)
+{
+  record({ { createMonitoringFrameMsgsForScanRound(1, 6), DEFAULT_TIMESTAMP } });
+
+  replay();
+  replay();
+
+  EXPECT_EQ(2u, scans_.size());
+}
+
+TEST_F(ScannerReplayTests, shouldThrowIfSpeedIsNotPositive)
+{
+  record({ { createMonitoringFrameMsgsForScanRound(1, 6), DEFAULT_TIMESTAMP } });
+  EXPECT_THROW(replay(0.), std::invalid_argument);
+  EXPECT_THROW(replay(-1.), std::invalid_argument);
+  EXPECT_TRUE(scans_.empty());
+}
+
+TEST_F(ScannerReplayTests, shouldThrowIfFileIsNoRecording)
+{
+  ScannerReplay scanner_replay(config_, [this](const LaserScan& scan) { scans_.push_back(scan); });
+  EXPECT_THROW(scanner_replay.replay({ "not_existing.psenrec" }), data_conversion_layer::frame_recording::ReadError);
+}
+
+TEST_F(ScannerReplayTests, shouldThrowWhenConstructedWithInvalidLaserScanCallback)
+{
+  EXPECT_THROW(ScannerReplay(config_, nullptr), std::invalid_argument);
+}
+
+}  // namespace psen_scan_v2_standalone_test
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleMock(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -56,7 +56,6 @@ void MockUDPServer::handleSend(const boost::system::error_code& error, std::size
   {
     std::cerr << "UDP server mock failed to send data. Error msg: " << error.message() << std::endl;
   }
-  std::cout << "MockUDPServer: Data successfully send" << std::endl;
 }
 
 void MockUDPServer::asyncSend(const udp::endpoint& receiver_of_data,
@@ -72,6 +71,17 @@ void MockUDPServer::asyncSend(const udp::endpoint& receiver_of_data,
   });
 }
 
+void MockUDPServer::send(const udp::endpoint& receiver_of_data,
+                         const psen_scan_v2_standalone::data_conversion_layer::RawData& data)
+{
+  boost::system::error_code error;
+  socket_.send_to(boost::asio::buffer(data.data(), data.size()), receiver_of_data, 0, error);
+  if (error)
+  {
+    std::cerr << "UDP server mock failed to send data. Error msg: " << error.message() << std::endl;
+  }
+}
+
 void MockUDPServer::handleReceive(const ReceiveMode& modi,
                                   const boost::system::error_code& error,
                                   std::size_t bytes_received)
@@ -0,0 +1,277 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "psen_scan_v2_standalone/laserscan.h"
+#include "psen_scan_v2_standalone/scan_deskewer.h"
+#include "psen_scan_v2_standalone/util/tenth_of_degree.h"
+
+namespace psen_scan_v2_standalone_test
+{
+using namespace psen_scan_v2_standalone;
+
+static constexpr int64_t TIMESTAMP{ 1000000000 };
+static constexpr double TOLERANCE{ 1e-6 };  // 1um
+
+static LaserScan createScan(const std::vector<double>& measurements,
+                            const util::TenthOfDegree& min_angle = util::TenthOfDegree(0),
+                            const util::TenthOfDegree& resolution = util::TenthOfDegree(10))
+{
+  LaserScan scan(resolution,
+                 min_angle,
+                 min_angle + resolution * static_cast<int>(measurements.empty() ? 0 : measurements.size() - 1),
+                 1 /*scan_counter*/,
+                 0 /*active_zoneset*/,
+                 TIMESTAMP);
+  scan.measurements(measurements);
+  return scan;
+}
+
+static Pose2D staticPose(const int64_t& /*timestamp*/)
+{
+  return Pose2D{ 1., 2., 0.5 };
+}
+
+//! Moves with 2m/s along its x axis while rotating with 1.5rad/s, starting at the pose (1, 2, 3) at TIMESTAMP.
+static Pose2D movingPose(const int64_t& timestamp)
+{
+  const double t{ static_cast<double>(timestamp - TIMESTAMP) * 1e-9 };
+  return Pose2D{ 1. + 2. * t, 2., 3. + 1.5 * t };
+}
+
+//! Transforms the point measured at the pose at the ray time into the frame of the pose at the reference time.
+static void expectPointNear(const Pose2D& reference, const Pose2D& pose, double angle, double range, double x, double y)
+{
+  const double world_x{ pose.x + range * std::cos(pose.theta + angle) };
+  const double world_y{ pose.y + range * std::sin(pose.theta + angle) };
+  const double dx{ world_x - reference.x };
+  const double dy{ world_y - reference.y };
+  EXPECT_NEAR(std::cos(reference.theta) * dx + std::sin(reference.theta) * dy, x, TOLERANCE);
+  EXPECT_NEAR(-std::sin(reference.theta) * dx + std::cos(reference.theta) * dy, y, TOLERANCE);
+}
+
+TEST(ScanDeskewerTest, shouldComputeTimeIncrementFromRotationPeriod)
+{
+  EXPECT_DOUBLE_EQ(30000000. / 3600., ScanDeskewer::timeIncrement(util::TenthOfDegree(1)));
+  const auto scan{ createScan(std::vector<double>(3601, 1.), util::TenthOfDegree(0), util::TenthOfDegree(1)) };
+  EXPECT_EQ(TIMESTAMP, ScanDeskewer::rayTimestamp(scan, 0));
+  EXPECT_EQ(TIMESTAMP + 15000000, ScanDeskewer::rayTimestamp(scan, 1800));
+  EXPECT_EQ(TIMESTAMP + 30000000, ScanDeskewer::rayTimestamp(scan, 3600));
+}
+
+TEST(ScanDeskewerTest, shouldReturnPolarCoordinatesAsPointsForStaticScanner)
+{
+  ScanDeskewer deskewer;
+  const auto result{ deskewer.deskew(createScan({ 1., 2., 3. }, util::TenthOfDegree(900)), staticPose) };
+
+  EXPECT_EQ(TIMESTAMP, result.timestamp);
+  ASSERT_EQ(3u, result.x.size());
+  ASSERT_EQ(3u, result.y.size());
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    const double angle{ util::TenthOfDegree(static_cast<int16_t>(900 + 10 * i)).toRad() };
+    EXPECT_NEAR((i + 1.) * std::cos(angle), result.x[i], TOLERANCE);
+    EXPECT_NEAR((i + 1.) * std::sin(angle), result.y[i], TOLERANCE);
+  }
+}
+
+TEST(ScanDeskewerTest, shouldRotatePointsByXAxisRotation)
+{
+  ScanDeskewer deskewer(util::TenthOfDegree(900).toRad());
+  const auto result{ deskewer.deskew(createScan({ 2. }, util::TenthOfDegree(900)), staticPose) };
+  EXPECT_NEAR(2., result.x[0], TOLERANCE);
+  EXPECT_NEAR(0., result.y[0], TOLERANCE);
+}
+
+TEST(ScanDeskewerTest, shouldTransformEveryRayByThePoseAtItsTime)
+{
+  const std::size_t num_rays{ 2750 };
+  std::vector<double> measurements(num_rays);
+  for (std::size_t i = 0; i < num_rays; ++i)
+  {
+    measurements[i] = 1. + 0.01 * static_cast<double>(i % 300);
+  }
+  const util::TenthOfDegree min_angle{ 1 };
+  const util::TenthOfDegree resolution{ 1 };
+  const auto scan{ createScan(measurements, min_angle, resolution) };
+
+  ScanDeskewer deskewer;
+  const auto result{ deskewer.deskew(scan, movingPose) };
+
+  ASSERT_EQ(num_rays, result.x.size());
+  const Pose2D reference{ movingPose(TIMESTAMP) };
+  for (std::size_t i = 0; i < num_rays; ++i)
+  {
+    const double angle{ (min_angle + resolution * static_cast<int>(i)).toRad() };
+    expectPointNear(reference,
+                    movingPose(ScanDeskewer::rayTimestamp(scan, i)),
+                    angle,
+                    measurements[i],
+                    result.x[i],
+                    result.y[i]);
+  }
+}
+
+TEST(ScanDeskewerTest, shouldQueryPosesOnlyAtTheSamples)
+{
+  std::vector<int64_t> query_times;
+  const auto scan{ createScan(std::vector<double>(2750, 1.), util::TenthOfDegree(1), util::TenthOfDegree(1)) };
+
+  ScanDeskewer deskewer;
+  deskewer.deskew(scan, [&query_times](const int64_t& timestamp) {
+    query_times.push_back(timestamp);
+    return staticPose(timestamp);
+  });
+
+  ASSERT_EQ(DESKEW_NUM_POSE_SAMPLES, query_times.size());
+  EXPECT_EQ(TIMESTAMP, query_times.front());
+  EXPECT_EQ(ScanDeskewer::rayTimestamp(scan, 2749), query_times.back());
+}
+
+TEST(ScanDeskewerTest, shouldKeepPointsOfRaysWithoutSignalNotFinite)
+{
+  ScanDeskewer deskewer;
+  const auto scan{ createScan({ 1., std::numeric_limits<double>::infinity(), 1. }) };
+  const auto result{ deskewer.deskew(scan, movingPose) };
+  EXPECT_TRUE(std::isfinite(result.x[0]));
+  EXPECT_FALSE(std::isfinite(result.x[1]) && std::isfinite(result.y[1]));
+  EXPECT_TRUE(std::isfinite(result.x[2]));
+}
+
+TEST(ScanDeskewerTest, shouldHandleScansWithLessRaysThanPoseSamples)
+{
+  ScanDeskewer deskewer;
+  EXPECT_TRUE(deskewer.deskew(createScan({}), movingPose).x.empty());
+
+  const auto result{ deskewer.deskew(createScan({ 1., 2. }), movingPose) };
+  const Pose2D reference{ movingPose(TIMESTAMP) };
+  expectPointNear(reference, reference, 0., 1., result.x[0], result.y[0]);
+  expectPointNear(reference,
+                  movingPose(TIMESTAMP + static_cast<int64_t>(std::llround(ScanDeskewer::timeIncrement(util::TenthOfDegree(10))))),
+                  util::TenthOfDegree(10).toRad(),
+                  2.,
+                  result.x[1],
+                  result.y[1]);
+}
+
+TEST(ScanDeskewerTest, shouldReuseRayTablesOfKnownScanGeometries)
+{
+  ScanDeskewer deskewer;
+  DeskewedScan result;
+  deskewer.deskew(createScan({ 1., 2., 3. }), staticPose, result);
+  deskewer.deskew(createScan({ 3., 2., 1. }), staticPose, result);
+  EXPECT_EQ(1u, deskewer.cacheSize());
+
+  deskewer.deskew(createScan({ 1., 2., 3. }, util::TenthOfDegree(30)), staticPose, result);
+  EXPECT_EQ(2u, deskewer.cacheSize());
+  EXPECT_NEAR(std::cos(util::TenthOfDegree(30).toRad()), result.x[0], TOLERANCE);
+}
+
+TEST(ScanDeskewerTest, shouldDeskewWithPoseBuffer)
+{
+  PoseBuffer poses;
+  for (int64_t t = TIMESTAMP - 20000000; t <= TIMESTAMP + 20000000; t += 10000000)
+  {
+    poses.add(t, movingPose(t));
+  }
+  const auto scan{ createScan(std::vector<double>(2750, 2.), util::TenthOfDegree(1), util::TenthOfDegree(1)) };
+
+  ScanDeskewer deskewer;
+  const auto expected{ deskewer.deskew(scan, movingPose) };
+  const auto result{ deskewer.deskew(scan, poses) };
+  for (std::size_t i = 0; i < scan.measurements().size(); ++i)
+  {
+    EXPECT_NEAR(expected.x[i], result.x[i], TOLERANCE);
+    EXPECT_NEAR(expected.y[i], result.y[i], TOLERANCE);
+  }
+}
+
+TEST(PoseBufferTest, shouldThrowOnInvalidCapacity)
+{
+  EXPECT_THROW(PoseBuffer(1), std::invalid_argument);
+}
+
+TEST(PoseBufferTest, shouldInterpolateLinearly)
+{
+  PoseBuffer poses;
+  poses.add(100, Pose2D{ 0., 0., 0. });
+  poses.add(200, Pose2D{ 1., -2., 1. });
+
+  const auto pose{ poses.interpolate(125) };
+  EXPECT_DOUBLE_EQ(0.25, pose.x);
+  EXPECT_DOUBLE_EQ(-0.5, pose.y);
+  EXPECT_DOUBLE_EQ(0.25, pose.theta);
+  EXPECT_DOUBLE_EQ(1., poses.interpolate(200).x);
+}
+
+TEST(PoseBufferTest, shouldInterpolateOrientationOverShortestArc)
+{
+  PoseBuffer poses;
+  poses.add(100, Pose2D{ 0., 0., 3. });
+  poses.add(200, Pose2D{ 0., 0., -3. });
+  const double expected{ 3. + (2. * M_PI - 6.) / 2. - 2. * M_PI };
+  EXPECT_NEAR(expected, poses.interpolate(150).theta, TOLERANCE);
+}
+
+TEST(PoseBufferTest, shouldExtrapolateUpToMaxExtrapolation)
+{
+  PoseBuffer poses(10, 50);
+  poses.add(100, Pose2D{ 0., 0., 0. });
+  poses.add(200, Pose2D{ 1., 0., 0. });
+  EXPECT_DOUBLE_EQ(1.5, poses.interpolate(250).x);
+  EXPECT_THROW(poses.interpolate(251), std::out_of_range);
+  EXPECT_THROW(poses.interpolate(99), std::out_of_range);
+}
+
+TEST(PoseBufferTest, shouldThrowIfLessThanTwoPoses)
+{
+  PoseBuffer poses;
+  EXPECT_THROW(poses.interpolate(100), std::out_of_range);
+  poses.add(100, Pose2D{});
+  EXPECT_THROW(poses.interpolate(100), std::out_of_range);
+}
+
+TEST(PoseBufferTest, shouldThrowIfPoseIsNotNewer)
+{
+  PoseBuffer poses;
+  poses.add(100, Pose2D{});
+  EXPECT_THROW(poses.add(100, Pose2D{}), std::invalid_argument);
+}
+
+TEST(PoseBufferTest, shouldDropOldestPoseIfFull)
+{
+  PoseBuffer poses(2);
+  poses.add(100, Pose2D{});
+  poses.add(200, Pose2D{});
+  poses.add(300, Pose2D{});
+  EXPECT_EQ(2u, poses.size());
+  EXPECT_THROW(poses.interpolate(150), std::out_of_range);
+  EXPECT_NO_THROW(poses.interpolate(250));
+}
+
+}  // namespace psen_scan_v2_standalone_test
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,191 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "psen_scan_v2_standalone/laserscan.h"
+#include "psen_scan_v2_standalone/scan_filter.h"
+#include "psen_scan_v2_standalone/util/tenth_of_degree.h"
+
+namespace psen_scan_v2_standalone_test
+{
+using namespace psen_scan_v2_standalone;
+
+static constexpr double INF{ std::numeric_limits<double>::infinity() };
+
+static LaserScan createScan(const std::vector<double>& measurements, const std::vector<double>& intensities = {})
+{
+  const util::TenthOfDegree resolution(10);
+  LaserScan scan(resolution,
+                 util::TenthOfDegree(0),
+                 resolution * static_cast<int>(measurements.empty() ? 0 : measurements.size() - 1),
+                 1 /*scan_counter*/,
+                 0 /*active_zoneset*/,
+                 1000000000 /*timestamp*/);
+  scan.measurements(measurements);
+  scan.intensities(intensities);
+  return scan;
+}
+
+static LaserScan::MeasurementData filter(ScanFilter&& scan_filter, LaserScan scan)
+{
+  scan_filter.apply(scan);
+  return scan.measurements();
+}
+
+class RecordingFilter : public ScanFilter
+{
+public:
+  RecordingFilter(const std::string& name, std::vector<std::string>& applied_filters)
+    : name_(name), applied_filters_(applied_filters)
+  {
+  }
+
+  std::string name() const override
+  {
+    return name_;
+  }
+
+  void apply(LaserScan& /*scan*/) override
+  {
+    applied_filters_.push_back(name_);
+  }
+
+  std::unique_ptr<ScanFilter> clone() const override
+  {
+    return std::unique_ptr<ScanFilter>(new RecordingFilter(*this));
+  }
+
+private:
+  std::string name_;
+  std::vector<std::string>& applied_filters_;
+};
+
+TEST(ScanFilterTest, rangeFilterShouldRemoveMeasurementsOutsideOfTheRange)
+{
+  EXPECT_EQ(LaserScan::MeasurementData({ INF, 0.1, 2., 5., INF, INF }),
+            filter(RangeFilter(0.1, 5.), createScan({ 0.05, 0.1, 2., 5., 5.5, INF })));
+}
+
+TEST(ScanFilterTest, rangeFilterShouldThrowWithInvalidRange)
+{
+  EXPECT_THROW(RangeFilter(-0.1, 5.), std::invalid_argument);
+  EXPECT_THROW(RangeFilter(5., 1.), std::invalid_argument);
+}
+
+TEST(ScanFilterTest, intensityFilterShouldRemoveMeasurementsWithLowIntensity)
+{
+  const LaserScan scan{ createScan({ 1., 2., 3. }, { 100., 2000., 1500. }) };
+  EXPECT_EQ(LaserScan::MeasurementData({ INF, 2., 3. }), filter(IntensityFilter(1500.), scan));
+  EXPECT_TRUE(IntensityFilter(1500.).requiresIntensities());
+  EXPECT_FALSE(RangeFilter(0., 1.).requiresIntensities());
+}
+
+TEST(ScanFilterTest, shadowFilterShouldRemoveVeilingPointsAtEdges)
+{
+  EXPECT_EQ(LaserScan::MeasurementData({ 2., 2., INF, INF, INF, 10., 10. }),
+            filter(ShadowFilter(0.17, 2.97), createScan({ 2., 2., 2., 6., 10., 10., 10. })));
+}
+
+TEST(ScanFilterTest, shadowFilterShouldKeepSurfacesAndIgnoreRaysWithoutSignal)
+{
+  const LaserScan::MeasurementData measurements({ 2., 2.01, 2.02, INF, 2.02, 2.01, 2. });
+  EXPECT_EQ(measurements, filter(ShadowFilter(0.17, 2.97), createScan(measurements)));
+}
+
+TEST(ScanFilterTest, shadowFilterShouldCheckAllNeighboursWithinTheWindow)
+{
+  // The edge is only detected if the neighbours behind the ray without signal are checked, too.
+  const LaserScan scan{ createScan({ 2., 2., INF, 6., 6. }) };
+  EXPECT_EQ(scan.measurements(), filter(ShadowFilter(0.17, 2.97, 1), scan));
+  EXPECT_EQ(LaserScan::MeasurementData({ 2., INF, INF, INF, 6. }), filter(ShadowFilter(0.17, 2.97, 2), scan));
+}
+
+TEST(ScanFilterTest, shadowFilterShouldThrowWithInvalidParameters)
+{
+  EXPECT_THROW(ShadowFilter(0., 2.), std::invalid_argument);
+  EXPECT_THROW(ShadowFilter(2., 1.), std::invalid_argument);
+  EXPECT_THROW(ShadowFilter(0.1, 3.2), std::invalid_argument);
+  EXPECT_THROW(ShadowFilter(0.1, 3., 0), std::invalid_argument);
+}
+
+TEST(ScanFilterTest, medianFilterShouldRemoveSpikesAndKeepBorders)
+{
+  EXPECT_EQ(LaserScan::MeasurementData({ 5., 1., 1., 1., 1., 1., 9. }),
+            filter(MedianFilter(3), createScan({ 5., 1., 1., 4., 1., 1., 9. })));
+  EXPECT_EQ(LaserScan::MeasurementData({ 2., 2., INF, INF, INF }),
+            filter(MedianFilter(3), createScan({ 2., INF, 2., INF, INF })));
+}
+
+TEST(ScanFilterTest, medianFilterShouldUseWholeWindow)
+{
+  EXPECT_EQ(LaserScan::MeasurementData({ 1., 2., 4., 4., 5., 5., 7. }),
+            filter(MedianFilter(5), createScan({ 1., 2., 9., 4., 5., 0., 7. })));
+}
+
+TEST(ScanFilterTest, medianFilterShouldThrowWithInvalidWindow)
+{
+  EXPECT_THROW(MedianFilter(1), std::invalid_argument);
+  EXPECT_THROW(MedianFilter(4), std::invalid_argument);
+}
+
+TEST(ScanFilterChainTest, shouldApplyFiltersInOrder)
+{
+  std::vector<std::string> applied_filters;
+  ScanFilterChain chain({ std::make_shared<RecordingFilter>("first", applied_filters),
+                          std::make_shared<RecordingFilter>("second", applied_filters) });
+  LaserScan scan{ createScan({ 1. }) };
+  chain.apply(scan);
+  EXPECT_EQ(std::vector<std::string>({ "first", "second" }), applied_filters);
+}
+
+TEST(ScanFilterChainTest, shouldRecordDurationOfEveryFilter)
+{
+  ScanFilterChain chain({ std::make_shared<RangeFilter>(0., 3.), std::make_shared<MedianFilter>(3) });
+  LaserScan scan{ createScan({ 1., 2., 3. }) };
+  chain.apply(scan);
+  chain.apply(scan);
+
+  ASSERT_EQ(2u, chain.size());
+  EXPECT_EQ("range", chain.name(0));
+  EXPECT_EQ("median", chain.name(1));
+  EXPECT_EQ(2u, chain.histogram(0).count());
+  EXPECT_EQ(2u, chain.histogram(1).count());
+  EXPECT_THROW(chain.histogram(2), std::out_of_range);
+  EXPECT_NE(std::string::npos, chain.formatSummary().find("1 median"));
+}
+
+TEST(ScanFilterChainTest, shouldNotChangeScanWithoutFilters)
+{
+  ScanFilterChain chain;
+  LaserScan scan{ createScan({ 1., INF, 3. }) };
+  chain.apply(scan);
+  EXPECT_TRUE(chain.empty());
+  EXPECT_EQ(LaserScan::MeasurementData({ 1., INF, 3. }), scan.measurements());
+}
+
+}  // namespace psen_scan_v2_standalone_test
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,165 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "psen_scan_v2_standalone/configuration/zoneset.h"
+#include "psen_scan_v2_standalone/configuration/zoneset_configuration.h"
+#include "psen_scan_v2_standalone/laserscan.h"
+#include "psen_scan_v2_standalone/util/tenth_of_degree.h"
+#include "psen_scan_v2_standalone/zone_intrusion_monitor.h"
+
+namespace psen_scan_v2_standalone_test
+{
+using namespace psen_scan_v2_standalone;
+
+static configuration::ZoneSetConfiguration createZoneSetConfiguration()
+{
+  configuration::ZoneSet zoneset;
+  zoneset.resolution_ = util::TenthOfDegree(10);
+  zoneset.safety1_ = { 1000, 1000, 2000, 2000 };
+  zoneset.warn1_ = { 3000, 0, 3000, 3000 };
+
+  configuration::ZoneSet other_zoneset;
+  other_zoneset.resolution_ = util::TenthOfDegree(10);
+  other_zoneset.safety1_ = { 500, 500, 500, 500 };
+
+  configuration::ZoneSetConfiguration config;
+  config.zonesets_ = { zoneset, other_zoneset };
+  return config;
+}
+
+static LaserScan createScan(const std::vector<double>& measurements,
+                            uint8_t active_zoneset = 0,
+                            const util::TenthOfDegree& min_angle = util::TenthOfDegree(0),
+                            const util::TenthOfDegree& resolution = util::TenthOfDegree(10))
+{
+  LaserScan scan(resolution,
+                 min_angle,
+                 min_angle + resolution * static_cast<int>(measurements.size() - 1),
+                 1 /*scan_counter*/,
+                 active_zoneset,
+                 0 /*timestamp*/);
+  scan.measurements(measurements);
+  return scan;
+}
+
+TEST(ZoneIntrusionMonitorTest, shouldReportIntrudedBeamsInMask)
+{
+  ZoneIntrusionMonitor monitor(createZoneSetConfiguration());
+  const auto result{ monitor.check(createScan({ 0.5, 1.5, 1.5, 2.5 })) };
+
+  const auto& safety1{ result.field(ZoneField::safety1) };
+  EXPECT_TRUE(safety1.configured());
+  EXPECT_TRUE(safety1.intruded());
+  EXPECT_EQ(safety1.numIntrusions(), 2u);
+  EXPECT_EQ(safety1.intrusionMask(), std::vector<uint8_t>({ 1, 0, 1, 0 }));
+  EXPECT_DOUBLE_EQ(safety1.minMargin(), -0.5);
+  EXPECT_TRUE(result.intruded());
+}
+
+TEST(ZoneIntrusionMonitorTest, shouldReportPositiveMarginWithoutIntrusion)
+{
+  ZoneIntrusionMonitor monitor(createZoneSetConfiguration());
+  const auto result{ monitor.check(createScan({ 1.2, 1.5, 2.1, 2.5 })) };
+
+  const auto& safety1{ result.field(ZoneField::safety1) };
+  EXPECT_FALSE(safety1.intruded());
+  EXPECT_NEAR(safety1.minMargin(), 0.1, 1e-9);
+}
+
+TEST(ZoneIntrusionMonitorTest, shouldNotReportIntrusionsForUnconfiguredField)
+{
+  ZoneIntrusionMonitor monitor(createZoneSetConfiguration());
+  const auto result{ monitor.check(createScan({ 0.1, 0.1, 0.1, 0.1 })) };
+
+  const auto& safety2{ result.field(ZoneField::safety2) };
+  EXPECT_FALSE(safety2.configured());
+  EXPECT_FALSE(safety2.intruded());
+  EXPECT_EQ(safety2.minMargin(), std::numeric_limits<double>::infinity());
+}
+
+TEST(ZoneIntrusionMonitorTest, shouldNotReportIntrusionWhereFieldRadiusIsZero)
+{
+  ZoneIntrusionMonitor monitor(createZoneSetConfiguration());
+  const auto result{ monitor.check(createScan({ 4., 0.1, 4., 4. })) };
+
+  EXPECT_FALSE(result.field(ZoneField::warn1).intruded());
+}
+
+TEST(ZoneIntrusionMonitorTest, shouldNotReportIntrusionForInfiniteMeasurement)
+{
+  ZoneIntrusionMonitor monitor(createZoneSetConfiguration());
+  const double inf{ std::numeric_limits<double>::infinity() };
+  const auto result{ monitor.check(createScan({ inf, inf, inf, inf })) };
+
+  EXPECT_FALSE(result.intruded());
+}
+
+TEST(ZoneIntrusionMonitorTest, shouldInterpolateFieldOntoFinerScanGrid)
+{
+  ZoneIntrusionMonitor monitor(createZoneSetConfiguration());
+  // Beams at 1.0, 1.5 and 2.0 degree; field radius 1 m, 1.5 m and 2 m
+  const auto result{ monitor.check(createScan({ 1.1, 1.4, 2.1 }, 0, util::TenthOfDegree(10), util::TenthOfDegree(5))) };
+
+  EXPECT_EQ(result.field(ZoneField::safety1).intrusionMask(), std::vector<uint8_t>({ 0, 1, 0 }));
+}
+
+TEST(ZoneIntrusionMonitorTest, shouldNotCoverBeamsOutsideOfFieldDefinition)
+{
+  ZoneIntrusionMonitor monitor(createZoneSetConfiguration());
+  const auto result{ monitor.check(createScan({ 0.1, 0.1 }, 0, util::TenthOfDegree(30))) };
+
+  EXPECT_EQ(result.field(ZoneField::safety1).intrusionMask(), std::vector<uint8_t>({ 1, 0 }));
+}
+
+TEST(ZoneIntrusionMonitorTest, shouldUseActiveZoneSetOfScan)
+{
+  ZoneIntrusionMonitor monitor(createZoneSetConfiguration());
+  const auto result{ monitor.check(createScan({ 0.6, 0.6, 0.6, 0.6 }, 1)) };
+
+  EXPECT_FALSE(result.field(ZoneField::safety1).intruded());
+  EXPECT_NEAR(result.field(ZoneField::safety1).minMargin(), 0.1, 1e-9);
+}
+
+TEST(ZoneIntrusionMonitorTest, shouldResampleOnlyOncePerZoneSetAndScanGrid)
+{
+  ZoneIntrusionMonitor monitor(createZoneSetConfiguration());
+  ZoneSetIntrusion result;
+  monitor.check(createScan({ 1., 1., 1., 1. }), result);
+  monitor.check(createScan({ 2., 2., 2., 2. }), result);
+  EXPECT_EQ(monitor.cacheSize(), 1u);
+
+  monitor.check(createScan({ 1., 1., 1., 1. }, 1), result);
+  monitor.check(createScan({ 1., 1. }, 0, util::TenthOfDegree(10)), result);
+  EXPECT_EQ(monitor.cacheSize(), 3u);
+}
+
+TEST(ZoneIntrusionMonitorTest, shouldThrowIfActiveZoneSetIsNotConfigured)
+{
+  ZoneIntrusionMonitor monitor(createZoneSetConfiguration());
+  EXPECT_THROW(monitor.check(createScan({ 1. }, 2)), ZoneSetNotConfigured);
+}
+
+}  // namespace psen_scan_v2_standalone_test
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,248 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+#include <gtest/gtest.h>
+
+#include "psen_scan_v2_standalone/communication_layer/frame_recorder.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/frame_recording.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/raw_scanner_data.h"
+
+using namespace psen_scan_v2_standalone::communication_layer;
+using namespace psen_scan_v2_standalone::data_conversion_layer;
+
+namespace psen_scan_v2_standalone_test
+{
+static const std::string FILE_PREFIX{ "unittest_frame_recorder" };
+static constexpr std::size_t DATAGRAM_SIZE{ 100 };
+static constexpr std::size_t RECORD_SIZE{ frame_recording::RECORD_HEADER_SIZE + DATAGRAM_SIZE };
+static constexpr std::size_t MAX_NUM_FILES{ 100 };
+
+static RawData createDatagram(const char& value)
+{
+  return RawData(DATAGRAM_SIZE, value);
+}
+
+static bool fileExists(const std::string& file_path)
+{
+  return std::ifstream(file_path).good();
+}
+
+static std::vector<frame_recording::Record> readRecords(const std::string& file_path)
+{
+  std::vector<frame_recording::Record> records;
+  frame_recording::Reader reader(file_path);
+  frame_recording::Record record;
+  while (reader.read(record))
+  {
+    records.push_back(record);
+  }
+  return records;
+}
+
+class FrameRecorderTest : public testing::Test
+{
+protected:
+  void TearDown() override
+  {
+    for (std::size_t i = 0; i < MAX_NUM_FILES; ++i)
+    {
+      std::remove(frame_recording::fileName(recording_prefix_, i).c_str());
+    }
+  }
+
+  std::unique_ptr<FrameRecorder> createRecorder(const std::size_t& max_file_size,
+                                                const std::size_t& max_num_files = MAX_NUM_FILES,
+                                                const std::size_t& buffer_size = DEFAULT_FRAME_RECORDER_BUFFER_SIZE)
+  {
+    std::unique_ptr<FrameRecorder> recorder{ new FrameRecorder(
+        FILE_PREFIX, max_file_size, max_num_files, buffer_size) };
+    recording_prefix_ = recorder->recordingPrefix();
+    return recorder;
+  }
+
+  std::string recording_prefix_;
+};
+
+TEST_F(FrameRecorderTest, shouldThrowOnZeroSizes)
+{
+  EXPECT_THROW(FrameRecorder(FILE_PREFIX, 0, 1), std::invalid_argument);
+  EXPECT_THROW(FrameRecorder(FILE_PREFIX, 1000, 0), std::invalid_argument);
+  EXPECT_THROW(FrameRecorder(FILE_PREFIX, 1000, 1, 0), std::invalid_argument);
+}
+
+TEST_F(FrameRecorderTest, shouldThrowIfFileCannotBeCreated)
+{
+  EXPECT_THROW(FrameRecorder("/not_existing_directory/recording", 1000, 1), std::runtime_error);
+}
+
+TEST_F(FrameRecorderTest, shouldExtendFilePrefixByStartTime)
+{
+  const auto recorder{ createRecorder(1000) };
+  EXPECT_EQ(0u, recorder->recordingPrefix().find(FILE_PREFIX + "_"));
+  EXPECT_GT(recorder->recordingPrefix().size(), FILE_PREFIX.size() + 1);
+  EXPECT_TRUE(fileExists(frame_recording::fileName(recorder->recordingPrefix(), 0)));
+}
+
+TEST_F(FrameRecorderTest, shouldRecordDatagramsWithTimestamps)
+{
+  {
+    const auto recorder{ createRecorder(1024 * 1024) };
+    recorder->record(createDatagram('a'), DATAGRAM_SIZE, 1000);
+    recorder->record(createDatagram('b'), DATAGRAM_SIZE / 2, 2000);
+  }
+
+  const auto records{ readRecords(frame_recording::fileName(recording_prefix_, 0)) };
+  ASSERT_EQ(2u, records.size());
+  EXPECT_EQ(1000, records[0].timestamp);
+  EXPECT_EQ(createDatagram('a'), records[0].data);
+  EXPECT_EQ(2000, records[1].timestamp);
+  EXPECT_EQ(RawData(DATAGRAM_SIZE / 2, 'b'), records[1].data);
+}
+
+TEST_F(FrameRecorderTest, shouldWriteDatagramsWhileRecording)
+{
+  const auto recorder{ createRecorder(1024 * 1024) };
+  recorder->record(createDatagram('a'), DATAGRAM_SIZE, 1000);
+
+  const auto timeout{ std::chrono::steady_clock::now() + std::chrono::seconds(5) };
+  while (recorder->numRecordedFrames() == 0 && std::chrono::steady_clock::now() < timeout)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_EQ(1u, recorder->numRecordedFrames());
+  EXPECT_EQ(1u, readRecords(frame_recording::fileName(recording_prefix_, 0)).size());
+}
+
+TEST_F(FrameRecorderTest, shouldRotateFilesAndDeleteOldestFile)
+{
+  {
+    const auto recorder{ createRecorder(frame_recording::FILE_HEADER_SIZE + 2 * RECORD_SIZE, 2) };
+    for (int64_t i = 0; i < 5; ++i)
+    {
+      recorder->record(createDatagram('a'), DATAGRAM_SIZE, i);
+    }
+  }
+
+  EXPECT_FALSE(fileExists(frame_recording::fileName(recording_prefix_, 0)));
+  const auto second_file{ readRecords(frame_recording::fileName(recording_prefix_, 1)) };
+  ASSERT_EQ(2u, second_file.size());
+  EXPECT_EQ(2, second_file[0].timestamp);
+  EXPECT_EQ(3, second_file[1].timestamp);
+  const auto third_file{ readRecords(frame_recording::fileName(recording_prefix_, 2)) };
+  ASSERT_EQ(1u, third_file.size());
+  EXPECT_EQ(4, third_file[0].timestamp);
+}
+
+TEST_F(FrameRecorderTest, shouldWriteDatagramsLargerThanMaxFileSizeIntoOwnFile)
+{
+  {
+    const auto recorder{ createRecorder(RECORD_SIZE / 2) };
+    recorder->record(createDatagram('a'), DATAGRAM_SIZE, 0);
+    recorder->record(createDatagram('b'), DATAGRAM_SIZE, 1);
+  }
+  EXPECT_EQ(1u, readRecords(frame_recording::fileName(recording_prefix_, 0)).size());
+  EXPECT_EQ(1u, readRecords(frame_recording::fileName(recording_prefix_, 1)).size());
+}
+
+TEST_F(FrameRecorderTest, shouldDropDatagramsNotFittingIntoBuffer)
+{
+  {
+    const auto recorder{ createRecorder(1024 * 1024, MAX_NUM_FILES, RECORD_SIZE / 2) };
+    recorder->record(createDatagram('a'), DATAGRAM_SIZE, 0);
+    EXPECT_EQ(1u, recorder->numDroppedFrames());
+  }
+  EXPECT_TRUE(readRecords(frame_recording::fileName(recording_prefix_, 0)).empty());
+}
+
+TEST_F(FrameRecorderTest, shouldDropDatagramsWithInvalidSize)
+{
+  const auto recorder{ createRecorder(1024 * 1024) };
+  recorder->record(createDatagram('a'), DATAGRAM_SIZE + 1, 0);
+  EXPECT_EQ(1u, recorder->numDroppedFrames());
+}
+
+TEST_F(FrameRecorderTest, shouldRecordDatagramsWrappingAroundBufferEnd)
+{
+  static constexpr std::size_t NUM_DATAGRAMS{ 20 };
+  {
+    // Waits for every datagram to be written, so that the next one fits in the buffer with a different offset.
+    const auto recorder{ createRecorder(1024 * 1024, MAX_NUM_FILES, RECORD_SIZE + 7) };
+    for (std::size_t i = 0; i < NUM_DATAGRAMS; ++i)
+    {
+      recorder->record(createDatagram(static_cast<char>('a' + i)), DATAGRAM_SIZE, static_cast<int64_t>(i));
+      const auto timeout{ std::chrono::steady_clock::now() + std::chrono::seconds(5) };
+      while (recorder->numRecordedFrames() <= i && std::chrono::steady_clock::now() < timeout)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    }
+    EXPECT_EQ(0u, recorder->numDroppedFrames());
+  }
+
+  const auto records{ readRecords(frame_recording::fileName(recording_prefix_, 0)) };
+  ASSERT_EQ(NUM_DATAGRAMS, records.size());
+  for (std::size_t i = 0; i < NUM_DATAGRAMS; ++i)
+  {
+    EXPECT_EQ(static_cast<int64_t>(i), records[i].timestamp);
+    EXPECT_EQ(createDatagram(static_cast<char>('a' + i)), records[i].data);
+  }
+}
+
+#ifdef __linux__
+TEST_F(FrameRecorderTest, shouldDropDatagramsAndStopRecordingIfFileCannotBeWritten)
+{
+  {
+    const auto recorder{ createRecorder(frame_recording::FILE_HEADER_SIZE + RECORD_SIZE) };
+    // Every write to the next file fails with "No space left on device"
+    ASSERT_EQ(0, symlink("/dev/full", frame_recording::fileName(recording_prefix_, 1).c_str()));
+    for (int64_t i = 0; i < 3; ++i)
+    {
+      recorder->record(createDatagram('a'), DATAGRAM_SIZE, i);
+    }
+    const auto timeout{ std::chrono::steady_clock::now() + std::chrono::seconds(5) };
+    while (recorder->numRecordedFrames() + recorder->numDroppedFrames() < 3 &&
+           std::chrono::steady_clock::now() < timeout)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(1u, recorder->numRecordedFrames());
+    EXPECT_EQ(2u, recorder->numDroppedFrames());
+  }
+  EXPECT_EQ(1u, readRecords(frame_recording::fileName(recording_prefix_, 0)).size());
+  EXPECT_FALSE(fileExists(frame_recording::fileName(recording_prefix_, 2)));
+}
+#endif
+
+}  // namespace psen_scan_v2_standalone_test
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,301 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/interprocess/shared_memory_object.hpp>
+
+#include <gtest/gtest.h>
+
+#include "psen_scan_v2_standalone/communication_layer/scan_ring.h"
+#include "psen_scan_v2_standalone/communication_layer/scan_ring_publisher.h"
+#include "psen_scan_v2_standalone/communication_layer/scan_ring_reader.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/io_pin_data.h"
+#include "psen_scan_v2_standalone/io_state.h"
+#include "psen_scan_v2_standalone/laserscan.h"
+#include "psen_scan_v2_standalone/util/tenth_of_degree.h"
+
+using namespace psen_scan_v2_standalone;
+using namespace psen_scan_v2_standalone::communication_layer;
+
+namespace psen_scan_v2_standalone_test
+{
+static const std::string SHM_NAME{ "unittest_scan_ring" };
+static constexpr std::size_t NUM_SLOTS{ 4 };
+
+//! All distances and intensities of the scan are derived from the scan counter to detect inconsistent copies.
+static LaserScan createScan(const uint32_t& scan_counter, const std::size_t& num_measurements = 10)
+{
+  LaserScan scan(util::TenthOfDegree(1), util::TenthOfDegree(10), util::TenthOfDegree(20), scan_counter,
+                 static_cast<uint8_t>(scan_counter % 8), 1000 * static_cast<int64_t>(scan_counter));
+  scan.measurements(LaserScan::MeasurementData(num_measurements, scan_counter / 1000.));
+  scan.intensities(LaserScan::IntensityData(num_measurements, static_cast<double>(scan_counter)));
+  data_conversion_layer::monitoring_frame::io::PinData pin_data;
+  pin_data.input_state.at(2) = static_cast<uint8_t>(scan_counter);
+  pin_data.output_state.at(1) = 0b101;
+  scan.ioStates({ IOState(pin_data, scan.timestamp()), IOState(pin_data, scan.timestamp() + 1) });
+  return scan;
+}
+
+static void expectScanEqual(const LaserScan& expected, const LaserScan& actual)
+{
+  EXPECT_EQ(expected.scanResolution(), actual.scanResolution());
+  EXPECT_EQ(expected.minScanAngle(), actual.minScanAngle());
+  EXPECT_EQ(expected.maxScanAngle(), actual.maxScanAngle());
+  EXPECT_EQ(expected.scanCounter(), actual.scanCounter());
+  EXPECT_EQ(expected.activeZoneset(), actual.activeZoneset());
+  EXPECT_EQ(expected.timestamp(), actual.timestamp());
+  EXPECT_EQ(expected.measurements(), actual.measurements());
+  EXPECT_EQ(expected.intensities(), actual.intensities());
+  ASSERT_EQ(expected.ioStates().size(), actual.ioStates().size());
+  for (std::size_t i = 0; i < expected.ioStates().size(); ++i)
+  {
+    EXPECT_EQ(expected.ioStates()[i], actual.ioStates()[i]);
+    EXPECT_EQ(expected.ioStates()[i].timestamp(), actual.ioStates()[i].timestamp());
+  }
+}
+
+static void expectScanCounter(const boost::optional<LaserScan>& scan, const uint32_t& scan_counter)
+{
+  ASSERT_TRUE(scan);
+  EXPECT_EQ(scan_counter, scan->scanCounter());
+}
+
+TEST(ScanRingTest, shouldReadPublishedScanIdentically)
+{
+  ScanRingPublisher publisher(SHM_NAME, NUM_SLOTS);
+  ScanRingReader reader(SHM_NAME);
+
+  auto scan{ createScan(42) };
+  scan.intensities({});
+  ASSERT_TRUE(publisher.publish(scan));
+  EXPECT_EQ(1u, publisher.numPublishedScans());
+
+  const auto read_scan{ reader.readNext() };
+  ASSERT_TRUE(read_scan);
+  expectScanEqual(scan, *read_scan);
+  EXPECT_FALSE(reader.readNext());
+}
+
+TEST(ScanRingTest, shouldReadNothingBeforeScansArePublished)
+{
+  ScanRingPublisher publisher(SHM_NAME, NUM_SLOTS);
+  ScanRingReader reader(SHM_NAME);
+  EXPECT_FALSE(reader.readLatest());
+  EXPECT_FALSE(reader.readNext());
+}
+
+TEST(ScanRingTest, shouldReadLatestScan)
+{
+  ScanRingPublisher publisher(SHM_NAME, NUM_SLOTS);
+  for (uint32_t i = 0; i < 10; ++i)
+  {
+    publisher.publish(createScan(i));
+  }
+
+  ScanRingReader reader(SHM_NAME);
+  expectScanCounter(reader.readLatest(), 9);
+  publisher.publish(createScan(10));
+  expectScanCounter(reader.readLatest(), 10);
+}
+
+TEST(ScanRingTest, shouldReadNextScansInPublishOrderStartingAfterCreationOfReader)
+{
+  ScanRingPublisher publisher(SHM_NAME, NUM_SLOTS);
+  publisher.publish(createScan(0));
+  ScanRingReader reader(SHM_NAME);
+
+  publisher.publish(createScan(1));
+  publisher.publish(createScan(2));
+  expectScanCounter(reader.readNext(), 1);
+  expectScanCounter(reader.readNext(), 2);
+  EXPECT_FALSE(reader.readNext());
+  EXPECT_EQ(0u, reader.numMissedScans());
+}
+
+TEST(ScanRingTest, shouldSkipAndCountOverwrittenScans)
+{
+  ScanRingPublisher publisher(SHM_NAME, NUM_SLOTS);
+  ScanRingReader reader(SHM_NAME);
+  for (uint32_t i = 0; i < 10; ++i)
+  {
+    publisher.publish(createScan(i));
+  }
+
+  for (uint32_t i = 10 - NUM_SLOTS; i < 10; ++i)
+  {
+    expectScanCounter(reader.readNext(), i);
+  }
+  EXPECT_FALSE(reader.readNext());
+  EXPECT_EQ(10u - NUM_SLOTS, reader.numMissedScans());
+}
+
+TEST(ScanRingTest, shouldSupportMultipleReaders)
+{
+  ScanRingPublisher publisher(SHM_NAME, NUM_SLOTS);
+  ScanRingReader first_reader(SHM_NAME);
+  ScanRingReader second_reader(SHM_NAME);
+  publisher.publish(createScan(1));
+
+  expectScanCounter(first_reader.readNext(), 1);
+  expectScanCounter(second_reader.readNext(), 1);
+}
+
+TEST(ScanRingTest, shouldRejectScansExceedingTheCapacityOfASlot)
+{
+  ScanRingPublisher publisher(SHM_NAME, NUM_SLOTS, 10, 2);
+  ScanRingReader reader(SHM_NAME);
+
+  EXPECT_FALSE(publisher.publish(createScan(1, 11)));
+  auto scan_with_many_io_states{ createScan(2) };
+  scan_with_many_io_states.ioStates(LaserScan::IOData(3));
+  EXPECT_FALSE(publisher.publish(scan_with_many_io_states));
+  EXPECT_TRUE(publisher.publish(createScan(3)));
+
+  EXPECT_EQ(1u, publisher.numPublishedScans());
+  EXPECT_EQ(2u, publisher.numRejectedScans());
+  expectScanCounter(reader.readNext(), 3);
+}
+
+TEST(ScanRingTest, shouldInformReaderAboutClosedPublisher)
+{
+  std::unique_ptr<ScanRingPublisher> publisher(new ScanRingPublisher(SHM_NAME, NUM_SLOTS));
+  ScanRingReader reader(SHM_NAME);
+  publisher->publish(createScan(1));
+  EXPECT_FALSE(reader.publisherClosed());
+
+  publisher.reset();
+  EXPECT_TRUE(reader.publisherClosed());
+  expectScanCounter(reader.readNext(), 1);
+  EXPECT_THROW(ScanRingReader{ SHM_NAME }, std::runtime_error);
+}
+
+TEST(ScanRingTest, shouldGiveUpReadingScanWhichIsStillWrittenByDeadPublisher)
+{
+  ScanRingPublisher publisher(SHM_NAME, NUM_SLOTS);
+  ScanRingReader reader(SHM_NAME);
+  publisher.publish(createScan(1));
+
+  // Leaves the slot of the published scan in the state of a publisher which died while writing it
+  boost::interprocess::shared_memory_object shm(
+      boost::interprocess::open_only, SHM_NAME.c_str(), boost::interprocess::read_write);
+  boost::interprocess::mapped_region region(shm, boost::interprocess::read_write);
+  char* segment{ static_cast<char*>(region.get_address()) };
+  const scan_ring::Slot<char> slot(segment, *reinterpret_cast<const scan_ring::Header*>(segment), 0);
+  slot.header->sequence.fetch_add(1);
+
+  EXPECT_FALSE(reader.readLatest());
+  EXPECT_FALSE(reader.readNext());
+  EXPECT_EQ(1u, reader.numMissedScans());
+}
+
+TEST(ScanRingTest, shouldWaitForScanWhichIsWrittenBySuspendedPublisher)
+{
+  ScanRingPublisher publisher(SHM_NAME, NUM_SLOTS);
+  ScanRingReader reader(SHM_NAME);
+  const auto scan{ createScan(1) };
+  publisher.publish(scan);
+
+  // Leaves the slot of the published scan in the state of a publisher which is suspended while writing it
+  boost::interprocess::shared_memory_object shm(
+      boost::interprocess::open_only, SHM_NAME.c_str(), boost::interprocess::read_write);
+  boost::interprocess::mapped_region region(shm, boost::interprocess::read_write);
+  char* segment{ static_cast<char*>(region.get_address()) };
+  const scan_ring::Slot<char> slot(segment, *reinterpret_cast<const scan_ring::Header*>(segment), 0);
+  slot.header->sequence.fetch_add(1);
+  std::thread resumed_publisher([&slot]() {
+    std::this_thread::sleep_for(MAX_SCAN_RING_WRITE_DURATION / 2);
+    slot.header->sequence.fetch_sub(1);
+  });
+
+  const auto read_scan{ reader.readNext() };
+  resumed_publisher.join();
+  ASSERT_TRUE(read_scan);
+  expectScanEqual(scan, *read_scan);
+  EXPECT_EQ(0u, reader.numMissedScans());
+}
+
+TEST(ScanRingTest, shouldReplaceStaleSharedMemoryObject)
+{
+  ScanRingPublisher stale_publisher(SHM_NAME, NUM_SLOTS);
+  stale_publisher.publish(createScan(1));
+
+  ScanRingPublisher publisher(SHM_NAME, NUM_SLOTS);
+  ScanRingReader reader(SHM_NAME);
+  EXPECT_FALSE(reader.readLatest());
+}
+
+TEST(ScanRingTest, shouldThrowRuntimeErrorIfSharedMemoryObjectDoesNotExist)
+{
+  EXPECT_THROW(ScanRingReader{ "unittest_scan_ring_non_existing" }, std::runtime_error);
+}
+
+TEST(ScanRingTest, shouldThrowInvalidArgumentForInvalidParameters)
+{
+  EXPECT_THROW(ScanRingPublisher(""), std::invalid_argument);
+  EXPECT_THROW(ScanRingPublisher(SHM_NAME, 0), std::invalid_argument);
+  EXPECT_THROW(ScanRingPublisher(SHM_NAME, NUM_SLOTS, 0), std::invalid_argument);
+  EXPECT_THROW(ScanRingPublisher(SHM_NAME, NUM_SLOTS, 10, 0), std::invalid_argument);
+}
+
+TEST(ScanRingTest, shouldOnlyReadConsistentScansWhilePublishing)
+{
+  static constexpr uint32_t NUM_SCANS{ 20000 };
+  static constexpr std::size_t NUM_MEASUREMENTS{ 2750 };
+  ScanRingPublisher publisher(SHM_NAME, 2);
+  ScanRingReader reader(SHM_NAME);
+
+  std::thread publishing_thread([&publisher]() {
+    for (uint32_t i = 1; i <= NUM_SCANS; ++i)
+    {
+      publisher.publish(createScan(i, NUM_MEASUREMENTS));
+    }
+  });
+
+  uint32_t last_scan_counter{ 0 };
+  uint64_t num_read_scans{ 0 };
+  // Ends once every scan was either read or missed, e.g. if reading the last one was given up.
+  while (num_read_scans + reader.numMissedScans() < NUM_SCANS)
+  {
+    const auto scan{ reader.readNext() };
+    if (!scan)
+    {
+      continue;
+    }
+    ++num_read_scans;
+    if (scan->scanCounter() <= last_scan_counter)
+    {
+      ADD_FAILURE() << "Scan " << scan->scanCounter() << " read after scan " << last_scan_counter;
+      break;
+    }
+    last_scan_counter = scan->scanCounter();
+    expectScanEqual(createScan(last_scan_counter, NUM_MEASUREMENTS), *scan);
+  }
+  publishing_thread.join();
+
+  EXPECT_EQ(NUM_SCANS, num_read_scans + reader.numMissedScans());
+}
+
+}  // namespace psen_scan_v2_standalone_test
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -28,6 +28,7 @@
 #include "psen_scan_v2_standalone/scanner_configuration.h"
 #include "psen_scan_v2_standalone/scanner_config_builder.h"
 #include "psen_scan_v2_standalone/scan_range.h"
+#include "psen_scan_v2_standalone/scan_filter.h"
 
 using namespace psen_scan_v2_standalone;
 
@@ -295,6 +296,191 @@ TEST_F(ScannerConfigurationTest, shouldLoadIntensitiesFromConfigByDefault)
   EXPECT_EQ(configuration::INTENSITIES, sc.intensitiesEnabled());
 }
 
+TEST_F(ScannerConfigurationTest, shouldHaveEnabledHotPathTracingAfterConstruction)
+{
+  const ScannerConfiguration sc{ ScannerConfigurationBuilder(VALID_IP).scanRange(SCAN_RANGE).enableHotPathTracing() };
+  EXPECT_TRUE(sc.hotPathTracingEnabled());
+}
+
+TEST_F(ScannerConfigurationTest, shouldLoadHotPathTracingFromConfigByDefault)
+{
+  const ScannerConfiguration sc{ createValidDefaultConfig() };
+  EXPECT_EQ(configuration::HOT_PATH_TRACING, sc.hotPathTracingEnabled());
+}
+
+TEST_F(ScannerConfigurationTest, shouldHaveEnabledScannerClockTimestampsAfterConstruction)
+{
+  const ScannerConfiguration sc{
+    ScannerConfigurationBuilder(VALID_IP).scanRange(SCAN_RANGE).enableScannerClockTimestamps()
+  };
+  EXPECT_TRUE(sc.scannerClockTimestampsEnabled());
+}
+
+TEST_F(ScannerConfigurationTest, shouldLoadScannerClockTimestampsFromConfigByDefault)
+{
+  const ScannerConfiguration sc{ createValidDefaultConfig() };
+  EXPECT_EQ(configuration::SCANNER_CLOCK_TIMESTAMPS, sc.scannerClockTimestampsEnabled());
+}
+
+TEST_F(ScannerConfigurationTest, shouldKeepParametersOfExistingConfigurationNotChangedByBuilder)
+{
+  const ScannerConfiguration sc{
+    ScannerConfigurationBuilder(createValidDefaultConfig()).hostDataPort(0).enableHotPathTracing()
+  };
+  const ScannerConfiguration reference_sc{ createValidDefaultConfig() };
+  EXPECT_EQ(0, sc.hostUDPPortData());
+  EXPECT_TRUE(sc.hotPathTracingEnabled());
+  EXPECT_EQ(reference_sc.clientIp(), sc.clientIp());
+  EXPECT_EQ(reference_sc.scanRange().start(), sc.scanRange().start());
+  EXPECT_EQ(reference_sc.scanResolution(), sc.scanResolution());
+  EXPECT_EQ(reference_sc.intensitiesEnabled(), sc.intensitiesEnabled());
+}
+
+TEST_F(ScannerConfigurationTest, shouldNotRecordMonitoringFramesByDefault)
+{
+  const ScannerConfiguration sc{ createValidDefaultConfig() };
+  EXPECT_FALSE(sc.frameRecordingPrefix());
+}
+
+TEST_F(ScannerConfigurationTest, shouldReturnSetFrameRecordingParameters)
+{
+  const ScannerConfiguration sc{
+    ScannerConfigurationBuilder(VALID_IP).scanRange(SCAN_RANGE).recordMonitoringFrames("/tmp/front", 1000u, 3u)
+  };
+  ASSERT_TRUE(sc.frameRecordingPrefix());
+  EXPECT_EQ("/tmp/front", sc.frameRecordingPrefix().get());
+  EXPECT_EQ(1000u, sc.frameRecordingMaxFileSize());
+  EXPECT_EQ(3u, sc.frameRecordingMaxNumFiles());
+}
+
+TEST_F(ScannerConfigurationTest, shouldUseDefaultFrameRecordingSizes)
+{
+  const ScannerConfiguration sc{
+    ScannerConfigurationBuilder(VALID_IP).scanRange(SCAN_RANGE).recordMonitoringFrames("/tmp/front")
+  };
+  EXPECT_EQ(configuration::FRAME_RECORDING_MAX_FILE_SIZE, sc.frameRecordingMaxFileSize());
+  EXPECT_EQ(configuration::FRAME_RECORDING_MAX_NUM_FILES, sc.frameRecordingMaxNumFiles());
+}
+
+TEST_F(ScannerConfigurationTest, shouldThrowInvalidArgumentWithInvalidFrameRecordingParameters)
+{
+  auto sb = ScannerConfigurationBuilder(VALID_IP).scanRange(SCAN_RANGE);
+  EXPECT_THROW(sb.recordMonitoringFrames(""), std::invalid_argument);
+  EXPECT_THROW(sb.recordMonitoringFrames("/tmp/front", 0u, 3u), std::invalid_argument);
+  EXPECT_THROW(sb.recordMonitoringFrames("/tmp/front", 1000u, 0u), std::invalid_argument);
+}
+
+TEST_F(ScannerConfigurationTest, shouldNotPublishScansToSharedMemoryByDefault)
+{
+  const ScannerConfiguration sc{ createValidDefaultConfig() };
+  EXPECT_FALSE(sc.scanRingName());
+}
+
+TEST_F(ScannerConfigurationTest, shouldReturnSetScanRingParameters)
+{
+  const ScannerConfiguration sc{
+    ScannerConfigurationBuilder(VALID_IP).scanRange(SCAN_RANGE).publishScansToSharedMemory("psen_scan_front", 5u)
+  };
+  ASSERT_TRUE(sc.scanRingName());
+  EXPECT_EQ("psen_scan_front", sc.scanRingName().get());
+  EXPECT_EQ(5u, sc.scanRingNumSlots());
+}
+
+TEST_F(ScannerConfigurationTest, shouldUseDefaultNumberOfScanRingSlots)
+{
+  const ScannerConfiguration sc{
+    ScannerConfigurationBuilder(VALID_IP).scanRange(SCAN_RANGE).publishScansToSharedMemory("psen_scan_front")
+  };
+  EXPECT_EQ(configuration::SCAN_RING_NUM_SLOTS, sc.scanRingNumSlots());
+}
+
+TEST_F(ScannerConfigurationTest, shouldThrowInvalidArgumentWithInvalidScanRingParameters)
+{
+  auto sb = ScannerConfigurationBuilder(VALID_IP).scanRange(SCAN_RANGE);
+  EXPECT_THROW(sb.publishScansToSharedMemory(""), std::invalid_argument);
+  EXPECT_THROW(sb.publishScansToSharedMemory("psen_scan_front", 0u), std::invalid_argument);
+}
+
+TEST_F(ScannerConfigurationTest, shouldNotFilterScansByDefault)
+{
+  const ScannerConfiguration sc{ createValidDefaultConfig() };
+  EXPECT_TRUE(sc.scanFilters().empty());
+}
+
+TEST_F(ScannerConfigurationTest, shouldReturnAddedScanFiltersInOrder)
+{
+  const ScannerConfiguration sc{
+    ScannerConfigurationBuilder(VALID_IP).scanRange(SCAN_RANGE).addScanFilter(MedianFilter(3)).addScanFilter(
+        RangeFilter(0.1, 5.))
+  };
+  ASSERT_EQ(2u, sc.scanFilters().size());
+  EXPECT_EQ("median", sc.scanFilters().at(0)->name());
+  EXPECT_EQ("range", sc.scanFilters().at(1)->name());
+}
+
+TEST_F(ScannerConfigurationTest, shouldThrowInvalidArgumentWithIntensityFilterAndDisabledIntensitiesOnBuild)
+{
+  auto sb = ScannerConfigurationBuilder(VALID_IP).scanRange(SCAN_RANGE).scanResolution(util::TenthOfDegree(2u));
+  sb.addScanFilter(IntensityFilter(100.));
+  EXPECT_NO_THROW(sb.enableIntensities(true).build());
+  EXPECT_THROW(sb.enableIntensities(false).build(), std::invalid_argument);
+}
+
+TEST_F(ScannerConfigurationTest, shouldOnlyEnableMasterDeviceByDefault)
+{
+  const ScannerConfiguration config{ createValidConfig() };
+  EXPECT_TRUE(config.subscribers().empty());
+  EXPECT_TRUE(config.deviceEnabled(configuration::ScannerId::master));
+  EXPECT_FALSE(config.deviceEnabled(configuration::ScannerId::subscriber0));
+}
+
+TEST_F(ScannerConfigurationTest, shouldReturnAddedSubscribersSortedById)
+{
+  const ScanRange subscriber_range{ util::TenthOfDegree(100), util::TenthOfDegree(1000) };
+  const ScannerConfiguration config =
+      ScannerConfigurationBuilder(VALID_IP)
+          .scanRange(SCAN_RANGE)
+          .addSubscriber(configuration::ScannerId::subscriber2, subscriber_range, SCAN_RESOLUTION)
+          .addSubscriber(configuration::ScannerId::subscriber0, subscriber_range);
+
+  ASSERT_EQ(2u, config.subscribers().size());
+  EXPECT_EQ(configuration::ScannerId::subscriber0, config.subscribers()[0].id);
+  EXPECT_EQ(subscriber_range.start(), config.subscribers()[0].scan_range.start());
+  EXPECT_EQ(subscriber_range.end(), config.subscribers()[0].scan_range.end());
+  EXPECT_EQ(data_conversion_layer::radToTenthDegree(configuration::DEFAULT_SCAN_ANGLE_RESOLUTION),
+            config.subscribers()[0].scan_resolution.value());
+  EXPECT_EQ(configuration::ScannerId::subscriber2, config.subscribers()[1].id);
+  EXPECT_EQ(SCAN_RESOLUTION, config.subscribers()[1].scan_resolution);
+
+  EXPECT_TRUE(config.deviceEnabled(configuration::ScannerId::subscriber0));
+  EXPECT_FALSE(config.deviceEnabled(configuration::ScannerId::subscriber1));
+  EXPECT_TRUE(config.deviceEnabled(configuration::ScannerId::subscriber2));
+}
+
+TEST_F(ScannerConfigurationTest, shouldThrowInvalidArgumentWithInvalidSubscriber)
+{
+  auto sb = ScannerConfigurationBuilder(VALID_IP)
+                .scanRange(SCAN_RANGE)
+                .addSubscriber(configuration::ScannerId::subscriber1, SCAN_RANGE, SCAN_RESOLUTION);
+  EXPECT_THROW(sb.addSubscriber(configuration::ScannerId::master, SCAN_RANGE, SCAN_RESOLUTION), std::invalid_argument);
+  EXPECT_THROW(sb.addSubscriber(configuration::ScannerId::subscriber1, SCAN_RANGE, SCAN_RESOLUTION),
+               std::invalid_argument);
+  EXPECT_THROW(sb.addSubscriber(configuration::ScannerId::subscriber0, SCAN_RANGE, util::TenthOfDegree{ 0u }),
+               std::invalid_argument);
+  EXPECT_THROW(sb.addSubscriber(configuration::ScannerId::subscriber0, SCAN_RANGE, util::TenthOfDegree{ 101u }),
+               std::invalid_argument);
+}
+
+TEST_F(ScannerConfigurationTest, shouldThrowInvalidArgumentWithLowSubscriberResolutionAndEnabledIntensitiesOnBuild)
+{
+  auto sb = ScannerConfigurationBuilder(VALID_IP)
+                .scanRange(SCAN_RANGE)
+                .enableIntensities()
+                .scanResolution(SCAN_RESOLUTION)
+                .addSubscriber(configuration::ScannerId::subscriber0, SCAN_RANGE, util::TenthOfDegree{ 1u });
+  EXPECT_THROW(sb.build(), std::invalid_argument);
+}
+
 TEST_F(ScannerConfigurationTest, shouldThrowInvalidArgumentWithLowResolutionAndEnabledIntensitiesOnBuild)
 {
   auto sb = ScannerConfigurationBuilder(VALID_IP)
@@ -12,6 +12,11 @@
 //
 // You should have received a copy of the GNU Lesser General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
@@ -82,6 +87,30 @@ TEST(XMLRoStringParsing, shouldThrowOnNonHexInput)
   EXPECT_THROW(ro_string_to_vec("YYYY"), XMLConfigurationParserException);
 }
 
+TEST(XMLRoStringParsing, shouldThrowOnNonHexCharacterInLaterValue)
+{
+  EXPECT_THROW(ro_string_to_vec("D307D30Y"), XMLConfigurationParserException);
+  EXPECT_THROW(ro_string_to_vec("D307 307"), XMLConfigurationParserException);
+}
+
+TEST(XMLRoStringParsing, shouldParseLowerCaseHex)
+{
+  EXPECT_THAT(ro_string_to_vec("d307ed03"), testing::ElementsAre(2003, 1005));
+}
+
+TEST(XMLRoStringParsing, shouldOnlyParseGivenNumberOfCharacters)
+{
+  const char* ro_string = "2B018913";
+  EXPECT_THAT(ro_string_to_vec(ro_string, 4), testing::ElementsAre(299));
+}
+
+TEST(XMLRoStringParsing, shouldConvertSingleValue)
+{
+  EXPECT_EQ(ro_value_to_uint("8913"), 5001ul);
+  EXPECT_EQ(ro_value_to_uint(std::string("8913")), 5001ul);
+  EXPECT_THROW(ro_value_to_uint(std::string("891")), XMLConfigurationParserException);
+}
+
 class XmlConfiguationParserTest : public testing::Test
 {
 };
@@ -147,6 +176,35 @@ TEST_F(XmlConfiguationParserTest, shouldSetTheDefaultResolutionOfTheZoneSetConfi
             psen_scan_v2_standalone::configuration::DEFAULT_ZONESET_ANGLE_STEP);
 }
 
+static const std::string CACHE_FILE{ "unittest_xml_configuration_parser.cache" };
+
+TEST_F(XmlConfiguationParserTest, shouldCreateCacheAndReturnSameConfigurationFromCache)
+{
+  std::remove(CACHE_FILE.c_str());
+  const auto parsed_config =
+      parseFile("testfiles/unittest_xml_configuration_parser-testfile-with-speedrange.xml", CACHE_FILE);
+  EXPECT_EQ(parsed_config, parseFile("testfiles/unittest_xml_configuration_parser-testfile-with-speedrange.xml"));
+
+  ASSERT_TRUE(std::ifstream(CACHE_FILE).good());
+  const auto cached_config =
+      parseFile("testfiles/unittest_xml_configuration_parser-testfile-with-speedrange.xml", CACHE_FILE);
+  EXPECT_EQ(cached_config, parsed_config);
+}
+
+TEST_F(XmlConfiguationParserTest, shouldIgnoreCacheOfDifferentFile)
+{
+  std::remove(CACHE_FILE.c_str());
+  parseFile("testfiles/unittest_xml_configuration_parser-testfile-with-speedrange.xml", CACHE_FILE);
+
+  EXPECT_EQ(parseFile("testfiles/unittest_xml_configuration_parser-testfile-no-speedrange.xml", CACHE_FILE),
+            parseFile("testfiles/unittest_xml_configuration_parser-testfile-no-speedrange.xml"));
+}
+
+TEST_F(XmlConfiguationParserTest, shouldThrowIfFileDoesNotExistDespiteCache)
+{
+  EXPECT_THROW(parseFile("non-existing-file.xml", CACHE_FILE), XMLConfigurationParserException);
+}
+
 TEST_F(XmlConfiguationParserTest, shouldThrowOnNonXMLInput)
 {
   EXPECT_THROW_AND_WHAT(parseString("NON XML STRING"), XMLConfigurationParserException, "Could not parse content.");
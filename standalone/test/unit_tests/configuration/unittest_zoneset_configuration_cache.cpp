@@ -0,0 +1,157 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "psen_scan_v2_standalone/configuration/zoneset_configuration.h"
+#include "psen_scan_v2_standalone/configuration/zoneset_configuration_cache.h"
+
+using namespace psen_scan_v2_standalone;
+using namespace psen_scan_v2_standalone::configuration;
+using namespace psen_scan_v2_standalone::configuration::zoneset_configuration_cache;
+
+namespace psen_scan_v2_standalone_test
+{
+static constexpr uint64_t KEY{ 0x1234567890ABCDEF };
+static const std::string CACHE_FILE{ "unittest_zoneset_configuration_cache.cache" };
+
+static ZoneSetConfiguration createZoneSetConfiguration()
+{
+  ZoneSet zoneset;
+  zoneset.safety1_ = { 1, 2, 3 };
+  zoneset.safety2_ = { 4 };
+  zoneset.warn1_ = { 5, 6 };
+  zoneset.muting2_ = { std::numeric_limits<uint16_t>::max() };
+  zoneset.resolution_ = util::TenthOfDegree(5);
+
+  ZoneSet zoneset_with_speed_range;
+  zoneset_with_speed_range.safety3_ = std::vector<unsigned long>(550, 0x0298);
+  zoneset_with_speed_range.warn2_ = std::vector<unsigned long>(550, 0x02F0);
+  zoneset_with_speed_range.muting1_ = { 7 };
+  zoneset_with_speed_range.resolution_ = util::TenthOfDegree(5);
+  zoneset_with_speed_range.speed_range_ = ZoneSetSpeedRange(-10, 10);
+
+  ZoneSetConfiguration zoneset_config;
+  zoneset_config.zonesets_ = { zoneset, zoneset_with_speed_range };
+  return zoneset_config;
+}
+
+TEST(ZoneSetConfigurationCacheTest, shouldDeserializeSerializedConfiguration)
+{
+  const auto zoneset_config = createZoneSetConfiguration();
+  const auto data = serialize(zoneset_config, KEY);
+
+  const auto deserialized = deserialize(data.data(), data.size(), KEY);
+  ASSERT_TRUE(deserialized);
+  EXPECT_EQ(*deserialized, zoneset_config);
+}
+
+TEST(ZoneSetConfigurationCacheTest, shouldStoreRadiiWith16Bit)
+{
+  const auto zoneset_config = createZoneSetConfiguration();
+  const auto data = serialize(zoneset_config, KEY);
+  EXPECT_LT(data.size(), 2 * sizeof(uint16_t) * (550 + 550 + 10));
+}
+
+TEST(ZoneSetConfigurationCacheTest, shouldThrowIfRadiusDoesNotFitInto16Bit)
+{
+  auto zoneset_config = createZoneSetConfiguration();
+  zoneset_config.zonesets_.at(0).safety1_.push_back(std::numeric_limits<uint16_t>::max() + 1ul);
+  EXPECT_THROW(serialize(zoneset_config, KEY), ZoneSetConfigurationCacheException);
+}
+
+TEST(ZoneSetConfigurationCacheTest, shouldReturnNoneForDifferentKey)
+{
+  const auto data = serialize(createZoneSetConfiguration(), KEY);
+  EXPECT_FALSE(deserialize(data.data(), data.size(), KEY + 1));
+}
+
+TEST(ZoneSetConfigurationCacheTest, shouldReturnNoneForTruncatedOrExtendedData)
+{
+  const auto data = serialize(createZoneSetConfiguration(), KEY);
+  for (std::size_t size = 0; size < data.size(); ++size)
+  {
+    EXPECT_FALSE(deserialize(data.data(), size, KEY)) << "Size: " << size;
+  }
+
+  const auto extended_data = data + "x";
+  EXPECT_FALSE(deserialize(extended_data.data(), extended_data.size(), KEY));
+}
+
+TEST(ZoneSetConfigurationCacheTest, shouldReturnNoneForNumberOfZonesetsExceedingData)
+{
+  auto data = serialize(createZoneSetConfiguration(), KEY);
+  const uint32_t num_zonesets{ std::numeric_limits<uint32_t>::max() };
+  std::memcpy(&data[sizeof(MAGIC) + sizeof(VERSION) + sizeof(KEY)], &num_zonesets, sizeof(num_zonesets));
+  EXPECT_FALSE(deserialize(data.data(), data.size(), KEY));
+}
+
+TEST(ZoneSetConfigurationCacheTest, shouldReturnNoneForInvalidMagic)
+{
+  auto data = serialize(createZoneSetConfiguration(), KEY);
+  data[0] = ~data[0];
+  EXPECT_FALSE(deserialize(data.data(), data.size(), KEY));
+}
+
+TEST(ZoneSetConfigurationCacheTest, shouldLoadStoredConfiguration)
+{
+  const auto zoneset_config = createZoneSetConfiguration();
+  store(CACHE_FILE, zoneset_config, KEY);
+
+  const auto loaded = load(CACHE_FILE, KEY);
+  ASSERT_TRUE(loaded);
+  EXPECT_EQ(*loaded, zoneset_config);
+}
+
+TEST(ZoneSetConfigurationCacheTest, shouldOverwriteExistingCacheFile)
+{
+  store(CACHE_FILE, ZoneSetConfiguration(), KEY);
+  store(CACHE_FILE, createZoneSetConfiguration(), KEY + 1);
+
+  EXPECT_FALSE(load(CACHE_FILE, KEY));
+  EXPECT_TRUE(load(CACHE_FILE, KEY + 1));
+}
+
+TEST(ZoneSetConfigurationCacheTest, shouldReturnNoneForMissingFile)
+{
+  std::remove(CACHE_FILE.c_str());
+  EXPECT_FALSE(load(CACHE_FILE, KEY));
+}
+
+TEST(ZoneSetConfigurationCacheTest, shouldThrowIfFileCannotBeWritten)
+{
+  EXPECT_THROW(store("non-existing-dir/cache", createZoneSetConfiguration(), KEY), ZoneSetConfigurationCacheException);
+}
+
+TEST(ZoneSetConfigurationCacheTest, shouldHashDifferentContentDifferently)
+{
+  const std::string content{ "<ro>D307</ro>" };
+  const std::string other_content{ "<ro>D308</ro>" };
+  EXPECT_EQ(hash(content.data(), content.size()), hash(content.data(), content.size()));
+  EXPECT_NE(hash(content.data(), content.size()), hash(other_content.data(), other_content.size()));
+}
+
+}  // namespace psen_scan_v2_standalone_test
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
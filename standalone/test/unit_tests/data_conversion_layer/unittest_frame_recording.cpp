@@ -0,0 +1,138 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "psen_scan_v2_standalone/data_conversion_layer/frame_recording.h"
+
+using namespace psen_scan_v2_standalone::data_conversion_layer;
+
+namespace psen_scan_v2_standalone_test
+{
+static const std::string FILE_PATH{ "unittest_frame_recording.psenrec" };
+
+class FrameRecordingTest : public testing::Test
+{
+protected:
+  void TearDown() override
+  {
+    std::remove(FILE_PATH.c_str());
+  }
+
+  static void writeFileHeader(std::ofstream& os, const uint32_t& version = frame_recording::VERSION)
+  {
+    os.write(frame_recording::MAGIC.data(), frame_recording::MAGIC.size());
+    os.write(reinterpret_cast<const char*>(&version), sizeof(version));
+  }
+
+  static void writeRecord(std::ofstream& os, const int64_t& timestamp, const std::string& data)
+  {
+    const auto num_bytes{ static_cast<uint32_t>(data.size()) };
+    os.write(reinterpret_cast<const char*>(&timestamp), sizeof(timestamp));
+    os.write(reinterpret_cast<const char*>(&num_bytes), sizeof(num_bytes));
+    os.write(data.data(), static_cast<std::streamsize>(data.size()));
+  }
+};
+
+TEST_F(FrameRecordingTest, shouldCreateFileNameWithIndexAndExtension)
+{
+  EXPECT_EQ("/tmp/front_000003.psenrec", frame_recording::fileName("/tmp/front", 3));
+  EXPECT_EQ("front_123456.psenrec", frame_recording::fileName("front", 123456));
+}
+
+TEST_F(FrameRecordingTest, shouldReadRecordsInWrittenOrder)
+{
+  {
+    std::ofstream os(FILE_PATH, std::ios::binary);
+    writeFileHeader(os);
+    writeRecord(os, 1000, "first");
+    writeRecord(os, 2000, "");
+    writeRecord(os, -3, "third");
+  }
+
+  frame_recording::Reader reader(FILE_PATH);
+  frame_recording::Record record;
+  ASSERT_TRUE(reader.read(record));
+  EXPECT_EQ(1000, record.timestamp);
+  EXPECT_EQ("first", std::string(record.data.begin(), record.data.end()));
+  ASSERT_TRUE(reader.read(record));
+  EXPECT_EQ(2000, record.timestamp);
+  EXPECT_TRUE(record.data.empty());
+  ASSERT_TRUE(reader.read(record));
+  EXPECT_EQ(-3, record.timestamp);
+  EXPECT_EQ("third", std::string(record.data.begin(), record.data.end()));
+  EXPECT_FALSE(reader.read(record));
+}
+
+TEST_F(FrameRecordingTest, shouldIgnoreTruncatedLastRecord)
+{
+  {
+    std::ofstream os(FILE_PATH, std::ios::binary);
+    writeFileHeader(os);
+    writeRecord(os, 1000, "complete");
+    writeRecord(os, 2000, "truncated");
+  }
+  std::string content;
+  {
+    std::ifstream is(FILE_PATH, std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream os(FILE_PATH, std::ios::binary | std::ios::trunc);
+    os.write(content.data(), static_cast<std::streamsize>(content.size() - 3));
+  }
+
+  frame_recording::Reader reader(FILE_PATH);
+  frame_recording::Record record;
+  ASSERT_TRUE(reader.read(record));
+  EXPECT_EQ(1000, record.timestamp);
+  EXPECT_FALSE(reader.read(record));
+}
+
+TEST_F(FrameRecordingTest, shouldThrowOnMissingFile)
+{
+  EXPECT_THROW(frame_recording::Reader("not_existing.psenrec"), frame_recording::ReadError);
+}
+
+TEST_F(FrameRecordingTest, shouldThrowOnInvalidMagic)
+{
+  {
+    std::ofstream os(FILE_PATH, std::ios::binary);
+    os << "no recording at all";
+  }
+  EXPECT_THROW(frame_recording::Reader{ FILE_PATH }, frame_recording::ReadError);
+}
+
+TEST_F(FrameRecordingTest, shouldThrowOnUnsupportedVersion)
+{
+  {
+    std::ofstream os(FILE_PATH, std::ios::binary);
+    writeFileHeader(os, frame_recording::VERSION + 1);
+  }
+  EXPECT_THROW(frame_recording::Reader{ FILE_PATH }, frame_recording::ReadError);
+}
+
+}  // namespace psen_scan_v2_standalone_test
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
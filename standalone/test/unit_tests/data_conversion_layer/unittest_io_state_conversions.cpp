@@ -198,6 +198,86 @@ TEST(IOStateConversionsTest, shouldIgnoreChangeOfUnusedOutput)
   EXPECT_TRUE(pin_states.empty());
 }
 
+TEST(IOStateConversionsTest, shouldReturnEmptyChangedInputPinsForEqualPinData)
+{
+  const auto pin_data{ createPinData() };
+  const auto changed_pins{ data_conversion_layer::generateChangedInputPins(pin_data, pin_data) };
+
+  EXPECT_TRUE(changed_pins.empty());
+  EXPECT_EQ(changed_pins.begin(), changed_pins.end());
+}
+
+TEST(IOStateConversionsTest, shouldReturnChangedInputPinsEqualToChangedInputStates)
+{
+  const PinData pin_data1{};
+  const auto pin_data2{ createPinData() };
+
+  const auto changed_pins{ data_conversion_layer::generateChangedInputPins(pin_data2, pin_data1) };
+  const auto changed_states{ data_conversion_layer::generateChangedInputStates(pin_data2, pin_data1) };
+
+  ASSERT_FALSE(changed_pins.empty());
+  EXPECT_EQ(changed_pins.size(), changed_states.size());
+  EXPECT_EQ(changed_pins.toPinStates(), changed_states);
+}
+
+TEST(IOStateConversionsTest, shouldReturnChangedOutputPinsEqualToChangedOutputStates)
+{
+  const PinData pin_data1{};
+  const auto pin_data2{ createPinData() };
+
+  const auto changed_pins{ data_conversion_layer::generateChangedOutputPins(pin_data2, pin_data1) };
+  const auto changed_states{ data_conversion_layer::generateChangedOutputStates(pin_data2, pin_data1) };
+
+  ASSERT_FALSE(changed_pins.empty());
+  EXPECT_EQ(changed_pins.size(), changed_states.size());
+  EXPECT_EQ(changed_pins.toPinStates(), changed_states);
+}
+
+TEST(IOStateConversionsTest, shouldReturnChangedInputPinWithNewStateAndStaticName)
+{
+  PinData pin_data1{};
+  PinData pin_data2{};
+  ASSERT_TRUE(data_conversion_layer::isUsedInputBit(4, 1));
+  pin_data1.input_state.at(4).set(1);
+
+  const auto changed_pins{ data_conversion_layer::generateChangedInputPins(pin_data2, pin_data1) };
+
+  ASSERT_EQ(changed_pins.size(), 1u);
+  const auto pin{ *changed_pins.begin() };
+  EXPECT_EQ(pin.id(), createId(4, 1));
+  EXPECT_FALSE(pin.state());
+  EXPECT_EQ(&pin.name(), &data_conversion_layer::monitoring_frame::io::getInputName(4, 1));
+}
+
+TEST(IOStateConversionsTest, shouldIgnoreChangeOfUnusedInputInChangedInputPins)
+{
+  PinData pin_data1{};
+  PinData pin_data2{};
+  ASSERT_FALSE(data_conversion_layer::isUsedInputBit(2, 3));
+  pin_data2.input_state.at(2).set(3);
+
+  EXPECT_TRUE(data_conversion_layer::generateChangedInputPins(pin_data2, pin_data1).empty());
+}
+
+TEST(IOStateConversionsTest, shouldIgnoreChangeOfUnusedOutputInChangedOutputPins)
+{
+  PinData pin_data1{};
+  PinData pin_data2{};
+  ASSERT_FALSE(data_conversion_layer::isUsedOutputBit(2, 3));
+  pin_data2.output_state.at(2).set(3);
+
+  EXPECT_TRUE(data_conversion_layer::generateChangedOutputPins(pin_data2, pin_data1).empty());
+}
+
+TEST(IOStateConversionsTest, shouldFormatChangedPinsLikeChangedPinStates)
+{
+  const PinData pin_data1{};
+  const auto pin_data2{ createPinData() };
+
+  EXPECT_EQ(formatPinStates(data_conversion_layer::generateChangedInputPins(pin_data2, pin_data1)),
+            formatPinStates(data_conversion_layer::generateChangedInputStates(pin_data2, pin_data1)));
+}
+
 }  // namespace psen_scan_v2_standalone_test
 
 int main(int argc, char** argv)
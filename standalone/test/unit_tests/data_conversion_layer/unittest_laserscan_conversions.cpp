@@ -202,6 +202,41 @@ TEST(LaserScanConversionsTest, laserScanShouldContainCorrectTimestampAfterConver
   EXPECT_EQ(EXPECTED_TIMESTAMP_AFTER_CONVERSION, scan_ptr->timestamp());
 }
 
+TEST(LaserScanConversionsTest, laserScanShouldContainMasterAsScannerIdByDefault)
+{
+  const auto scan{ data_conversion_layer::LaserScanConverter::toLaserScan({ createDefaultStampedMsg() }) };
+  EXPECT_EQ(configuration::ScannerId::master, scan.scannerId());
+}
+
+TEST(LaserScanConversionsTest, laserScanShouldContainScannerIdOfFrameAfterConversion)
+{
+  const MessageStamped stamped_msg(createDefaultMsgBuilder().scannerId(configuration::ScannerId::subscriber1),
+                                   DEFAULT_TIMESTAMP);
+  const auto scan{ data_conversion_layer::LaserScanConverter::toLaserScan({ stamped_msg }) };
+  EXPECT_EQ(configuration::ScannerId::subscriber1, scan.scannerId());
+}
+
+TEST(LaserScanConversionsTest, laserScanShouldContainTimestampOfScanClockAfterConversion)
+{
+  static constexpr int64_t SCAN_PERIOD{ 30000000 };
+  static constexpr int64_t JITTER{ 1000000 };
+  static constexpr uint32_t NUM_SCANS{ 20 };
+
+  util::ScanClockEstimator scan_clock;
+  int64_t timestamp{ 0 };
+  for (uint32_t i = 0; i < NUM_SCANS; ++i)
+  {
+    const int64_t jitter{ i + 1 == NUM_SCANS ? JITTER : 0 };
+    const MessageStamped stamped_msg(createDefaultMsgBuilder().scanCounter(42 + i),
+                                     DEFAULT_TIMESTAMP + i * SCAN_PERIOD + jitter);
+    timestamp = data_conversion_layer::LaserScanConverter::toLaserScan({ stamped_msg }, scan_clock).timestamp();
+  }
+
+  const int64_t expected_timestamp{ EXPECTED_TIMESTAMP_AFTER_CONVERSION + (NUM_SCANS - 1) * SCAN_PERIOD };
+  EXPECT_NEAR(expected_timestamp, timestamp, JITTER / 2);
+  EXPECT_EQ(NUM_SCANS, scan_clock.statistics().num_scans);
+}
+
 MATCHER_P(IOStateFromStampedMsg, stamped_msg, "")
 {
   return ExplainMatchResult(IOStateEq(IOState(stamped_msg.msg_.iOPinData(), stamped_msg.stamp_)), arg, result_listener);
@@ -253,6 +288,16 @@ TEST(LaserScanConversionsTest, shouldThrowProtocolErrorOnMismatchingScanCounters
                data_conversion_layer::ScannerProtocolViolationError);
 }
 
+TEST(LaserScanConversionsTest, shouldThrowProtocolErrorOnMismatchingScannerIds)
+{
+  auto stamped_msgs = createValidStampedMsgs(2);
+  const auto from_theta{ stamped_msgs[1].msg_.fromTheta() };
+  stamped_msgs[1].msg_ =
+      createDefaultMsgBuilder().scannerId(configuration::ScannerId::subscriber0).fromTheta(from_theta);
+  ASSERT_THROW(data_conversion_layer::LaserScanConverter::toLaserScan(stamped_msgs),
+               data_conversion_layer::ScannerProtocolViolationError);
+}
+
 TEST(LaserScanConversionsTest, laserScanShouldContainAllScanInformationWhenBuildWithMultipleFrames)
 {
   auto stamped_msgs = createValidStampedMsgs(6);
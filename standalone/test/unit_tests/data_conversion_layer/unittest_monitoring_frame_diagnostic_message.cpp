@@ -13,6 +13,9 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+#include <stdexcept>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "psen_scan_v2_standalone/data_conversion_layer/diagnostics.h"
@@ -85,6 +88,89 @@ TEST(MonitoringFrameDiagnosticMessageTest, shouldOutputTheRightDiagnosticMessage
   // Output with byte/bit information since error internal error is ambiguous
   EXPECT_EQ(os.str(), "Device: Subscriber1 - Internal error. (Byte:2 Bit:5)");
 }
+
+namespace diagnostic = data_conversion_layer::monitoring_frame::diagnostic;
+
+TEST(MonitoringFrameDiagnosticErrorMaskTest, shouldExpandRawBytesToMessagesOrderedByDeviceByteAndBit)
+{
+  diagnostic::ErrorMask::RawBytes raw_bytes{};
+  raw_bytes.at(4) = 0b10000000;          // master, intern
+  raw_bytes.at(3) = 0b00001001;          // master, temp_meas_prob and disp_com_prb
+  const diagnostic::ErrorMask errors(raw_bytes);
+
+  const std::vector<diagnostic::Message> expected_messages{
+    diagnostic::Message(configuration::ScannerId::master, diagnostic::ErrorLocation(3, 0)),
+    diagnostic::Message(configuration::ScannerId::master, diagnostic::ErrorLocation(3, 3)),
+    diagnostic::Message(configuration::ScannerId::master, diagnostic::ErrorLocation(4, 7))
+  };
+  EXPECT_EQ(expected_messages, errors.messages());
+  EXPECT_FALSE(errors.none());
+}
+
+TEST(MonitoringFrameDiagnosticErrorMaskTest, shouldUseNineBytesPerDevice)
+{
+  diagnostic::ErrorMask::RawBytes raw_bytes{};
+  raw_bytes.at(diagnostic::RAW_CHUNK_LENGTH_FOR_ONE_DEVICE_IN_BYTES * 3 + 1) = 0b10000000;
+  EXPECT_EQ(std::vector<diagnostic::Message>(
+                { diagnostic::Message(configuration::ScannerId::subscriber2, diagnostic::ErrorLocation(1, 7)) }),
+            diagnostic::ErrorMask(raw_bytes).messages());
+}
+
+TEST(MonitoringFrameDiagnosticErrorMaskTest, shouldIgnoreUnusedBitsOfRawBytes)
+{
+  diagnostic::ErrorMask::RawBytes raw_bytes{};
+  raw_bytes.at(1) = 0b00000010;  // master, unused
+  raw_bytes.at(6) = 0b11111111;  // master, unused byte
+  raw_bytes.at(diagnostic::ErrorMask::NUM_BYTES - 1) = 0b11111111;
+  const diagnostic::ErrorMask errors(raw_bytes);
+
+  EXPECT_TRUE(errors.none());
+  EXPECT_TRUE(errors.messages().empty());
+  EXPECT_EQ(diagnostic::ErrorMask(), errors);
+}
+
+TEST(MonitoringFrameDiagnosticErrorMaskTest, shouldOnlyKeepErrorsOfSpecifiedDevice)
+{
+  const diagnostic::Message msg0(configuration::ScannerId::master, diagnostic::ErrorLocation(0, 0));
+  const diagnostic::Message msg1(configuration::ScannerId::subscriber2, diagnostic::ErrorLocation(5, 1));
+  const diagnostic::ErrorMask errors({ msg0, msg1 });
+
+  EXPECT_EQ(diagnostic::ErrorMask({ msg0 }), errors.device(configuration::ScannerId::master));
+  EXPECT_EQ(diagnostic::ErrorMask({ msg1 }), errors.device(configuration::ScannerId::subscriber2));
+  EXPECT_TRUE(errors.device(configuration::ScannerId::subscriber0).none());
+}
+
+TEST(MonitoringFrameDiagnosticErrorMaskTest, shouldBeEqualOnlyWithSameErrors)
+{
+  const diagnostic::Message msg0(configuration::ScannerId::master, diagnostic::ErrorLocation(0, 0));
+  const diagnostic::Message msg1(configuration::ScannerId::subscriber2, diagnostic::ErrorLocation(5, 1));
+
+  EXPECT_EQ(diagnostic::ErrorMask({ msg0, msg1 }), diagnostic::ErrorMask({ msg1, msg0 }));
+  EXPECT_NE(diagnostic::ErrorMask({ msg0 }), diagnostic::ErrorMask({ msg0, msg1 }));
+  EXPECT_NE(diagnostic::ErrorMask({ msg1 }), diagnostic::ErrorMask());
+}
+
+TEST(MonitoringFrameDiagnosticErrorMaskTest, shouldSetAndTestSingleErrors)
+{
+  const diagnostic::Message msg(configuration::ScannerId::subscriber1, diagnostic::ErrorLocation(8, 7));
+  diagnostic::ErrorMask errors;
+  EXPECT_FALSE(errors.test(msg));
+
+  errors.set(msg);
+  EXPECT_TRUE(errors.test(msg));
+  EXPECT_FALSE(
+      errors.test(diagnostic::Message(configuration::ScannerId::subscriber2, diagnostic::ErrorLocation(8, 7))));
+  EXPECT_EQ(std::vector<diagnostic::Message>({ msg }), errors.messages());
+}
+
+TEST(MonitoringFrameDiagnosticErrorMaskTest, shouldThrowOnInvalidErrorLocation)
+{
+  diagnostic::ErrorMask errors;
+  EXPECT_THROW(errors.set(diagnostic::Message(configuration::ScannerId::master, diagnostic::ErrorLocation(9, 0))),
+               std::out_of_range);
+  EXPECT_THROW(errors.test(diagnostic::Message(configuration::ScannerId::master, diagnostic::ErrorLocation(0, 8))),
+               std::out_of_range);
+}
 }  // namespace psen_scan_v2_standalone_test
 
 int main(int argc, char* argv[])
@@ -0,0 +1,335 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "psen_scan_v2_standalone/data_conversion_layer/io_pin_data.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/scan_log.h"
+#include "psen_scan_v2_standalone/io_state.h"
+#include "psen_scan_v2_standalone/laserscan.h"
+#include "psen_scan_v2_standalone/util/tenth_of_degree.h"
+
+using namespace psen_scan_v2_standalone;
+using namespace psen_scan_v2_standalone::data_conversion_layer;
+
+namespace psen_scan_v2_standalone_test
+{
+static const std::string FILE_PATH{ "unittest_scan_log.psenlog" };
+static constexpr double NO_SIGNAL{ std::numeric_limits<double>::infinity() };
+static constexpr int64_t SCAN_PERIOD{ 30000000 };
+
+static monitoring_frame::io::PinData createPinData(const uint8_t& input, const uint8_t& output)
+{
+  monitoring_frame::io::PinData pin_data;
+  pin_data.input_state.front() = input;
+  pin_data.output_state.back() = output;
+  return pin_data;
+}
+
+static LaserScan createScan(const uint32_t& scan_counter, const int64_t& timestamp, const uint8_t& active_zoneset = 0)
+{
+  LaserScan scan(util::TenthOfDegree(10), util::TenthOfDegree(-50), util::TenthOfDegree(50), scan_counter,
+                 active_zoneset, timestamp);
+  scan.measurements({ 1.234, 1.236, NO_SIGNAL, 0., 65.534, 0.001, 1.2, 3.5, 2.999, NO_SIGNAL, 0.5 });
+  scan.intensities({ 0., 16383., 4., 4., 100., 16000., 3., 2., 1., 0., 42. });
+  scan.ioStates({ IOState(createPinData(0b1, 0b10), timestamp + 1000), IOState(createPinData(0b1, 0b10), timestamp) });
+  return scan;
+}
+
+static void expectScanEqual(const LaserScan& expected, const LaserScan& actual)
+{
+  EXPECT_EQ(expected.scanResolution(), actual.scanResolution());
+  EXPECT_EQ(expected.minScanAngle(), actual.minScanAngle());
+  EXPECT_EQ(expected.maxScanAngle(), actual.maxScanAngle());
+  EXPECT_EQ(expected.scanCounter(), actual.scanCounter());
+  EXPECT_EQ(expected.activeZoneset(), actual.activeZoneset());
+  EXPECT_EQ(expected.timestamp(), actual.timestamp());
+  EXPECT_EQ(expected.measurements(), actual.measurements());
+  EXPECT_EQ(expected.intensities(), actual.intensities());
+  ASSERT_EQ(expected.ioStates().size(), actual.ioStates().size());
+  for (std::size_t i = 0; i < expected.ioStates().size(); ++i)
+  {
+    EXPECT_EQ(expected.ioStates()[i], actual.ioStates()[i]);
+    EXPECT_EQ(expected.ioStates()[i].timestamp(), actual.ioStates()[i].timestamp());
+  }
+}
+
+static void expectNextScan(scan_log::Reader& reader, const LaserScan& expected)
+{
+  const auto scan{ reader.read() };
+  ASSERT_TRUE(scan);
+  expectScanEqual(expected, *scan);
+}
+
+class ScanLogTest : public testing::Test
+{
+protected:
+  void TearDown() override
+  {
+    std::remove(FILE_PATH.c_str());
+  }
+
+  static std::vector<char> readFile()
+  {
+    std::ifstream is(FILE_PATH, std::ios::binary);
+    return { std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>() };
+  }
+
+  static void writeFile(const std::vector<char>& data)
+  {
+    std::ofstream os(FILE_PATH, std::ios::binary | std::ios::trunc);
+    os.write(data.data(), static_cast<std::streamsize>(data.size()));
+  }
+
+  //! Writes scans with the scan counters 0 .. num_scans - 1 and the timestamps SCAN_PERIOD * scan counter.
+  static std::vector<LaserScan> writeScans(const std::size_t& num_scans, const std::size_t& scans_per_block)
+  {
+    std::vector<LaserScan> scans;
+    scan_log::Writer writer(FILE_PATH, scans_per_block);
+    for (std::size_t i = 0; i < num_scans; ++i)
+    {
+      scans.push_back(createScan(static_cast<uint32_t>(i), static_cast<int64_t>(i) * SCAN_PERIOD));
+      writer.write(scans.back());
+    }
+    return scans;
+  }
+};
+
+TEST_F(ScanLogTest, shouldReadWrittenScansIdentically)
+{
+  std::vector<LaserScan> scans;
+  scans.push_back(createScan(42, 1000000000, 1));
+  scans.push_back(createScan(43, 1030000000, 1));
+  scans.push_back(createScan(41, 990000000, 2));
+  scans.push_back(LaserScan(util::TenthOfDegree(2), util::TenthOfDegree(0), util::TenthOfDegree(2750),
+                            std::numeric_limits<uint32_t>::max(), 255, -5));
+  scans.push_back(createScan(0, std::numeric_limits<int64_t>::max(), 2));
+  scans.back().ioStates({ IOState(createPinData(0b1, 0b11), 7), IOState(createPinData(0b1, 0b10), -7) });
+  scans.push_back(createScan(1, std::numeric_limits<int64_t>::min()));
+  scans.back().intensities({});
+
+  {
+    scan_log::Writer writer(FILE_PATH, 4);
+    for (const auto& scan : scans)
+    {
+      writer.write(scan);
+    }
+  }
+
+  scan_log::Reader reader(FILE_PATH);
+  EXPECT_EQ(scans.size(), reader.numScans());
+  EXPECT_EQ(2u, reader.numBlocks());
+  for (const auto& scan : scans)
+  {
+    expectNextScan(reader, scan);
+  }
+  EXPECT_FALSE(reader.read());
+}
+
+TEST_F(ScanLogTest, shouldReadEmptyLog)
+{
+  writeScans(0, 10);
+
+  scan_log::Reader reader(FILE_PATH);
+  EXPECT_EQ(0u, reader.numScans());
+  EXPECT_EQ(0u, reader.numBlocks());
+  EXPECT_EQ(0, reader.firstTimestamp());
+  EXPECT_FALSE(reader.read());
+  reader.seek(0);
+  EXPECT_FALSE(reader.read());
+}
+
+TEST_F(ScanLogTest, shouldProvideTimestampsOfFirstAndLastScan)
+{
+  writeScans(25, 10);
+
+  scan_log::Reader reader(FILE_PATH);
+  EXPECT_EQ(25u, reader.numScans());
+  EXPECT_EQ(3u, reader.numBlocks());
+  EXPECT_EQ(0, reader.firstTimestamp());
+  EXPECT_EQ(24 * SCAN_PERIOD, reader.lastTimestamp());
+}
+
+TEST_F(ScanLogTest, shouldSeekToFirstScanNotOlderThanTimestamp)
+{
+  const auto scans{ writeScans(25, 10) };
+  scan_log::Reader reader(FILE_PATH);
+
+  reader.seek(13 * SCAN_PERIOD);
+  expectNextScan(reader, scans.at(13));
+
+  reader.seek(19 * SCAN_PERIOD + 1);
+  expectNextScan(reader, scans.at(20));
+  expectNextScan(reader, scans.at(21));
+
+  reader.seek(-SCAN_PERIOD);
+  expectNextScan(reader, scans.at(0));
+
+  reader.seek(24 * SCAN_PERIOD + 1);
+  EXPECT_FALSE(reader.read());
+
+  reader.rewind();
+  expectNextScan(reader, scans.at(0));
+}
+
+TEST_F(ScanLogTest, shouldRebuildIndexOfLogWhichWasNotClosed)
+{
+  const auto scans{ writeScans(25, 10) };
+  auto data{ readFile() };
+  const std::size_t index_size{ 3 * sizeof(scan_log::IndexEntry) + sizeof(scan_log::IndexTrailer) };
+  data.resize(data.size() - index_size - 5);
+  writeFile(data);
+
+  scan_log::Reader reader(FILE_PATH);
+  EXPECT_EQ(2u, reader.numBlocks());
+  EXPECT_EQ(20u, reader.numScans());
+  reader.seek(15 * SCAN_PERIOD);
+  expectNextScan(reader, scans.at(15));
+}
+
+TEST_F(ScanLogTest, shouldStorePinDataOfUnchangedIOStatesOnlyOnce)
+{
+  writeScans(1, 10);
+  const auto size_of_first_scan{ readFile().size() };
+  writeScans(2, 10);
+  const auto size_of_second_scan{ readFile().size() - size_of_first_scan };
+
+  const std::size_t pin_data_size{ monitoring_frame::io::NUMBER_OF_INPUT_BYTES +
+                                   monitoring_frame::io::NUMBER_OF_OUTPUT_BYTES };
+  EXPECT_LE(size_of_second_scan + pin_data_size, size_of_first_scan);
+}
+
+TEST_F(ScanLogTest, shouldBeAtLeastFourTimesSmallerThanSinglePrecisionDistancesAndIntensities)
+{
+  static constexpr std::size_t NUM_SCANS{ 20 };
+  static constexpr std::size_t NUM_MEASUREMENTS{ 2750 };
+
+  {
+    scan_log::Writer writer(FILE_PATH);
+    for (std::size_t i = 0; i < NUM_SCANS; ++i)
+    {
+      LaserScan scan(util::TenthOfDegree(1), util::TenthOfDegree(0), util::TenthOfDegree(2749),
+                     static_cast<uint32_t>(i), 0, static_cast<int64_t>(i) * SCAN_PERIOD);
+      LaserScan::MeasurementData measurements(NUM_MEASUREMENTS);
+      LaserScan::IntensityData intensities(NUM_MEASUREMENTS);
+      for (std::size_t j = 0; j < NUM_MEASUREMENTS; ++j)
+      {
+        const double noise{ static_cast<double>((j * 7919 + i * 104729) % 11) - 5. };
+        measurements[j] = std::round(2000. + 500. * std::sin(static_cast<double>(j) / 100.) + noise) / 1000.;
+        intensities[j] = 3000. + 10. * noise;
+      }
+      std::fill(measurements.begin() + 1000, measurements.begin() + 1200, NO_SIGNAL);
+      scan.measurements(measurements);
+      scan.intensities(intensities);
+      writer.write(scan);
+    }
+  }
+
+  const std::size_t single_precision_size{ NUM_SCANS * NUM_MEASUREMENTS * 2 * sizeof(float) };
+  EXPECT_LE(readFile().size() * 4, single_precision_size);
+}
+
+TEST_F(ScanLogTest, shouldThrowOutOfRangeForValuesNotFittingIntoTheLog)
+{
+  scan_log::Writer writer(FILE_PATH);
+  auto scan{ createScan(1, 1) };
+  scan.measurements({ 65.535 });
+  EXPECT_THROW(writer.write(scan), std::out_of_range);
+  scan.measurements({ -0.001 });
+  EXPECT_THROW(writer.write(scan), std::out_of_range);
+  scan.measurements({ std::numeric_limits<double>::quiet_NaN() });
+  EXPECT_THROW(writer.write(scan), std::out_of_range);
+  scan.measurements({ 1. });
+  scan.intensities({ 65536. });
+  EXPECT_THROW(writer.write(scan), std::out_of_range);
+
+  const auto valid_scan{ createScan(2, 2) };
+  writer.write(valid_scan);
+  writer.close();
+
+  scan_log::Reader reader(FILE_PATH);
+  EXPECT_EQ(1u, reader.numScans());
+  expectNextScan(reader, valid_scan);
+}
+
+TEST_F(ScanLogTest, shouldThrowRuntimeErrorWhenWritingToClosedLog)
+{
+  scan_log::Writer writer(FILE_PATH);
+  writer.close();
+  EXPECT_THROW(writer.write(createScan(1, 1)), std::runtime_error);
+}
+
+TEST_F(ScanLogTest, shouldThrowInvalidArgumentForBlocksWithoutScans)
+{
+  EXPECT_THROW(scan_log::Writer(FILE_PATH, 0), std::invalid_argument);
+}
+
+TEST_F(ScanLogTest, shouldThrowRuntimeErrorIfFileCannotBeCreated)
+{
+  EXPECT_THROW(scan_log::Writer("/non_existing_directory/log.psenlog"), std::runtime_error);
+}
+
+TEST_F(ScanLogTest, shouldThrowReadErrorIfFileDoesNotExist)
+{
+  EXPECT_THROW(scan_log::Reader("non_existing.psenlog"), scan_log::ReadError);
+}
+
+TEST_F(ScanLogTest, shouldThrowReadErrorIfFileIsNoScanLog)
+{
+  writeFile({ 'P', 'S', 'E', 'N', 'R', 'E', 'C', '\0', 1, 0, 0, 0 });
+  EXPECT_THROW(scan_log::Reader{ FILE_PATH }, scan_log::ReadError);
+}
+
+TEST_F(ScanLogTest, shouldThrowReadErrorIfVersionIsNotSupported)
+{
+  writeScans(1, 10);
+  auto data{ readFile() };
+  data.at(scan_log::MAGIC.size()) = 2;
+  writeFile(data);
+  EXPECT_THROW(scan_log::Reader{ FILE_PATH }, scan_log::ReadError);
+}
+
+TEST_F(ScanLogTest, shouldThrowReadErrorIfBlockIsCorrupted)
+{
+  writeScans(1, 10);
+  auto data{ readFile() };
+  // The bit width of the first distances follows the flags, the timestamp, the counter, the geometry, the zoneset
+  // and the number of measurements.
+  const std::size_t bit_width_offset{ scan_log::FILE_HEADER_SIZE + sizeof(scan_log::BlockHeader) + 8 };
+  ASSERT_EQ(17, data.at(bit_width_offset));
+  data.at(bit_width_offset) = 18;
+  writeFile(data);
+
+  scan_log::Reader reader(FILE_PATH);
+  EXPECT_THROW(reader.read(), scan_log::ReadError);
+}
+
+}  // namespace psen_scan_v2_standalone_test
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -157,6 +157,42 @@ TEST_F(StartRequestTest, endAngleIncreasedWhenMatchingDataPoint)
       DecodingEquals(raw_start_request, static_cast<size_t>(Offset::master_angle_resolution), resolution.value()));
 }
 
+TEST_F(StartRequestTest, shouldEnableSubscriberDevicesWithTheirScanSettings)
+{
+  const ScanRange subscriber0_range{ util::TenthOfDegree(100u), util::TenthOfDegree(1000u) };
+  const ScanRange subscriber2_range{ util::TenthOfDegree(500u), util::TenthOfDegree(1501u) };
+
+  const ScannerConfiguration config =
+      ScannerConfigurationBuilder("192.168.0.10")
+          .hostIP("192.168.0.50")
+          .scanResolution(util::TenthOfDegree(2u))
+          .scanRange(ScanRange(util::TenthOfDegree(1u), util::TenthOfDegree(2749u)))
+          .enableIntensities()
+          .enableDiagnostics()
+          .addSubscriber(configuration::ScannerId::subscriber2, subscriber2_range, util::TenthOfDegree(5u))
+          .addSubscriber(configuration::ScannerId::subscriber0, subscriber0_range, util::TenthOfDegree(3u));
+
+  const auto data{ data_conversion_layer::start_request::serialize(
+      data_conversion_layer::start_request::Message(config)) };
+
+  EXPECT_TRUE(DecodingEquals<uint8_t>(data, static_cast<size_t>(Offset::device_enabled), 0b00001101));
+  EXPECT_TRUE(DecodingEquals<uint8_t>(data, static_cast<size_t>(Offset::intensities_enabled), 0b00001101));
+  EXPECT_TRUE(DecodingEquals<uint8_t>(data, static_cast<size_t>(Offset::active_zone_set_enabled), 0b00001101));
+  EXPECT_TRUE(DecodingEquals<uint8_t>(data, static_cast<size_t>(Offset::io_pin_data_enabled), 0b00001000));
+  EXPECT_TRUE(DecodingEquals<uint8_t>(data, static_cast<size_t>(Offset::scan_counter_enabled), 0b00001101));
+  EXPECT_TRUE(DecodingEquals<uint8_t>(data, static_cast<size_t>(Offset::diagnostics_enabled), 0b00001101));
+
+  EXPECT_TRUE(DecodingEquals<uint16_t>(data, static_cast<size_t>(Offset::subscriber_one_start_angle), 100));
+  EXPECT_TRUE(DecodingEquals<uint16_t>(data, static_cast<size_t>(Offset::subscriber_one_end_angle), 1001));
+  EXPECT_TRUE(DecodingEquals<uint16_t>(data, static_cast<size_t>(Offset::subscriber_one_angle_resolution), 3));
+  EXPECT_TRUE(DecodingEquals<uint16_t>(data, static_cast<size_t>(Offset::subscriber_two_start_angle), 0));
+  EXPECT_TRUE(DecodingEquals<uint16_t>(data, static_cast<size_t>(Offset::subscriber_two_end_angle), 0));
+  EXPECT_TRUE(DecodingEquals<uint16_t>(data, static_cast<size_t>(Offset::subscriber_two_angle_resolution), 0));
+  EXPECT_TRUE(DecodingEquals<uint16_t>(data, static_cast<size_t>(Offset::subscriber_three_start_angle), 500));
+  EXPECT_TRUE(DecodingEquals<uint16_t>(data, static_cast<size_t>(Offset::subscriber_three_end_angle), 1501));
+  EXPECT_TRUE(DecodingEquals<uint16_t>(data, static_cast<size_t>(Offset::subscriber_three_angle_resolution), 5));
+}
+
 TEST_F(StartRequestTest, crcWithIntensities)
 {
   const ScannerConfiguration config = ScannerConfigurationBuilder("192.168.0.10")
@@ -0,0 +1,174 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "psen_scan_v2_standalone/io_edge.h"
+#include "psen_scan_v2_standalone/protocol_layer/io_edge_detector.h"
+#include "psen_scan_v2_standalone/data_conversion_layer/io_pin_data.h"
+
+#include "psen_scan_v2_standalone/data_conversion_layer/io_pin_data_helper.h"
+
+namespace psen_scan_v2_standalone_test
+{
+using namespace psen_scan_v2_standalone;
+using data_conversion_layer::monitoring_frame::io::LogicalInputType;
+using data_conversion_layer::monitoring_frame::io::OutputType;
+using data_conversion_layer::monitoring_frame::io::PinData;
+using protocol_layer::IOEdgeDetector;
+
+static constexpr uint32_t ZONE_SW_1_ID{ 4 * 8 + 6 };
+static constexpr uint32_t SAFE_1_INT_ID{ 0 };
+static constexpr uint32_t UNUSED_INPUT_ID{ 2 * 8 + 3 };
+
+class IOEdgeDetectorTest : public testing::Test
+{
+protected:
+  IOEdgeCallback callback()
+  {
+    return [this](const IOEdge& edge) { edges_.push_back(edge); };
+  }
+
+protected:
+  std::vector<IOEdge> edges_;
+};
+
+TEST_F(IOEdgeDetectorTest, shouldNotReportEdgesForFirstFrame)
+{
+  IOEdgeDetector detector(callback(), IOEdgeFilter::all());
+  detector.update(createPinData(), 1 /*scan_counter*/, 10 /*timestamp*/);
+  EXPECT_TRUE(edges_.empty());
+}
+
+TEST_F(IOEdgeDetectorTest, shouldNotReportEdgesForUnchangedFrame)
+{
+  IOEdgeDetector detector(callback(), IOEdgeFilter::all());
+  detector.update(createPinData(), 1 /*scan_counter*/, 10 /*timestamp*/);
+  detector.update(createPinData(), 1 /*scan_counter*/, 20 /*timestamp*/);
+  EXPECT_TRUE(edges_.empty());
+}
+
+TEST_F(IOEdgeDetectorTest, shouldReportRisingInputEdgeWithFrameTimestamp)
+{
+  IOEdgeDetector detector(callback(), IOEdgeFilter::all());
+  PinData pin_data{};
+  detector.update(pin_data, 1 /*scan_counter*/, 10 /*timestamp*/);
+  setInputBit(pin_data, ZONE_SW_1_ID);
+  detector.update(pin_data, 1 /*scan_counter*/, 20 /*timestamp*/);
+
+  ASSERT_EQ(edges_.size(), 1u);
+  EXPECT_EQ(edges_[0].pin().id(), ZONE_SW_1_ID);
+  EXPECT_EQ(edges_[0].pin().name(), "Zone Set Switching Input 1");
+  EXPECT_EQ(edges_[0].pinType(), IOEdge::PinType::input);
+  EXPECT_EQ(edges_[0].direction(), IOEdge::Direction::rising);
+  EXPECT_EQ(edges_[0].timestamp(), 20);
+}
+
+TEST_F(IOEdgeDetectorTest, shouldReportFallingOutputEdge)
+{
+  IOEdgeDetector detector(callback(), IOEdgeFilter::all());
+  PinData pin_data{};
+  setOutputBit(pin_data, SAFE_1_INT_ID);
+  detector.update(pin_data, 1 /*scan_counter*/, 10 /*timestamp*/);
+  detector.update(PinData{}, 2 /*scan_counter*/, 20 /*timestamp*/);
+
+  ASSERT_EQ(edges_.size(), 1u);
+  EXPECT_EQ(edges_[0].pin().id(), SAFE_1_INT_ID);
+  EXPECT_EQ(edges_[0].pinType(), IOEdge::PinType::output);
+  EXPECT_EQ(edges_[0].direction(), IOEdge::Direction::falling);
+}
+
+TEST_F(IOEdgeDetectorTest, shouldIgnoreUnusedPins)
+{
+  IOEdgeDetector detector(callback(), IOEdgeFilter::all());
+  PinData pin_data{};
+  detector.update(pin_data, 1 /*scan_counter*/, 10 /*timestamp*/);
+  setInputBit(pin_data, UNUSED_INPUT_ID);
+  detector.update(pin_data, 1 /*scan_counter*/, 20 /*timestamp*/);
+  EXPECT_TRUE(edges_.empty());
+}
+
+TEST_F(IOEdgeDetectorTest, shouldOnlyReportEdgesOfSelectedPins)
+{
+  IOEdgeDetector detector(callback(), IOEdgeFilter().output(OutputType::safe_1_int));
+  PinData pin_data{};
+  detector.update(pin_data, 1 /*scan_counter*/, 10 /*timestamp*/);
+  setInputBit(pin_data, ZONE_SW_1_ID);
+  setOutputBit(pin_data, SAFE_1_INT_ID);
+  detector.update(pin_data, 1 /*scan_counter*/, 20 /*timestamp*/);
+
+  ASSERT_EQ(edges_.size(), 1u);
+  EXPECT_EQ(edges_[0].pin().id(), SAFE_1_INT_ID);
+  EXPECT_EQ(edges_[0].pinType(), IOEdge::PinType::output);
+}
+
+TEST_F(IOEdgeDetectorTest, shouldIgnoreFramesOfEarlierScanRound)
+{
+  IOEdgeDetector detector(callback(), IOEdgeFilter::all());
+  PinData pin_data{};
+  detector.update(pin_data, 2 /*scan_counter*/, 10 /*timestamp*/);
+  setInputBit(pin_data, ZONE_SW_1_ID);
+  detector.update(pin_data, 1 /*scan_counter*/, 20 /*timestamp*/);
+  EXPECT_TRUE(edges_.empty());
+}
+
+TEST_F(IOEdgeDetectorTest, shouldUseNextFrameAsReferenceAfterReset)
+{
+  IOEdgeDetector detector(callback(), IOEdgeFilter::all());
+  PinData pin_data{};
+  detector.update(pin_data, 1 /*scan_counter*/, 10 /*timestamp*/);
+  detector.reset();
+  setInputBit(pin_data, ZONE_SW_1_ID);
+  detector.update(pin_data, 1 /*scan_counter*/, 20 /*timestamp*/);
+  EXPECT_TRUE(edges_.empty());
+}
+
+TEST_F(IOEdgeDetectorTest, shouldDoNothingWithoutCallback)
+{
+  IOEdgeDetector detector(IOEdgeCallback(), IOEdgeFilter::all());
+  PinData pin_data{};
+  detector.update(pin_data, 1 /*scan_counter*/, 10 /*timestamp*/);
+  setInputBit(pin_data, ZONE_SW_1_ID);
+  EXPECT_NO_THROW(detector.update(pin_data, 1 /*scan_counter*/, 20 /*timestamp*/));
+}
+
+TEST(IOEdgeFilterTest, shouldSelectNothingWhenDefaultConstructed)
+{
+  EXPECT_EQ(IOEdgeFilter().inputMask(), 0u);
+  EXPECT_EQ(IOEdgeFilter().outputMask(), 0u);
+}
+
+TEST(IOEdgeFilterTest, shouldSelectAllUsedPins)
+{
+  EXPECT_EQ(IOEdgeFilter::all().inputMask(), data_conversion_layer::monitoring_frame::io::USED_INPUT_BITS_MASK);
+  EXPECT_EQ(IOEdgeFilter::all().outputMask(), data_conversion_layer::monitoring_frame::io::USED_OUTPUT_BITS_MASK);
+}
+
+TEST(IOEdgeFilterTest, shouldSelectBitOfGivenType)
+{
+  const auto filter{ IOEdgeFilter().input(LogicalInputType::zone_sw_1).output(OutputType::safe_1_int) };
+  EXPECT_EQ(filter.inputMask(), uint64_t{ 1 } << ZONE_SW_1_ID);
+  EXPECT_EQ(filter.outputMask(), uint64_t{ 1 } << SAFE_1_INT_ID);
+}
+
+}  // namespace psen_scan_v2_standalone_test
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,137 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <console_bridge/console.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "psen_scan_v2_standalone/util/async_log_sink.h"
+#include "psen_scan_v2_standalone/util/logging.h"
+
+#include "psen_scan_v2_standalone/util/mock_console_bridge_output_handler.h"
+
+using namespace psen_scan_v2_standalone_test;
+using psen_scan_v2_standalone::util::AsyncLogSink;
+
+static const std::chrono::milliseconds NO_PERIODIC_DRAIN{ std::chrono::hours(1) };
+
+TEST(AsyncLogSinkTest, shouldRoundCapacityUpToPowerOfTwo)
+{
+  AsyncLogSink sink(5);
+  EXPECT_EQ(8u, sink.capacity());
+}
+
+TEST(AsyncLogSinkTest, shouldThrowIfAnotherSinkExists)
+{
+  AsyncLogSink sink;
+  EXPECT_THROW(AsyncLogSink{}, std::logic_error);
+}
+
+TEST(AsyncLogSinkTest, shouldPassQueuedMessagesToConsoleBridgeOnDestruction)
+{
+  INJECT_LOG_MOCK;
+  setLogLevel(CONSOLE_BRIDGE_LOG_INFO);
+  auto sink = std::unique_ptr<AsyncLogSink>(new AsyncLogSink(8, NO_PERIODIC_DRAIN));
+
+  EXPECT_ANY_LOG().Times(0);
+  const int line{ __LINE__ + 1 };
+  PSENSCAN_INFO("Name", "msg");
+  ::testing::Mock::VerifyAndClearExpectations(&mock);
+
+  EXPECT_LOG(INFO, "Name: msg", __FILE__, line).Times(1);
+  sink.reset();
+}
+
+TEST(AsyncLogSinkTest, shouldPassMessagesToConsoleBridgePeriodically)
+{
+  INJECT_LOG_MOCK;
+  setLogLevel(CONSOLE_BRIDGE_LOG_INFO);
+  AsyncLogSink sink(8, std::chrono::milliseconds(1));
+
+  std::promise<void> logged;
+  EXPECT_LOG(INFO, "Name: msg", __FILE__, __LINE__ + 3).WillOnce(::testing::InvokeWithoutArgs([&logged]() {
+    logged.set_value();
+  }));
+  PSENSCAN_INFO("Name", "msg");
+  EXPECT_EQ(std::future_status::ready, logged.get_future().wait_for(std::chrono::seconds(3)));
+}
+
+TEST(AsyncLogSinkTest, shouldDropAndCountMessagesIfQueueIsFull)
+{
+  INJECT_LOG_MOCK;
+  setLogLevel(CONSOLE_BRIDGE_LOG_INFO);
+  auto sink = std::unique_ptr<AsyncLogSink>(new AsyncLogSink(2, NO_PERIODIC_DRAIN));
+
+  EXPECT_LOG_SHORT(INFO, "Name: msg").Times(2);
+  EXPECT_LOG_SHORT(WARN, "AsyncLogSink: Dropped 3 log messages because the queue was full.").Times(1);
+  for (unsigned int i = 0; i < 5; ++i)
+  {
+    PSENSCAN_INFO("Name", "msg");
+  }
+  EXPECT_EQ(3u, sink->droppedRecords());
+  sink.reset();
+}
+
+TEST(AsyncLogSinkTest, shouldNotLoseMessagesOfConcurrentLoggingThreads)
+{
+  INJECT_NICE_LOG_MOCK;
+  setLogLevel(CONSOLE_BRIDGE_LOG_INFO);
+  const unsigned int num_threads{ 4 };
+  const unsigned int num_msgs_per_thread{ 1000 };
+  auto sink = std::unique_ptr<AsyncLogSink>(new AsyncLogSink(num_threads * num_msgs_per_thread, NO_PERIODIC_DRAIN));
+
+  EXPECT_LOG_SHORT(INFO, "Name: msg").Times(num_threads * num_msgs_per_thread);
+  std::vector<std::thread> threads;
+  for (unsigned int i = 0; i < num_threads; ++i)
+  {
+    threads.emplace_back([]() {
+      for (unsigned int j = 0; j < num_msgs_per_thread; ++j)
+      {
+        PSENSCAN_INFO("Name", "msg");
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  EXPECT_EQ(0u, sink->droppedRecords());
+  sink.reset();
+}
+
+TEST(AsyncLogSinkTest, shouldLogSynchronouslyWithoutSink)
+{
+  INJECT_LOG_MOCK;
+  setLogLevel(CONSOLE_BRIDGE_LOG_INFO);
+  {
+    AsyncLogSink sink;
+  }
+  EXPECT_LOG(INFO, "Name: msg", __FILE__, __LINE__ + 1).Times(1);
+  PSENSCAN_INFO("Name", "msg");
+  ::testing::Mock::VerifyAndClearExpectations(&mock);
+}
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,117 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "psen_scan_v2_standalone/util/hot_path_tracer.h"
+
+using namespace psen_scan_v2_standalone::util;
+using namespace std::chrono_literals;
+using Stage = HotPathTracer::Stage;
+
+namespace psen_scan_v2_standalone_test
+{
+static void traceScanRound(HotPathTracer& tracer, const std::chrono::milliseconds& callback_duration)
+{
+  tracer.traceReceive();
+  tracer.traceDeserialized();
+  tracer.traceRoundComplete();
+  tracer.traceConverted();
+  std::this_thread::sleep_for(callback_duration);
+  tracer.traceCallbackReturned();
+}
+
+TEST(HotPathTracerTest, shouldBeDisabledByDefault)
+{
+  EXPECT_FALSE(HotPathTracer().isEnabled());
+  EXPECT_FALSE(HotPathTracer::disabled().isEnabled());
+}
+
+TEST(HotPathTracerTest, shouldNotRecordIfDisabled)
+{
+  HotPathTracer tracer{ false };
+  traceScanRound(tracer, 0ms);
+  for (std::size_t i = 0; i < HotPathTracer::NUM_STAGES; ++i)
+  {
+    EXPECT_EQ(0u, tracer.histogram(static_cast<Stage>(i)).count());
+  }
+}
+
+TEST(HotPathTracerTest, shouldRecordEveryStageOnce)
+{
+  HotPathTracer tracer{ true };
+  traceScanRound(tracer, 0ms);
+  for (std::size_t i = 0; i < HotPathTracer::NUM_STAGES; ++i)
+  {
+    EXPECT_EQ(1u, tracer.histogram(static_cast<Stage>(i)).count()) << HotPathTracer::stageName(static_cast<Stage>(i));
+  }
+}
+
+TEST(HotPathTracerTest, shouldRecordOnlyDeserializationForFramesNotCompletingScanRound)
+{
+  HotPathTracer tracer{ true };
+  tracer.traceReceive();
+  tracer.traceDeserialized();
+  EXPECT_EQ(1u, tracer.histogram(Stage::deserialization).count());
+  EXPECT_EQ(0u, tracer.histogram(Stage::scan_round).count());
+  EXPECT_EQ(0u, tracer.histogram(Stage::total).count());
+}
+
+TEST(HotPathTracerTest, shouldAttributeTimeBetweenTracePointsToLaterStage)
+{
+  HotPathTracer tracer{ true };
+  tracer.traceReceive();
+  std::this_thread::sleep_for(10ms);
+  tracer.traceDeserialized();
+  std::this_thread::sleep_for(20ms);
+  tracer.traceRoundComplete();
+  std::this_thread::sleep_for(5ms);
+  tracer.traceConverted();
+  EXPECT_GE(tracer.summary(Stage::deserialization).min, 10ms);
+  EXPECT_GE(tracer.summary(Stage::scan_round).min, 20ms);
+  EXPECT_GE(tracer.summary(Stage::conversion).min, 5ms);
+}
+
+TEST(HotPathTracerTest, shouldAttributeCallbackDurationToCallbackAndTotal)
+{
+  HotPathTracer tracer{ true };
+  traceScanRound(tracer, 20ms);
+  EXPECT_GE(tracer.summary(Stage::callback).min, 20ms);
+  EXPECT_GE(tracer.summary(Stage::total).min, tracer.summary(Stage::callback).min);
+  EXPECT_LT(tracer.summary(Stage::conversion).max, 20ms);
+}
+
+TEST(HotPathTracerTest, shouldContainAllStagesInFormattedSummary)
+{
+  HotPathTracer tracer{ true };
+  traceScanRound(tracer, 0ms);
+  const std::string summary{ tracer.formatSummary() };
+  for (std::size_t i = 0; i < HotPathTracer::NUM_STAGES; ++i)
+  {
+    EXPECT_NE(std::string::npos, summary.find(HotPathTracer::stageName(static_cast<Stage>(i)))) << summary;
+  }
+}
+
+}  // namespace psen_scan_v2_standalone_test
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
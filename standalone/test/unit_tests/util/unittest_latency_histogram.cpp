@@ -0,0 +1,106 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <chrono>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "psen_scan_v2_standalone/util/latency_histogram.h"
+
+using namespace psen_scan_v2_standalone::util;
+using std::chrono::nanoseconds;
+
+namespace psen_scan_v2_standalone_test
+{
+TEST(LatencyHistogramTest, shouldReturnZeroStatisticsIfEmpty)
+{
+  const LatencyHistogram histogram;
+  const LatencyHistogram::Summary summary{ histogram.summary() };
+  EXPECT_EQ(0u, summary.count);
+  EXPECT_EQ(nanoseconds(0), summary.min);
+  EXPECT_EQ(nanoseconds(0), summary.max);
+  EXPECT_EQ(nanoseconds(0), summary.mean);
+  EXPECT_EQ(nanoseconds(0), summary.p50);
+  EXPECT_EQ(nanoseconds(0), summary.p999);
+}
+
+TEST(LatencyHistogramTest, shouldReturnExactValuesForSmallDurations)
+{
+  LatencyHistogram histogram;
+  for (int64_t i = 1; i <= 10; ++i)
+  {
+    histogram.record(nanoseconds(i));
+  }
+  EXPECT_EQ(10u, histogram.count());
+  EXPECT_EQ(nanoseconds(1), histogram.min());
+  EXPECT_EQ(nanoseconds(10), histogram.max());
+  EXPECT_EQ(nanoseconds(5), histogram.mean());
+  EXPECT_EQ(nanoseconds(5), histogram.percentile(50.));
+  EXPECT_EQ(nanoseconds(9), histogram.percentile(90.));
+  EXPECT_EQ(nanoseconds(10), histogram.percentile(100.));
+}
+
+TEST(LatencyHistogramTest, shouldReturnPercentilesWithBoundedRelativeError)
+{
+  LatencyHistogram histogram;
+  for (int64_t i = 1; i <= 100000; ++i)
+  {
+    histogram.record(nanoseconds(i * 100));
+  }
+
+  const double max_relative_error{ 1. / LatencyHistogram::SUB_BUCKETS };
+  for (const double percentile : { 10., 50., 90., 99., 99.9 })
+  {
+    const double expected_ns{ percentile * 100000. };
+    EXPECT_NEAR(expected_ns, histogram.percentile(percentile).count(), expected_ns * max_relative_error)
+        << "percentile " << percentile;
+  }
+  EXPECT_EQ(nanoseconds(10000000), histogram.max());
+  EXPECT_EQ(nanoseconds(5000050), histogram.mean());
+}
+
+TEST(LatencyHistogramTest, shouldNotExceedMaxForPercentiles)
+{
+  LatencyHistogram histogram;
+  histogram.record(nanoseconds(1000001));
+  EXPECT_EQ(nanoseconds(1000001), histogram.percentile(99.));
+}
+
+TEST(LatencyHistogramTest, shouldCountDurationsAboveMaxValueInLastBucket)
+{
+  LatencyHistogram histogram;
+  const nanoseconds huge_duration{ std::chrono::hours(1) };
+  histogram.record(huge_duration);
+  EXPECT_EQ(1u, histogram.count());
+  EXPECT_EQ(huge_duration, histogram.max());
+  EXPECT_EQ(huge_duration, histogram.percentile(50.));
+}
+
+TEST(LatencyHistogramTest, shouldRecordNegativeDurationsAsZero)
+{
+  LatencyHistogram histogram;
+  histogram.record(nanoseconds(-5));
+  EXPECT_EQ(nanoseconds(0), histogram.max());
+  EXPECT_EQ(nanoseconds(0), histogram.percentile(50.));
+}
+
+}  // namespace psen_scan_v2_standalone_test
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,74 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <chrono>
+#include <future>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "psen_scan_v2_standalone/util/latest_value.h"
+
+using namespace psen_scan_v2_standalone;
+
+namespace psen_scan_v2_standalone_test
+{
+using namespace std::chrono_literals;
+
+TEST(LatestValueTest, shouldReturnNothingIfNoValueWasPut)
+{
+  util::LatestValue<int> latest_value;
+  EXPECT_FALSE(latest_value.tryTake());
+  EXPECT_FALSE(latest_value.waitForNext(10ms));
+}
+
+TEST(LatestValueTest, shouldReturnOnlyTheLatestValue)
+{
+  util::LatestValue<int> latest_value;
+  latest_value.put(1);
+  latest_value.put(2);
+  EXPECT_EQ(latest_value.tryTake(), boost::optional<int>(2));
+}
+
+TEST(LatestValueTest, shouldReturnEveryValueOnlyOnce)
+{
+  util::LatestValue<int> latest_value;
+  latest_value.put(1);
+  EXPECT_EQ(latest_value.tryTake(), boost::optional<int>(1));
+  EXPECT_FALSE(latest_value.tryTake());
+  EXPECT_FALSE(latest_value.waitForNext(10ms));
+
+  latest_value.put(2);
+  EXPECT_EQ(latest_value.waitForNext(10ms), boost::optional<int>(2));
+  EXPECT_FALSE(latest_value.tryTake());
+}
+
+TEST(LatestValueTest, waitForNextShouldReturnValuePutByOtherThread)
+{
+  util::LatestValue<int> latest_value;
+  auto waiting{ std::async(std::launch::async, [&latest_value]() { return latest_value.waitForNext(2s); }) };
+  std::this_thread::sleep_for(10ms);
+  latest_value.put(3);
+  ASSERT_EQ(waiting.wait_for(1s), std::future_status::ready);
+  EXPECT_EQ(waiting.get(), boost::optional<int>(3));
+}
+
+}  // namespace psen_scan_v2_standalone_test
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
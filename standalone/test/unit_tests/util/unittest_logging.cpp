@@ -54,6 +54,33 @@ TEST(LoggingTest, logError)
   PSENSCAN_ERROR("Name", "msg");
 }
 
+TEST(LoggingTest, shouldNotFormatMessagesBelowRuntimeLogLevel)
+{
+  INJECT_LOG_MOCK;
+  setLogLevel(CONSOLE_BRIDGE_LOG_WARN);
+  unsigned int num_evaluations{ 0 };
+  EXPECT_ANY_LOG().Times(0);
+  PSENSCAN_DEBUG("Name", "{}", ++num_evaluations);
+  PSENSCAN_INFO("Name", "{}", ++num_evaluations);
+  PSENSCAN_INFO_ONCE("Name", "{}", ++num_evaluations);
+  PSENSCAN_DEBUG_THROTTLE(0.1, "Name", "{}", ++num_evaluations);
+  EXPECT_EQ(0u, num_evaluations);
+  setLogLevel(CONSOLE_BRIDGE_LOG_DEBUG);
+}
+
+TEST(LoggingTest, shouldLogOnceAfterRuntimeLogLevelIsLowered)
+{
+  INJECT_LOG_MOCK;
+  setLogLevel(CONSOLE_BRIDGE_LOG_WARN);
+  EXPECT_LOG(INFO, "Name: msg", __FILE__, __LINE__ + 4).Times(1);
+  for (const auto level : { CONSOLE_BRIDGE_LOG_WARN, CONSOLE_BRIDGE_LOG_INFO, CONSOLE_BRIDGE_LOG_INFO })
+  {
+    setLogLevel(level);
+    PSENSCAN_INFO_ONCE("Name", "msg");
+  }
+  setLogLevel(CONSOLE_BRIDGE_LOG_DEBUG);
+}
+
 TEST(LoggingTest, logInfoThrottle)
 {
   INJECT_LOG_MOCK;
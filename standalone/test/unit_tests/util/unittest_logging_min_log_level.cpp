@@ -0,0 +1,53 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <console_bridge/console.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#define PSENSCAN_MIN_LOG_LEVEL CONSOLE_BRIDGE_LOG_INFO
+#include "psen_scan_v2_standalone/util/logging.h"
+
+#include "psen_scan_v2_standalone/util/mock_console_bridge_output_handler.h"
+
+using namespace psen_scan_v2_standalone_test;
+
+TEST(LoggingMinLogLevelTest, shouldNotLogMessagesBelowCompileTimeLogLevel)
+{
+  INJECT_LOG_MOCK;
+  setLogLevel(CONSOLE_BRIDGE_LOG_DEBUG);
+  unsigned int num_evaluations{ 0 };
+  EXPECT_ANY_LOG().Times(0);
+  PSENSCAN_DEBUG("Name", "{}", ++num_evaluations);
+  PSENSCAN_DEBUG_ONCE("Name", "{}", ++num_evaluations);
+  PSENSCAN_DEBUG_THROTTLE(0.1, "Name", "{}", ++num_evaluations);
+  EXPECT_EQ(0u, num_evaluations);
+}
+
+TEST(LoggingMinLogLevelTest, shouldLogMessagesAtCompileTimeLogLevel)
+{
+  INJECT_LOG_MOCK;
+  setLogLevel(CONSOLE_BRIDGE_LOG_DEBUG);
+  EXPECT_LOG(INFO, "Name: msg", __FILE__, __LINE__ + 2).Times(1);
+  EXPECT_LOG(WARN, "Name: msg", __FILE__, __LINE__ + 2).Times(1);
+  PSENSCAN_INFO("Name", "msg");
+  PSENSCAN_WARN("Name", "msg");
+}
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
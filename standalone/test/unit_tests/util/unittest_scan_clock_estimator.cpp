@@ -0,0 +1,233 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "psen_scan_v2_standalone/util/scan_clock_estimator.h"
+#include "psen_scan_v2_standalone/util/tenth_of_degree.h"
+
+using namespace psen_scan_v2_standalone::util;
+
+namespace psen_scan_v2_standalone_test
+{
+static constexpr int64_t PERIOD_NS{ 30000000 };
+static constexpr int64_t START_TIME_NS{ 1600000000000000000 };
+static const TenthOfDegree ANGLE{ 0 };
+
+static int64_t rayTime(const int64_t& rotation, const int64_t& period_ns = PERIOD_NS)
+{
+  return START_TIME_NS + rotation * period_ns;
+}
+
+//! @returns the standard deviation of the differences between the values and the true ray times.
+template <class Values>
+static double standardDeviationOfErrors(const Values& values, const std::size_t& first_rotation)
+{
+  double sum{ 0. };
+  double square_sum{ 0. };
+  for (std::size_t i = 0; i < values.size(); ++i)
+  {
+    const auto error{ static_cast<double>(values[i] - rayTime(first_rotation + i)) };
+    sum += error;
+    square_sum += error * error;
+  }
+  const double mean{ sum / values.size() };
+  return std::sqrt(square_sum / values.size() - mean * mean);
+}
+
+TEST(ScanClockEstimatorTest, shouldThrowOnInvalidParameters)
+{
+  EXPECT_THROW(ScanClockEstimator(10, 1), std::invalid_argument);
+  EXPECT_THROW(ScanClockEstimator(10, 11), std::invalid_argument);
+  EXPECT_THROW(ScanClockEstimator(10, 5, 0), std::invalid_argument);
+  EXPECT_NO_THROW(ScanClockEstimator(10, 10));
+}
+
+TEST(ScanClockEstimatorTest, shouldReturnHostTimestampsUntilModelHasMinNumSamples)
+{
+  ScanClockEstimator estimator{ 20, 5 };
+  const int64_t jitter[]{ 100000, 0, 300000, 50000, 0, 200000 };
+  for (uint32_t i = 0; i < 5; ++i)
+  {
+    EXPECT_EQ(rayTime(i) + jitter[i], estimator.estimate(i, ANGLE, rayTime(i) + jitter[i]));
+  }
+  EXPECT_NE(rayTime(5) + jitter[5], estimator.estimate(5, ANGLE, rayTime(5) + jitter[5]));
+
+  const auto statistics{ estimator.statistics() };
+  EXPECT_EQ(6u, statistics.num_scans);
+  EXPECT_EQ(1u, statistics.num_estimated_scans);
+}
+
+TEST(ScanClockEstimatorTest, shouldReduceTheJitterOfTheTimestamps)
+{
+  std::mt19937 generator{ 42 };
+  std::exponential_distribution<double> latency_ns{ 1. / 500000. };
+
+  ScanClockEstimator estimator;
+  std::vector<int64_t> host_timestamps;
+  std::vector<int64_t> estimated_timestamps;
+  for (uint32_t i = 0; i < 2000; ++i)
+  {
+    const int64_t host_timestamp{ rayTime(i) + static_cast<int64_t>(latency_ns(generator)) };
+    const int64_t estimated_timestamp{ estimator.estimate(i, ANGLE, host_timestamp) };
+    if (i >= SCAN_CLOCK_WINDOW_SIZE)
+    {
+      host_timestamps.push_back(host_timestamp);
+      estimated_timestamps.push_back(estimated_timestamp);
+    }
+  }
+
+  const double host_error{ standardDeviationOfErrors(host_timestamps, SCAN_CLOCK_WINDOW_SIZE) };
+  const double estimated_error{ standardDeviationOfErrors(estimated_timestamps, SCAN_CLOCK_WINDOW_SIZE) };
+  EXPECT_LT(estimated_error * 5., host_error);
+
+  const auto statistics{ estimator.statistics() };
+  EXPECT_NEAR(static_cast<double>(PERIOD_NS), statistics.period_ns, 1000.);
+  EXPECT_NEAR(0., statistics.residual_mean_ns, 50000.);
+  EXPECT_NEAR(host_error, statistics.residual_rms_ns, 0.2 * host_error);
+  EXPECT_GT(statistics.residual_max_abs_ns, statistics.residual_rms_ns);
+  EXPECT_EQ(0u, statistics.num_resets);
+}
+
+TEST(ScanClockEstimatorTest, shouldFollowTheDriftOfTheScannerClock)
+{
+  ScanClockEstimator estimator{ 50, 10 };
+  const int64_t drifted_period_ns{ PERIOD_NS + 3000 };  // 100ppm
+  for (uint32_t i = 0; i < 500; ++i)
+  {
+    const auto estimated_timestamp{ estimator.estimate(i, ANGLE, rayTime(i, drifted_period_ns)) };
+    EXPECT_NEAR(rayTime(i, drifted_period_ns), estimated_timestamp, 1);
+  }
+  EXPECT_NEAR(static_cast<double>(drifted_period_ns), estimator.statistics().period_ns, 1.);
+}
+
+TEST(ScanClockEstimatorTest, shouldUseTheAngleAsFractionOfARotation)
+{
+  ScanClockEstimator estimator{ 50, 10 };
+  for (uint32_t i = 0; i < 20; ++i)
+  {
+    estimator.estimate(i, ANGLE, rayTime(i));
+    estimator.estimate(i, TenthOfDegree(1800), rayTime(i) + PERIOD_NS / 2);
+  }
+  EXPECT_NEAR(rayTime(20) + PERIOD_NS / 4, estimator.estimate(20, TenthOfDegree(900), rayTime(20) + PERIOD_NS / 4), 1);
+  EXPECT_EQ(0u, estimator.statistics().num_outliers);
+}
+
+TEST(ScanClockEstimatorTest, shouldHandleMissingScans)
+{
+  ScanClockEstimator estimator{ 50, 10 };
+  for (uint32_t i = 0; i < 100; i += 3)
+  {
+    EXPECT_NEAR(rayTime(i), estimator.estimate(i, ANGLE, rayTime(i)), 1);
+  }
+  EXPECT_EQ(0u, estimator.statistics().num_outliers);
+}
+
+TEST(ScanClockEstimatorTest, shouldHandleTheWrapAroundOfTheScanCounter)
+{
+  ScanClockEstimator estimator{ 50, 10 };
+  const uint32_t first_scan_counter{ std::numeric_limits<uint32_t>::max() - 20 };
+  for (uint32_t i = 0; i < 50; ++i)
+  {
+    EXPECT_NEAR(rayTime(i), estimator.estimate(first_scan_counter + i, ANGLE, rayTime(i)), 1);
+  }
+  EXPECT_EQ(0u, estimator.statistics().num_resets);
+}
+
+TEST(ScanClockEstimatorTest, shouldRestartIfTheScanCounterDecreases)
+{
+  ScanClockEstimator estimator{ 50, 10 };
+  for (uint32_t i = 100; i < 120; ++i)
+  {
+    estimator.estimate(i, ANGLE, rayTime(i));
+  }
+  const int64_t host_timestamp{ rayTime(120) + 123456 };
+  EXPECT_EQ(host_timestamp, estimator.estimate(0, ANGLE, host_timestamp));
+  EXPECT_EQ(1u, estimator.statistics().num_resets);
+  EXPECT_DOUBLE_EQ(0., estimator.statistics().period_ns);
+}
+
+TEST(ScanClockEstimatorTest, shouldNotAddOutliersToTheModel)
+{
+  ScanClockEstimator estimator{ 50, 10 };
+  for (uint32_t i = 0; i < 20; ++i)
+  {
+    estimator.estimate(i, ANGLE, rayTime(i));
+  }
+  const int64_t late{ 2 * SCAN_CLOCK_OUTLIER_THRESHOLD_NS };
+  EXPECT_NEAR(rayTime(20), estimator.estimate(20, ANGLE, rayTime(20) + late), 1);
+  EXPECT_NEAR(rayTime(21), estimator.estimate(21, ANGLE, rayTime(21)), 1);
+
+  const auto statistics{ estimator.statistics() };
+  EXPECT_EQ(1u, statistics.num_outliers);
+  EXPECT_EQ(0u, statistics.num_resets);
+  EXPECT_NEAR(static_cast<double>(late), statistics.residual_max_abs_ns, 1.);
+}
+
+TEST(ScanClockEstimatorTest, shouldRestartAfterConsecutiveOutliers)
+{
+  ScanClockEstimator estimator{ 50, 10, SCAN_CLOCK_OUTLIER_THRESHOLD_NS, 3 };
+  for (uint32_t i = 0; i < 20; ++i)
+  {
+    estimator.estimate(i, ANGLE, rayTime(i));
+  }
+  const int64_t clock_jump_ns{ 1000000000 };
+  estimator.estimate(20, ANGLE, rayTime(20) + clock_jump_ns);
+  estimator.estimate(21, ANGLE, rayTime(21) + clock_jump_ns);
+  EXPECT_EQ(rayTime(22) + clock_jump_ns, estimator.estimate(22, ANGLE, rayTime(22) + clock_jump_ns));
+
+  auto statistics{ estimator.statistics() };
+  EXPECT_EQ(3u, statistics.num_outliers);
+  EXPECT_EQ(1u, statistics.num_resets);
+
+  for (uint32_t i = 23; i < 40; ++i)
+  {
+    EXPECT_NEAR(rayTime(i) + clock_jump_ns, estimator.estimate(i, ANGLE, rayTime(i) + clock_jump_ns), 1);
+  }
+  EXPECT_EQ(3u, estimator.statistics().num_outliers);
+}
+
+TEST(ScanClockEstimatorTest, shouldKeepTheStatisticsOnReset)
+{
+  ScanClockEstimator estimator{ 50, 10 };
+  for (uint32_t i = 0; i < 20; ++i)
+  {
+    estimator.estimate(i, ANGLE, rayTime(i) + (i % 2 == 0 ? 1000 : -1000));
+  }
+  estimator.reset();
+
+  const auto statistics{ estimator.statistics() };
+  EXPECT_EQ(20u, statistics.num_scans);
+  EXPECT_EQ(10u, statistics.num_estimated_scans);
+  EXPECT_EQ(0u, statistics.num_resets);
+  EXPECT_DOUBLE_EQ(0., statistics.period_ns);
+  EXPECT_NEAR(1000., statistics.residual_rms_ns, 200.);
+
+  EXPECT_EQ(rayTime(0), estimator.estimate(0, ANGLE, rayTime(0)));
+}
+
+}  // namespace psen_scan_v2_standalone_test
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,129 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "psen_scan_v2_standalone/util/async_barrier.h"
+#include "psen_scan_v2_standalone/util/timer_service.h"
+
+using namespace psen_scan_v2_standalone;
+
+namespace psen_scan_v2_standalone_test
+{
+using namespace std::chrono_literals;
+using Timer = util::TimerService::Timer;
+
+TEST(TimerServiceTest, shouldShareServiceBetweenUsers)
+{
+  const auto service = util::TimerService::shared();
+  EXPECT_EQ(service, util::TimerService::shared());
+}
+
+TEST(TimerServiceTest, shouldNotCallTimeoutCallbackBeforeStart)
+{
+  std::atomic_int calls{ 0 };
+  Timer timer(10ms, [&calls]() { ++calls; });
+  std::this_thread::sleep_for(50ms);
+  EXPECT_EQ(calls, 0);
+  EXPECT_FALSE(timer.isStarted());
+}
+
+TEST(TimerServiceTest, shouldCallTimeoutCallbackRepeatedlyAfterStart)
+{
+  std::atomic_int calls{ 0 };
+  util::Barrier barrier;
+  Timer timer(10ms, [&calls, &barrier]() {
+    if (++calls == 3)
+    {
+      barrier.release();
+    }
+  });
+  timer.start();
+  EXPECT_TRUE(timer.isStarted());
+  EXPECT_TRUE(barrier.waitTillRelease(1s));
+}
+
+TEST(TimerServiceTest, shouldNotCallTimeoutCallbackWhileBeingReset)
+{
+  std::atomic_int calls{ 0 };
+  Timer timer(100ms, [&calls]() { ++calls; });
+  timer.start();
+  for (int i = 0; i < 30; ++i)
+  {
+    std::this_thread::sleep_for(10ms);
+    timer.reset();
+  }
+  EXPECT_EQ(calls, 0);
+}
+
+TEST(TimerServiceTest, shouldNotCallTimeoutCallbackAfterStop)
+{
+  std::atomic_int calls{ 0 };
+  Timer timer(20ms, [&calls]() { ++calls; });
+  timer.start();
+  timer.stop();
+  std::this_thread::sleep_for(60ms);
+  EXPECT_EQ(calls, 0);
+  EXPECT_FALSE(timer.isStarted());
+}
+
+TEST(TimerServiceTest, shouldServeTimersWithDifferentTimeoutsIndependently)
+{
+  util::Barrier short_barrier;
+  std::atomic_int long_calls{ 0 };
+  Timer long_timer(1s, [&long_calls]() { ++long_calls; });
+  Timer short_timer(10ms, [&short_barrier]() { short_barrier.release(); });
+
+  long_timer.start();
+  short_timer.start();
+  EXPECT_TRUE(short_barrier.waitTillRelease(500ms));
+  EXPECT_EQ(long_calls, 0);
+}
+
+TEST(TimerServiceTest, shouldRestartTimerAfterStop)
+{
+  util::Barrier barrier;
+  Timer timer(10ms, [&barrier]() { barrier.release(); });
+  timer.start();
+  timer.stop();
+  timer.start();
+  EXPECT_TRUE(barrier.waitTillRelease(1s));
+}
+
+TEST(TimerServiceTest, shouldAllowDestructionOfOtherTimerInTimeoutCallback)
+{
+  util::Barrier barrier;
+  std::unique_ptr<Timer> other_timer(new Timer(1s, []() {}));
+  Timer timer(10ms, [&other_timer, &barrier]() {
+    other_timer.reset();
+    barrier.release();
+  });
+  other_timer->start();
+  timer.start();
+  EXPECT_TRUE(barrier.waitTillRelease(1s));
+}
+
+}  // namespace psen_scan_v2_standalone_test
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
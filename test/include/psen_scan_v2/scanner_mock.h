@@ -35,6 +35,7 @@ public:
 
   MOCK_METHOD0(start, std::future<void>());
   MOCK_METHOD0(stop, std::future<void>());
+  MOCK_METHOD1(reconfigure, std::future<void>(const psen_scan_v2_standalone::ScannerConfiguration&));
 
   void invokeLaserScanCallback(const psen_scan_v2_standalone::LaserScan& scan);
 
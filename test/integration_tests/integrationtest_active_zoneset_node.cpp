@@ -41,6 +41,9 @@ using namespace std::chrono_literals;
 using namespace psen_scan_v2_standalone;
 using namespace psen_scan_v2_standalone_test;
 
+using ::testing::_;
+using ::testing::AllOf;
+using ::testing::AnyNumber;
 using ::testing::Contains;
 
 MATCHER(hasPoints, "")
@@ -115,7 +118,13 @@ void ActiveZonesetNodeTest::SetUp()
   // initialize here to avoid traffic of above reset
   marker_sub_mock_.reset(new SubscriberMock<visualization_msgs::MarkerArray>{
       nh_, "/test_ns_laser_1/active_zoneset_markers", QUEUE_SIZE });
+  // the markers of the active zone are latched, so every new subscriber receives them once
+  auto latched_marker_barrier =
+      EXPECT_ASYNC_CALL(*marker_sub_mock_,
+                        callback(Field(&visualization_msgs::MarkerArray::markers,
+                                       Contains(AllOf(hasNS(SAFETY_NS_ZONE_1), hasAddAction())))));
   ASSERT_TRUE(isConnected(*marker_sub_mock_));
+  ASSERT_TRUE(latched_marker_barrier->waitTillRelease(3s)) << "Failed to receive the latched markers of active zone 0.";
 }
 
 const std::string ACTIVE_ZONESET_MARKER_TOPICNAME{ "/test_ns_laser_1/active_zoneset_markers" };
@@ -156,8 +165,12 @@ void ActiveZonesetNodeTest::sendActiveZone(uint8_t zone)
     return ::testing::AssertionFailure() << "Could not connect with subscriber on marker topic.";
   }
 
-  auto reset_marker_barrier = EXPECT_ASYNC_CALL(
-      reset_marker_mock, callback(Field(&visualization_msgs::MarkerArray::markers, Contains(hasAddAction()))));
+  // the latched markers of the zone activated by the previous test may arrive first
+  EXPECT_CALL(reset_marker_mock, callback(_)).Times(AnyNumber());
+  auto reset_marker_barrier =
+      EXPECT_ASYNC_CALL(reset_marker_mock,
+                        callback(Field(&visualization_msgs::MarkerArray::markers,
+                                       Contains(AllOf(hasNS(SAFETY_NS_ZONE_1), hasAddAction())))));
 
   sendActiveZone(0);
   if (!reset_marker_barrier->waitTillRelease(3s))
@@ -169,25 +182,26 @@ void ActiveZonesetNodeTest::sendActiveZone(uint8_t zone)
 
 TEST_F(ActiveZonesetNodeTest, shouldPublishMarkersWithCorrectType)
 {
+  SubscriberMock<visualization_msgs::MarkerArray> late_marker_mock(nh_, ACTIVE_ZONESET_MARKER_TOPICNAME, QUEUE_SIZE);
   auto barrier = EXPECT_N_ASYNC_CALLS(
-      *marker_sub_mock_, callback(Field(&visualization_msgs::MarkerArray::markers, Contains(hasTriangleList()))), 1);
+      late_marker_mock, callback(Field(&visualization_msgs::MarkerArray::markers, Contains(hasTriangleList()))), 1);
   sendActiveZone(0);
   barrier->waitTillRelease(3s);
 }
 
 TEST_F(ActiveZonesetNodeTest, shouldPublishMarkersWithPoints)
 {
+  SubscriberMock<visualization_msgs::MarkerArray> late_marker_mock(nh_, ACTIVE_ZONESET_MARKER_TOPICNAME, QUEUE_SIZE);
   auto barrier = EXPECT_N_ASYNC_CALLS(
-      *marker_sub_mock_, callback(Field(&visualization_msgs::MarkerArray::markers, Contains(hasPoints()))), 1);
+      late_marker_mock, callback(Field(&visualization_msgs::MarkerArray::markers, Contains(hasPoints()))), 1);
   sendActiveZone(0);
   barrier->waitTillRelease(3s);
 }
 
-using ::testing::AllOf;
-
 TEST_F(ActiveZonesetNodeTest, shouldPublishMarkersForAllDefinedZoneTypes)
 {
-  auto barrier = EXPECT_ASYNC_CALL(*marker_sub_mock_,
+  SubscriberMock<visualization_msgs::MarkerArray> late_marker_mock(nh_, ACTIVE_ZONESET_MARKER_TOPICNAME, QUEUE_SIZE);
+  auto barrier = EXPECT_ASYNC_CALL(late_marker_mock,
                                    callback(Field(&visualization_msgs::MarkerArray::markers,
                                                   AllOf(SizeIs(2),
                                                         Contains(AllOf(hasNS(SAFETY_NS_ZONE_1), hasAddAction())),
@@ -208,18 +222,19 @@ TEST_F(ActiveZonesetNodeTest, shouldPublishMarkersForNewActiveZoneWhenActiveZone
   barrier->waitTillRelease(3s);
 }
 
-TEST_F(ActiveZonesetNodeTest, shouldNotPublishDeleteMarkersForSameActiveZone)
+TEST_F(ActiveZonesetNodeTest, shouldNotPublishMarkersForSameActiveZone)
 {
   EXPECT_CALL(*marker_sub_mock_,
               callback(Field(&visualization_msgs::MarkerArray::markers,
-                             AnyOf(Contains(AllOf(hasNS(SAFETY_NS_ZONE_1), hasDeleteAction())),
-                                   Contains(AllOf(hasNS(WARN_NS_ZONE_1), hasDeleteAction()))))))
+                             AnyOf(Contains(AllOf(hasNS(SAFETY_NS_ZONE_1), hasAddAction())),
+                                   Contains(AllOf(hasNS(WARN_NS_ZONE_1), hasAddAction()))))))
       .Times(0);
   auto barrier = EXPECT_ASYNC_CALL(*marker_sub_mock_,
                                    callback(Field(&visualization_msgs::MarkerArray::markers,
-                                                  AllOf(Contains(AllOf(hasNS(SAFETY_NS_ZONE_1), hasAddAction())),
-                                                        Contains(AllOf(hasNS(WARN_NS_ZONE_1), hasAddAction()))))));
+                                                  Contains(AllOf(hasNS(SAFETY_NS_ZONE_2), hasAddAction())))));
   sendActiveZone(0);
+  // switch to a different zone so that the test does not depend on a timeout
+  sendActiveZone(1);
   barrier->waitTillRelease(3s);
 }
 
@@ -407,6 +407,43 @@ TEST_F(RosScannerNodeTests, shouldThrowExceptionSetInScannerStopFuture)
   EXPECT_THROW_AND_WHAT(loop.get(), std::runtime_error, error_msg.c_str());
 }
 
+TEST_F(RosScannerNodeTests, shouldPassConfigurationToScannerOnReconfigure)
+{
+  ROSScannerNodeT<ScannerMock> ros_scanner_node(nh_priv_, "scan", "scanner", 1.0 /*x_axis_rotation*/, scanner_config_);
+
+  const ScannerConfiguration new_config{ ScannerConfigurationBuilder(scanner_config_).scanResolution(
+      util::TenthOfDegree(2)) };
+  EXPECT_CALL(ros_scanner_node.scanner_,
+              reconfigure(Property(&ScannerConfiguration::scanResolution, util::TenthOfDegree(2))))
+      .WillOnce(ReturnReadyVoidFuture());
+
+  EXPECT_NO_THROW(ros_scanner_node.reconfigure(new_config));
+}
+
+TEST_F(RosScannerNodeTests, shouldThrowExceptionSetInScannerReconfigureFuture)
+{
+  ROSScannerNodeT<ScannerMock> ros_scanner_node(nh_priv_, "scan", "scanner", 1.0 /*x_axis_rotation*/, scanner_config_);
+
+  std::promise<void> reconfigure_finished_request;
+  const std::string error_msg = "error msg for testing";
+  reconfigure_finished_request.set_exception(std::make_exception_ptr(std::runtime_error(error_msg)));
+  EXPECT_CALL(ros_scanner_node.scanner_, reconfigure(_)).WillOnce(ReturnFuture(&reconfigure_finished_request));
+
+  EXPECT_THROW_AND_WHAT(ros_scanner_node.reconfigure(scanner_config_), std::runtime_error, error_msg.c_str());
+}
+
+TEST_F(RosScannerNodeTests, shouldThrowExceptionIfReconfigureDoesNotFinishInTime)
+{
+  ROSScannerNodeT<ScannerMock> ros_scanner_node(nh_priv_, "scan", "scanner", 1.0 /*x_axis_rotation*/, scanner_config_);
+
+  std::promise<void> reconfigure_finished_request;
+  EXPECT_CALL(ros_scanner_node.scanner_, reconfigure(_)).WillOnce(ReturnFuture(&reconfigure_finished_request));
+
+  EXPECT_THROW_AND_WHAT(ros_scanner_node.reconfigure(scanner_config_),
+                        std::runtime_error,
+                        "Timeout while waiting for the scanner to reconfigure.");
+}
+
 }  // namespace psen_scan_v2
 
 int main(int argc, char* argv[])
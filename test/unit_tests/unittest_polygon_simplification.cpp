@@ -0,0 +1,162 @@
+// Copyright (c) 2023 Pilz GmbH & Co. KG
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <cmath>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <geometry_msgs/Point32.h>
+#include <geometry_msgs/Polygon.h>
+
+#include "psen_scan_v2/ZoneSet.h"
+#include "psen_scan_v2/ZoneSetConfiguration.h"
+#include "psen_scan_v2/polygon_simplification.h"
+
+namespace psen_scan_v2_test
+{
+using namespace psen_scan_v2;
+
+static geometry_msgs::Point32 createPoint32(const float& x, const float& y)
+{
+  geometry_msgs::Point32 point;
+  point.x = x;
+  point.y = y;
+  point.z = 0;
+  return point;
+}
+
+MATCHER_P2(IsPoint32, x, y, "")
+{
+  return arg.x == x && arg.y == y;
+}
+
+static std::vector<geometry_msgs::Point32> createArc(const float& radius, const std::size_t& num_points)
+{
+  std::vector<geometry_msgs::Point32> arc;
+  for (std::size_t i = 0; i < num_points; ++i)
+  {
+    const double angle = i * M_PI_2 / (num_points - 1);
+    arc.push_back(createPoint32(radius * std::cos(angle), radius * std::sin(angle)));
+  }
+  return arc;
+}
+
+TEST(PolygonSimplificationTest, shouldReturnPointsUnchangedWithoutTolerance)
+{
+  const auto points = createArc(1.0, 100);
+  EXPECT_EQ(simplify(points, NO_POLYGON_SIMPLIFICATION), points);
+}
+
+TEST(PolygonSimplificationTest, shouldReturnPointsUnchangedForLessThanThreePoints)
+{
+  const std::vector<geometry_msgs::Point32> points{ createPoint32(0, 0), createPoint32(1, 1) };
+  EXPECT_EQ(simplify(points, 0.1), points);
+}
+
+TEST(PolygonSimplificationTest, shouldReduceStraightLineToEndPoints)
+{
+  std::vector<geometry_msgs::Point32> points;
+  for (int i = 0; i <= 100; ++i)
+  {
+    points.push_back(createPoint32(1.0, -0.5 + i * 0.01));
+  }
+  EXPECT_THAT(simplify(points, 0.001), ::testing::ElementsAre(IsPoint32(1.0, -0.5), IsPoint32(1.0, points.back().y)));
+}
+
+TEST(PolygonSimplificationTest, shouldMergeRunsOfCoincidingPoints)
+{
+  const std::vector<geometry_msgs::Point32> points{ createPoint32(1, 0), createPoint32(0, 0), createPoint32(0, 0),
+                                                    createPoint32(0, 0), createPoint32(0, 1) };
+  EXPECT_THAT(simplify(points, 0.001), ::testing::ElementsAre(IsPoint32(1, 0), IsPoint32(0, 0), IsPoint32(0, 1)));
+}
+
+TEST(PolygonSimplificationTest, shouldKeepCornersOfRectangularField)
+{
+  std::vector<geometry_msgs::Point32> points;
+  for (int i = 0; i <= 50; ++i)
+  {
+    points.push_back(createPoint32(1.0, i * 0.02));
+  }
+  for (int i = 1; i <= 50; ++i)
+  {
+    points.push_back(createPoint32(1.0 - i * 0.02, 1.0));
+  }
+  const auto& corner = points.at(50);
+  const auto& end = points.back();
+  EXPECT_THAT(simplify(points, 0.001),
+              ::testing::ElementsAre(IsPoint32(1.0, 0.0), IsPoint32(corner.x, corner.y), IsPoint32(end.x, end.y)));
+}
+
+TEST(PolygonSimplificationTest, shouldKeepRemovedPointsWithinTolerance)
+{
+  const double tolerance{ 0.005 };
+  const auto arc = createArc(5.0, 1000);
+  const auto simplified = simplify(arc, tolerance);
+
+  EXPECT_LT(simplified.size(), arc.size() / 10);
+  for (const auto& point : arc)
+  {
+    double min_distance{ INFINITY };
+    for (std::size_t i = 1; i < simplified.size(); ++i)
+    {
+      const auto distance = polygon_simplification::distanceToSegment(point, simplified.at(i - 1), simplified.at(i));
+      min_distance = std::fmin(min_distance, distance);
+    }
+    EXPECT_LE(min_distance, tolerance);
+  }
+}
+
+TEST(PolygonSimplificationTest, shouldSimplifyAllPolygonsOfZoneSetConfiguration)
+{
+  ZoneSet zoneset;
+  zoneset.header.frame_id = "laser_1";
+  zoneset.speed_upper = 10;
+  zoneset.safety1.points = createArc(1.0, 100);
+  zoneset.safety2.points = createArc(1.0, 100);
+  zoneset.safety3.points = createArc(1.0, 100);
+  zoneset.warn1.points = createArc(2.0, 100);
+  zoneset.warn2.points = createArc(2.0, 100);
+  zoneset.muting1.points = createArc(3.0, 100);
+  zoneset.muting2.points = createArc(3.0, 100);
+
+  ZoneSetConfiguration config;
+  config.zonesets.push_back(zoneset);
+  const auto simplified = simplify(config, 0.01);
+
+  ASSERT_EQ(simplified.zonesets.size(), 1u);
+  const auto& simplified_zoneset = simplified.zonesets.at(0);
+  EXPECT_EQ(simplified_zoneset.header.frame_id, zoneset.header.frame_id);
+  EXPECT_EQ(simplified_zoneset.speed_upper, zoneset.speed_upper);
+  for (const auto& polygon : { simplified_zoneset.safety1,
+                               simplified_zoneset.safety2,
+                               simplified_zoneset.safety3,
+                               simplified_zoneset.warn1,
+                               simplified_zoneset.warn2,
+                               simplified_zoneset.muting1,
+                               simplified_zoneset.muting2 })
+  {
+    EXPECT_LT(polygon.points.size(), 100u);
+  }
+}
+
+}  // namespace psen_scan_v2_test
+
+int main(int argc, char* argv[])
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}